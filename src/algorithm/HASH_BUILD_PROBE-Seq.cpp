@@ -0,0 +1,162 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HASH_BUILD_PROBE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+template < hash_table::Algorithm alg >
+void HASH_BUILD_PROBE::runSeqVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  HASH_BUILD_PROBE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      HASH_BUILD_PROBE_TABLE_SETUP(alg);
+      const hash_table::seq_cas cas;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type b = 0; b < capacity; ++b ) {
+          HASH_BUILD_PROBE_CLEAR_BODY(alg);
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          HASH_BUILD_PROBE_INSERT_BODY(alg, cas);
+        }
+
+        if (hash_table::hasValuePass(alg)) {
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            HASH_BUILD_PROBE_VALUE_BODY(alg);
+          }
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          HASH_BUILD_PROBE_FIND_BODY(alg);
+        }
+
+      }
+      stopTimer();
+
+      HASH_BUILD_PROBE_TABLE_TEARDOWN(alg);
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      HASH_BUILD_PROBE_TABLE_SETUP(alg);
+      auto cas = [](auto* ptr, auto compare, auto value) {
+        return RAJA::atomicCAS<RAJA::seq_atomic>(ptr, compare, value);
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, capacity), [=](Index_type b) {
+          HASH_BUILD_PROBE_CLEAR_BODY(alg);
+        });
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          HASH_BUILD_PROBE_INSERT_BODY(alg, cas);
+        });
+
+        if (hash_table::hasValuePass(alg)) {
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+            HASH_BUILD_PROBE_VALUE_BODY(alg);
+          });
+        }
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          HASH_BUILD_PROBE_FIND_BODY(alg);
+        });
+
+      }
+      stopTimer();
+
+      HASH_BUILD_PROBE_TABLE_TEARDOWN(alg);
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  HASH_BUILD_PROBE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void HASH_BUILD_PROBE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<hash_table::LinearSoA>(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<hash_table::LinearAoS>(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<hash_table::RobinHoodSoA>(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<hash_table::RobinHoodAoS>(vid);
+
+  }
+
+  t += 1;
+}
+
+void HASH_BUILD_PROBE::setSeqTuningDefinitions(VariantID vid)
+{
+  for (int ialg = 0; ialg < hash_table::NumAlgorithms; ++ialg) {
+    addVariantTuningName(vid,
+        hash_table::getAlgorithmName(static_cast<hash_table::Algorithm>(ialg)));
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,112 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HASH_BUILD_PROBE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <cstdint>
+#include <random>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+HASH_BUILD_PROBE::HASH_BUILD_PROBE(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_HASH_BUILD_PROBE, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(20);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_capacity = hash_table::getCapacity(getActualProblemSize(),
+                                       params.getHashLoadFactor());
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(3);
+  // clear the buckets, insert the build keys, look up the probe keys
+  setBytesPerRep( (2*sizeof(Int_type) + 0*sizeof(Int_type)) * m_capacity +
+                  (2*sizeof(Int_type) + 1*sizeof(Int_type)) * getActualProblemSize() +
+                  (1*sizeof(Int_type) + 3*sizeof(Int_type)) * getActualProblemSize() );
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+HASH_BUILD_PROBE::~HASH_BUILD_PROBE()
+{
+}
+
+void HASH_BUILD_PROBE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type len = getActualProblemSize();
+
+  // distinct non-negative keys; multiplying by an odd number is a bijection
+  // on [0, 2^31) so key(i) for i < 2*len are distinct
+  auto key = [](Index_type i) {
+    return static_cast<Int_type>(
+        (static_cast<std::uint32_t>(i) * 2654435761u) & 0x7FFFFFFFu);
+  };
+
+  // probe keys hit a random build key with the given probability, else
+  // they are keys that are not in the table
+  std::mt19937_64 gen(4793);
+  auto rand_value = [&]() {
+    return Real_type(gen() >> 11) * (Real_type(1.0) / (std::uint64_t(1) << 53));
+  };
+  const Real_type hit_ratio = run_params.getHashHitRatio();
+
+  allocAndInitData(m_build_keys, len, vid);
+  allocAndInitData(m_probe_keys, len, vid);
+  {
+    auto reset_build = scopedMoveData(m_build_keys, len, vid);
+    auto reset_probe = scopedMoveData(m_probe_keys, len, vid);
+
+    for (Index_type i = 0; i < len; ++i) {
+      m_build_keys[i] = key(i);
+    }
+    for (Index_type i = 0; i < len; ++i) {
+      if (rand_value() < hit_ratio) {
+        const Index_type j = static_cast<Index_type>(gen() % len);
+        m_probe_keys[i] = key(j);
+      } else {
+        m_probe_keys[i] = key(len + i);
+      }
+    }
+  }
+
+  allocAndInitData(m_found, len, vid);
+}
+
+void HASH_BUILD_PROBE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_found, getActualProblemSize(), vid);
+}
+
+void HASH_BUILD_PROBE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_build_keys, vid);
+  deallocData(m_probe_keys, vid);
+  deallocData(m_found, vid);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
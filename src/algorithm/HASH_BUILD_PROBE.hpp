@@ -0,0 +1,133 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// HASH_BUILD_PROBE kernel reference implementation:
+///
+/// // build: map each build key to its index
+/// for (Index_type b = 0; b < capacity; ++b ) {
+///   clear(table, b);
+/// }
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   insert(table, build_keys[i], i);
+/// }
+///
+/// // probe: index of each probe key, or -1 if it is not in the table
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   found[i] = find(table, probe_keys[i]);
+/// }
+///
+/// The table is an open addressing hash table; each tuning uses one of the
+/// probing schemes and bucket layouts in HashTable.hpp. The number of
+/// buckets is the problem size divided by the --hash-load-factor option,
+/// and the fraction of the probe keys that are build keys is set by the
+/// --hash-hit-ratio option. Iterations are lookups, so the kernel rate is
+/// the rate of lookups (with the inserts).
+///
+
+#ifndef RAJAPerf_Algorithm_HASH_BUILD_PROBE_HPP
+#define RAJAPerf_Algorithm_HASH_BUILD_PROBE_HPP
+
+#define HASH_BUILD_PROBE_DATA_SETUP \
+  Int_ptr build_keys = m_build_keys; \
+  Int_ptr probe_keys = m_probe_keys; \
+  Int_ptr found = m_found; \
+  const Index_type capacity = m_capacity;
+
+#define HASH_BUILD_PROBE_TABLE_SETUP(alg) \
+  Int_ptr table_keys = nullptr; \
+  Int_ptr table_vals = nullptr; \
+  hash_table::Bucket_type* table_buckets = nullptr; \
+  if (hash_table::isAoS(alg)) { \
+    allocData(table_buckets, capacity, vid); \
+  } else { \
+    allocData(table_keys, capacity, vid); \
+    allocData(table_vals, capacity, vid); \
+  } \
+  const hash_table::Table table{table_keys, table_vals, table_buckets, capacity};
+
+#define HASH_BUILD_PROBE_TABLE_TEARDOWN(alg) \
+  if (hash_table::isAoS(alg)) { \
+    deallocData(table_buckets, vid); \
+  } else { \
+    deallocData(table_keys, vid); \
+    deallocData(table_vals, vid); \
+  }
+
+#define HASH_BUILD_PROBE_CLEAR_BODY(alg) \
+  hash_table::clear<alg>(table, b);
+
+#define HASH_BUILD_PROBE_INSERT_BODY(alg, cas) \
+  hash_table::insert<alg>(table, build_keys[i], i, cas);
+
+#define HASH_BUILD_PROBE_VALUE_BODY(alg) \
+  hash_table::setValue<alg>(table, build_keys[i], i);
+
+#define HASH_BUILD_PROBE_FIND_BODY(alg) \
+  found[i] = hash_table::find<alg>(table, probe_keys[i]);
+
+
+#include "common/KernelBase.hpp"
+#include "HashTable.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class HASH_BUILD_PROBE : public KernelBase
+{
+public:
+
+  HASH_BUILD_PROBE(const RunParams& params);
+
+  ~HASH_BUILD_PROBE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HASH_BUILD_PROBE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HASH_BUILD_PROBE : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HASH_BUILD_PROBE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+
+  template < hash_table::Algorithm alg >
+  void runSeqVariantImpl(VariantID vid);
+  template < hash_table::Algorithm alg >
+  void runOpenMPVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  Index_type m_capacity;
+
+  Int_ptr m_build_keys;
+  Int_ptr m_probe_keys;
+  Int_ptr m_found;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
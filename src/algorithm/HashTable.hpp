@@ -0,0 +1,354 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Open addressing hash tables used by the tunings of the HASH_BUILD_PROBE
+/// kernel. Keys are non-negative Int_type values; a table maps each key to
+/// an Int_type value.
+///
+///   linear_soa    - linear probing; keys and values in separate arrays
+///   linear_aos    - linear probing; each bucket packs its key and value in
+///                   one 64-bit word
+///   robinhood_soa - Robin Hood probing; an insert takes the bucket of a key
+///                   closer to its home bucket and moves that key on, so
+///                   a lookup stops at the first key closer to its home than
+///                   the key looked up would be. The key array is built
+///                   first, then the values are stored in a second pass
+///                   since a key and its value can not be moved together
+///   robinhood_aos - Robin Hood probing with packed buckets
+///
+/// Inserts change a bucket only with a compare and swap done by the cas
+/// functor, cas(ptr, compare, value), which returns the old value. So
+/// concurrent inserts of distinct keys are safe given an atomic cas. Under
+/// Robin Hood probing the distance of the key in a bucket from its home
+/// never decreases, so lookups after the build are correct whatever the
+/// order of the inserts.
+///
+
+#ifndef RAJAPerf_Algorithm_HashTable_HPP
+#define RAJAPerf_Algorithm_HashTable_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+namespace hash_table
+{
+
+enum Algorithm {
+  LinearSoA = 0,
+  LinearAoS,
+  RobinHoodSoA,
+  RobinHoodAoS,
+
+  NumAlgorithms // Keep this one last and NEVER comment out (!!)
+};
+
+// tuning name for the given algorithm
+inline std::string getAlgorithmName(Algorithm alg)
+{
+  switch (alg) {
+    case LinearSoA:    return "linear_soa";
+    case LinearAoS:    return "linear_aos";
+    case RobinHoodSoA: return "robinhood_soa";
+    case RobinHoodAoS: return "robinhood_aos";
+    default:           return "unknown";
+  }
+}
+
+constexpr bool isAoS(Algorithm alg)
+{
+  return alg == LinearAoS || alg == RobinHoodAoS;
+}
+
+// value returned by lookups of keys not in the table
+constexpr Int_type not_found = -1;
+
+constexpr Int_type empty_key = -1;
+
+// packed key (high 32 bits) and value (low 32 bits)
+using Bucket_type = unsigned long long;
+constexpr Bucket_type empty_bucket = ~Bucket_type(0);
+
+inline Bucket_type make_bucket(Int_type key, Int_type val)
+{
+  return (static_cast<Bucket_type>(static_cast<std::uint32_t>(key)) << 32) |
+          static_cast<Bucket_type>(static_cast<std::uint32_t>(val));
+}
+
+inline Int_type bucket_key(Bucket_type bucket)
+{
+  return static_cast<Int_type>(static_cast<std::uint32_t>(bucket >> 32));
+}
+
+inline Int_type bucket_val(Bucket_type bucket)
+{
+  return static_cast<Int_type>(static_cast<std::uint32_t>(bucket));
+}
+
+//
+// keys and vals are used by the SoA algorithms and buckets by the AoS
+// algorithms; each holds capacity entries.
+//
+struct Table
+{
+  Int_type* keys;
+  Int_type* vals;
+  Bucket_type* buckets;
+  Index_type capacity;
+};
+
+// capacity holding num_keys keys at the load factor, with at least one
+// bucket left empty so every probe sequence ends
+inline Index_type getCapacity(Index_type num_keys, Real_type load_factor)
+{
+  const Index_type capacity =
+      static_cast<Index_type>(std::ceil(num_keys / load_factor));
+  return std::max(capacity, num_keys + 1);
+}
+
+//
+// Multiplicative hash of the key scaled to [0, capacity) by a multiply and
+// shift rather than a modulo, so any capacity, and so any load factor, is
+// as cheap as a power of two.
+//
+inline Index_type home(const Table& t, Int_type key)
+{
+  const std::uint32_t hash = static_cast<std::uint32_t>(key) * 0x9E3779B1u;
+  return static_cast<Index_type>(
+      (static_cast<std::uint64_t>(hash) * static_cast<std::uint64_t>(t.capacity)) >> 32);
+}
+
+inline Index_type next(const Table& t, Index_type b)
+{
+  return (b+1 == t.capacity) ? 0 : b+1;
+}
+
+// number of buckets from the home bucket of key to bucket b
+inline Index_type distance(const Table& t, Index_type b, Int_type key)
+{
+  const Index_type h = home(t, key);
+  return (b >= h) ? b - h : b + t.capacity - h;
+}
+
+// plain compare and swap for tables built by one thread
+struct seq_cas
+{
+  template < typename T >
+  T operator()(T* ptr, T compare, T value) const
+  {
+    const T old = *ptr;
+    if (old == compare) {
+      *ptr = value;
+    }
+    return old;
+  }
+};
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+// atomic compare and swap for tables built by OpenMP threads
+struct omp_cas
+{
+  template < typename T >
+  T operator()(T* ptr, T compare, T value) const
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    __atomic_compare_exchange_n(ptr, &compare, value, false,
+                                __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    return compare;
+#else
+    T old;
+    #pragma omp critical (hash_table_omp_cas)
+    {
+      old = *ptr;
+      if (old == compare) {
+        *ptr = value;
+      }
+    }
+    return old;
+#endif
+  }
+};
+#endif
+
+template < Algorithm alg >
+inline void clear(const Table& t, Index_type b)
+{
+  if (isAoS(alg)) {
+    t.buckets[b] = empty_bucket;
+  } else {
+    t.keys[b] = empty_key;
+  }
+}
+
+template < typename Cas >
+inline void insertLinearSoA(const Table& t, Int_type key, Int_type val, Cas cas)
+{
+  for (Index_type b = home(t, key); ; b = next(t, b)) {
+    const Int_type old = cas(&t.keys[b], empty_key, key);
+    if (old == empty_key || old == key) {
+      t.vals[b] = val;
+      return;
+    }
+  }
+}
+
+template < typename Cas >
+inline void insertLinearAoS(const Table& t, Int_type key, Int_type val, Cas cas)
+{
+  const Bucket_type bucket = make_bucket(key, val);
+  for (Index_type b = home(t, key); ; b = next(t, b)) {
+    const Bucket_type old = cas(&t.buckets[b], empty_bucket, bucket);
+    if (old == empty_bucket || bucket_key(old) == key) {
+      return;
+    }
+  }
+}
+
+//
+// Robin Hood insert of entry, whose key is key_of(entry), into words; the
+// first cas on each bucket both tries to fill it and reads what is there.
+//
+template < typename T, typename KeyOf, typename Cas >
+inline void insertRobinHood(const Table& t, T* words, T empty, T entry,
+                            KeyOf key_of, Cas cas)
+{
+  Index_type b = home(t, key_of(entry));
+  Index_type dist = 0;
+  while (true) {
+    const T old = cas(&words[b], empty, entry);
+    if (old == empty || key_of(old) == key_of(entry)) {
+      return;
+    }
+    const Index_type old_dist = distance(t, b, key_of(old));
+    if (old_dist < dist) {
+      if (cas(&words[b], old, entry) != old) {
+        continue; // the bucket changed; look at it again
+      }
+      entry = old;
+      dist = old_dist;
+    }
+    b = next(t, b);
+    ++dist;
+  }
+}
+
+template < Algorithm alg, typename Cas >
+inline void insert(const Table& t, Int_type key, Int_type val, Cas cas)
+{
+  switch (alg) {
+    case LinearSoA: {
+      insertLinearSoA(t, key, val, cas);
+      break;
+    }
+    case LinearAoS: {
+      insertLinearAoS(t, key, val, cas);
+      break;
+    }
+    case RobinHoodSoA: {
+      insertRobinHood(t, t.keys, empty_key, key,
+                      [](Int_type k) { return k; }, cas);
+      break;
+    }
+    case RobinHoodAoS: {
+      insertRobinHood(t, t.buckets, empty_bucket, make_bucket(key, val),
+                      [](Bucket_type e) { return bucket_key(e); }, cas);
+      break;
+    }
+    default: break;
+  }
+}
+
+// bucket holding key in a Robin Hood key array, or -1
+inline Index_type findRobinHoodSoA(const Table& t, Int_type key)
+{
+  Index_type b = home(t, key);
+  for (Index_type dist = 0; ; ++dist, b = next(t, b)) {
+    const Int_type k = t.keys[b];
+    if (k == key) {
+      return b;
+    }
+    if (k == empty_key || distance(t, b, k) < dist) {
+      return -1;
+    }
+  }
+}
+
+// whether the values are stored by setValue after all keys are inserted
+constexpr bool hasValuePass(Algorithm alg)
+{
+  return alg == RobinHoodSoA;
+}
+
+template < Algorithm alg >
+inline void setValue(const Table& t, Int_type key, Int_type val)
+{
+  if (hasValuePass(alg)) {
+    t.vals[findRobinHoodSoA(t, key)] = val;
+  }
+}
+
+template < Algorithm alg >
+inline Int_type find(const Table& t, Int_type key)
+{
+  switch (alg) {
+    case LinearSoA: {
+      for (Index_type b = home(t, key); ; b = next(t, b)) {
+        const Int_type k = t.keys[b];
+        if (k == key) {
+          return t.vals[b];
+        }
+        if (k == empty_key) {
+          return not_found;
+        }
+      }
+    }
+    case LinearAoS: {
+      for (Index_type b = home(t, key); ; b = next(t, b)) {
+        const Bucket_type bucket = t.buckets[b];
+        if (bucket == empty_bucket) {
+          return not_found;
+        }
+        if (bucket_key(bucket) == key) {
+          return bucket_val(bucket);
+        }
+      }
+    }
+    case RobinHoodSoA: {
+      const Index_type b = findRobinHoodSoA(t, key);
+      return (b < 0) ? not_found : t.vals[b];
+    }
+    case RobinHoodAoS: {
+      Index_type b = home(t, key);
+      for (Index_type dist = 0; ; ++dist, b = next(t, b)) {
+        const Bucket_type bucket = t.buckets[b];
+        if (bucket == empty_bucket ||
+            distance(t, b, bucket_key(bucket)) < dist) {
+          return not_found;
+        }
+        if (bucket_key(bucket) == key) {
+          return bucket_val(bucket);
+        }
+      }
+    }
+    default: return not_found;
+  }
+}
+
+} // end namespace hash_table
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,311 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Host copy and set methods used by the Seq and OpenMP tunings of the
+/// MEMCPY and MEMSET kernels.
+///
+///   movsb       - x86 string instructions (rep movsb to copy, rep stosq to
+///                 set) which fast-string hardware runs a cache line at a
+///                 time; std::memcpy and a loop elsewhere
+///   nontemporal - streaming stores that bypass the cache, so the
+///                 destination is not read before it is written (no write
+///                 allocate); a plain loop where SSE2 is not available
+///   prefetch    - loop that prefetches prefetch_distance values ahead
+///   dispatch    - movsb when fewer than nontemporal_threshold() bytes
+///                 are written, and nontemporal otherwise
+///
+/// Real_type may be double or float; the vector and string instructions
+/// are chosen to match its size.
+///
+/// The benefit of each depends on whether the data fits in cache, so run
+/// them over a range of sizes, for example from L1 to DRAM with
+///   scripts/sweep_size.sh -x raja-perf.exe --size-min 512
+///                         --size-max 67108864 -- -k MEMCPY MEMSET
+///
+
+#ifndef RAJAPerf_Algorithm_HostMemOps_HPP
+#define RAJAPerf_Algorithm_HostMemOps_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include <unistd.h>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define RAJAPERF_HOST_MEM_REP_MOVS
+#endif
+
+namespace rajaperf
+{
+namespace algorithm
+{
+namespace host_mem
+{
+
+enum Algorithm {
+  Movsb = 0,
+  NonTemporal,
+  Prefetch,
+  Dispatch,
+
+  NumAlgorithms // Keep this one last and NEVER comment out (!!)
+};
+
+// tuning name for the given algorithm
+inline std::string getAlgorithmName(Algorithm alg)
+{
+  switch (alg) {
+    case Movsb:       return "movsb";
+    case NonTemporal: return "nontemporal";
+    case Prefetch:    return "prefetch";
+    case Dispatch:    return "dispatch";
+    default:          return "unknown";
+  }
+}
+
+// values per 64 byte cache line; threads split work on cache line bounds
+constexpr Index_type line_len = 64 / sizeof(Real_type);
+
+// values ahead of the current one that the prefetch methods prefetch
+constexpr Index_type prefetch_distance = 32 * line_len;
+
+//
+// Size in bytes at which the dispatch methods switch to non-temporal
+// stores; three quarters of the last level cache like glibc's memcpy, or
+// 8 MiB where the cache size is not available.
+//
+inline size_t nontemporal_threshold()
+{
+  static const size_t threshold = []() {
+    long llc_bytes = -1;
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+    llc_bytes = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+    return (llc_bytes > 0) ? static_cast<size_t>(llc_bytes) / 4 * 3
+                           : size_t(8) << 20;
+  }();
+  return threshold;
+}
+
+//
+// Method used by dispatch for a copy or set of len values; compares the
+// bytes written, so copies and sets of the same length switch together.
+//
+inline Algorithm dispatch_algorithm(Index_type len)
+{
+  return (len * sizeof(Real_type) < nontemporal_threshold()) ? Movsb
+                                                             : NonTemporal;
+}
+
+//
+// Part [cbegin, cend) of [ibegin, iend) handled by thread tid of nthreads,
+// split on cache line bounds so threads do not share destination lines.
+//
+inline void thread_chunk(Index_type ibegin, Index_type iend,
+                         int tid, int nthreads,
+                         Index_type& cbegin, Index_type& cend)
+{
+  const Index_type nlines = (iend - ibegin + line_len - 1) / line_len;
+  cbegin = std::min(iend, ibegin + line_len * (nlines * tid / nthreads));
+  cend = std::min(iend, ibegin + line_len * (nlines * (tid+1) / nthreads));
+}
+
+inline void copy_movsb(Real_type* dst, const Real_type* src, Index_type len)
+{
+#if defined(RAJAPERF_HOST_MEM_REP_MOVS)
+  size_t bytes = len * sizeof(Real_type);
+  asm volatile("rep movsb"
+               : "+D"(dst), "+S"(src), "+c"(bytes)
+               :
+               : "memory");
+#else
+  std::memcpy(dst, src, len * sizeof(Real_type));
+#endif
+}
+
+namespace detail
+{
+
+//
+// Overloads for each floating point type Real_type may be, so the string
+// and vector instructions always match the size of the values.
+//
+#if defined(RAJAPERF_HOST_MEM_REP_MOVS)
+inline void store_string(double* dst, double val, size_t count)
+{
+  std::uint64_t bits;
+  std::memcpy(&bits, &val, sizeof(bits));
+  asm volatile("rep stosq"
+               : "+D"(dst), "+c"(count)
+               : "a"(bits)
+               : "memory");
+}
+
+inline void store_string(float* dst, float val, size_t count)
+{
+  std::uint32_t bits;
+  std::memcpy(&bits, &val, sizeof(bits));
+  asm volatile("rep stosl"
+               : "+D"(dst), "+c"(count)
+               : "a"(bits)
+               : "memory");
+}
+#endif
+
+#if defined(__AVX__)
+constexpr size_t stream_bytes = 32;
+
+inline void stream_copy(double* dst, const double* src)
+{ _mm256_stream_pd(dst, _mm256_loadu_pd(src)); }
+
+inline void stream_copy(float* dst, const float* src)
+{ _mm256_stream_ps(dst, _mm256_loadu_ps(src)); }
+
+inline void stream_set(double* dst, double val)
+{ _mm256_stream_pd(dst, _mm256_set1_pd(val)); }
+
+inline void stream_set(float* dst, float val)
+{ _mm256_stream_ps(dst, _mm256_set1_ps(val)); }
+#elif defined(__SSE2__)
+constexpr size_t stream_bytes = 16;
+
+inline void stream_copy(double* dst, const double* src)
+{ _mm_stream_pd(dst, _mm_loadu_pd(src)); }
+
+inline void stream_copy(float* dst, const float* src)
+{ _mm_stream_ps(dst, _mm_loadu_ps(src)); }
+
+inline void stream_set(double* dst, double val)
+{ _mm_stream_pd(dst, _mm_set1_pd(val)); }
+
+inline void stream_set(float* dst, float val)
+{ _mm_stream_ps(dst, _mm_set1_ps(val)); }
+#endif
+
+} // end namespace detail
+
+inline void set_movsb(Real_type* dst, Real_type val, Index_type len)
+{
+#if defined(RAJAPERF_HOST_MEM_REP_MOVS)
+  detail::store_string(dst, val, len);
+#else
+  for (Index_type i = 0; i < len; ++i) {
+    dst[i] = val;
+  }
+#endif
+}
+
+inline void copy_nontemporal(Real_type* dst, const Real_type* src, Index_type len)
+{
+  Index_type i = 0;
+#if defined(__SSE2__)
+  constexpr Index_type vec_len = detail::stream_bytes / sizeof(Real_type);
+  for ( ; i < len && (reinterpret_cast<std::uintptr_t>(dst + i) % detail::stream_bytes) != 0; ++i) {
+    dst[i] = src[i];
+  }
+  for ( ; i + vec_len <= len; i += vec_len) {
+    detail::stream_copy(dst + i, src + i);
+  }
+  _mm_sfence();
+#endif
+  for ( ; i < len; ++i) {
+    dst[i] = src[i];
+  }
+}
+
+inline void set_nontemporal(Real_type* dst, Real_type val, Index_type len)
+{
+  Index_type i = 0;
+#if defined(__SSE2__)
+  constexpr Index_type vec_len = detail::stream_bytes / sizeof(Real_type);
+  for ( ; i < len && (reinterpret_cast<std::uintptr_t>(dst + i) % detail::stream_bytes) != 0; ++i) {
+    dst[i] = val;
+  }
+  for ( ; i + vec_len <= len; i += vec_len) {
+    detail::stream_set(dst + i, val);
+  }
+  _mm_sfence();
+#endif
+  for ( ; i < len; ++i) {
+    dst[i] = val;
+  }
+}
+
+inline void copy_prefetch(Real_type* dst, const Real_type* src, Index_type len)
+{
+  Index_type i = 0;
+  for ( ; i + line_len <= len; i += line_len) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(src + i + prefetch_distance, 0, 0);
+    __builtin_prefetch(dst + i + prefetch_distance, 1, 0);
+#endif
+    for (Index_type j = i; j < i + line_len; ++j) {
+      dst[j] = src[j];
+    }
+  }
+  for ( ; i < len; ++i) {
+    dst[i] = src[i];
+  }
+}
+
+inline void set_prefetch(Real_type* dst, Real_type val, Index_type len)
+{
+  Index_type i = 0;
+  for ( ; i + line_len <= len; i += line_len) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(dst + i + prefetch_distance, 1, 0);
+#endif
+    for (Index_type j = i; j < i + line_len; ++j) {
+      dst[j] = val;
+    }
+  }
+  for ( ; i < len; ++i) {
+    dst[i] = val;
+  }
+}
+
+inline void copy(Algorithm alg, Real_type* dst, const Real_type* src, Index_type len)
+{
+  if (alg == Dispatch) {
+    alg = dispatch_algorithm(len);
+  }
+  switch (alg) {
+    case Movsb:       copy_movsb(dst, src, len); break;
+    case NonTemporal: copy_nontemporal(dst, src, len); break;
+    case Prefetch:    copy_prefetch(dst, src, len); break;
+    default: break;
+  }
+}
+
+inline void set(Algorithm alg, Real_type* dst, Real_type val, Index_type len)
+{
+  if (alg == Dispatch) {
+    alg = dispatch_algorithm(len);
+  }
+  switch (alg) {
+    case Movsb:       set_movsb(dst, val, len); break;
+    case NonTemporal: set_nontemporal(dst, val, len); break;
+    case Prefetch:    set_prefetch(dst, val, len); break;
+    default: break;
+  }
+}
+
+} // end namespace host_mem
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
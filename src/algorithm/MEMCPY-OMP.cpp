@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <cstring>
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +19,7 @@ namespace algorithm
 {
 
 
-void MEMCPY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void MEMCPY::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -94,5 +95,153 @@ void MEMCPY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 #endif
 }
 
+//
+// Each thread calls std::memcpy on its part of the array.
+//
+void MEMCPY::runOpenMPVariantLibrary(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  MEMCPY_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          Index_type cbegin, cend;
+          host_mem::thread_chunk(ibegin, iend,
+                                 omp_get_thread_num(), omp_get_num_threads(),
+                                 cbegin, cend);
+          std::memcpy(y + cbegin, x + cbegin, (cend - cbegin)*sizeof(Real_type));
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  MEMCPY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void MEMCPY::runOpenMPVariantHostMem(VariantID vid, host_mem::Algorithm alg)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  MEMCPY_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      // dispatch on the total size, as the threads share the cache
+      const host_mem::Algorithm chunk_alg = (alg == host_mem::Dispatch)
+          ? host_mem::dispatch_algorithm(iend - ibegin)
+          : alg;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          Index_type cbegin, cend;
+          host_mem::thread_chunk(ibegin, iend,
+                                 omp_get_thread_num(), omp_get_num_threads(),
+                                 cbegin, cend);
+          host_mem::copy(chunk_alg, y + cbegin, x + cbegin, cend - cbegin);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  MEMCPY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(alg);
+#endif
+}
+
+void MEMCPY::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantLibrary(vid);
+
+    }
+
+    t += 1;
+
+    for (int ialg = 0; ialg < host_mem::NumAlgorithms; ++ialg) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantHostMem(vid, static_cast<host_mem::Algorithm>(ialg));
+
+      }
+
+      t += 1;
+
+    }
+
+  }
+}
+
+void MEMCPY::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_OpenMP) {
+
+    addVariantTuningName(vid, "library");
+
+    for (int ialg = 0; ialg < host_mem::NumAlgorithms; ++ialg) {
+      addVariantTuningName(vid,
+          host_mem::getAlgorithmName(static_cast<host_mem::Algorithm>(ialg)));
+    }
+
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
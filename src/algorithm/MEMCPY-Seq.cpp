@@ -136,6 +136,37 @@ void MEMCPY::runSeqVariantDefault(VariantID vid)
 
 }
 
+void MEMCPY::runSeqVariantHostMem(VariantID vid, host_mem::Algorithm alg)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  MEMCPY_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        host_mem::copy(alg, y + ibegin, x + ibegin, iend - ibegin);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  MEMCPY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
 void MEMCPY::runSeqVariant(VariantID vid, size_t tune_idx)
 {
   size_t t = 0;
@@ -159,6 +190,22 @@ void MEMCPY::runSeqVariant(VariantID vid, size_t tune_idx)
   }
 
   t += 1;
+
+  if (vid == Base_Seq) {
+
+    for (int ialg = 0; ialg < host_mem::NumAlgorithms; ++ialg) {
+
+      if (tune_idx == t) {
+
+        runSeqVariantHostMem(vid, static_cast<host_mem::Algorithm>(ialg));
+
+      }
+
+      t += 1;
+
+    }
+
+  }
 }
 
 void MEMCPY::setSeqTuningDefinitions(VariantID vid)
@@ -168,6 +215,13 @@ void MEMCPY::setSeqTuningDefinitions(VariantID vid)
   }
 
   addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+    for (int ialg = 0; ialg < host_mem::NumAlgorithms; ++ialg) {
+      addVariantTuningName(vid,
+          host_mem::getAlgorithmName(static_cast<host_mem::Algorithm>(ialg)));
+    }
+  }
 }
 
 } // end namespace algorithm
@@ -137,6 +137,37 @@ void MEMSET::runSeqVariantDefault(VariantID vid)
 
 }
 
+void MEMSET::runSeqVariantHostMem(VariantID vid, host_mem::Algorithm alg)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  MEMSET_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        host_mem::set(alg, x + ibegin, val, iend - ibegin);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  MEMSET : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
 void MEMSET::runSeqVariant(VariantID vid, size_t tune_idx)
 {
   size_t t = 0;
@@ -160,6 +191,22 @@ void MEMSET::runSeqVariant(VariantID vid, size_t tune_idx)
   }
 
   t += 1;
+
+  if (vid == Base_Seq) {
+
+    for (int ialg = 0; ialg < host_mem::NumAlgorithms; ++ialg) {
+
+      if (tune_idx == t) {
+
+        runSeqVariantHostMem(vid, static_cast<host_mem::Algorithm>(ialg));
+
+      }
+
+      t += 1;
+
+    }
+
+  }
 }
 
 void MEMSET::setSeqTuningDefinitions(VariantID vid)
@@ -169,6 +216,13 @@ void MEMSET::setSeqTuningDefinitions(VariantID vid)
   }
 
   addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+    for (int ialg = 0; ialg < host_mem::NumAlgorithms; ++ialg) {
+      addVariantTuningName(vid,
+          host_mem::getAlgorithmName(static_cast<host_mem::Algorithm>(ialg)));
+    }
+  }
 }
 
 } // end namespace algorithm
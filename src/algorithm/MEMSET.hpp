@@ -29,6 +29,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "HostMemOps.hpp"
 
 namespace rajaperf
 {
@@ -56,10 +57,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
   void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   void runSeqVariantDefault(VariantID vid);
   void runSeqVariantLibrary(VariantID vid);
+  void runSeqVariantHostMem(VariantID vid, host_mem::Algorithm alg);
+
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantLibrary(VariantID vid);
+  void runOpenMPVariantHostMem(VariantID vid, host_mem::Algorithm alg);
 
   template < size_t block_size >
   void runCudaVariantBlock(VariantID vid);
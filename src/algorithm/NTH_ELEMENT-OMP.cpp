@@ -0,0 +1,153 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "NTH_ELEMENT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void NTH_ELEMENT::runOpenMPVariantDefault(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  NTH_ELEMENT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case RAJA_OpenMP : {
+
+      Real_ptr y;
+      allocData(y, iend - ibegin, vid);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          y[i - ibegin] = x[i];
+        });
+
+        RAJA::sort<RAJA::omp_parallel_for_exec>(RAJA::make_span(y, iend - ibegin));
+        m_nth = y[rank];
+
+      }
+      stopTimer();
+
+      deallocData(y, vid);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  NTH_ELEMENT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void NTH_ELEMENT::runOpenMPVariantBase(VariantID vid, omp_select::Algorithm alg)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  NTH_ELEMENT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        m_nth = omp_select::nth_element(alg, x + ibegin, iend - ibegin, rank);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  NTH_ELEMENT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(alg);
+#endif
+}
+
+void NTH_ELEMENT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( vid == Base_OpenMP ) {
+
+    for (int ialg = 0; ialg < omp_select::NumAlgorithms; ++ialg) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantBase(vid, static_cast<omp_select::Algorithm>(ialg));
+
+      }
+
+      t += 1;
+
+    }
+
+  } else {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantDefault(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void NTH_ELEMENT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  if ( vid == Base_OpenMP ) {
+
+    for (int ialg = 0; ialg < omp_select::NumAlgorithms; ++ialg) {
+      addVariantTuningName(vid,
+          omp_select::getAlgorithmName(static_cast<omp_select::Algorithm>(ialg)));
+    }
+
+  } else {
+
+    addVariantTuningName(vid, getDefaultTuningName());
+
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
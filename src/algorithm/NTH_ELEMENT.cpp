@@ -0,0 +1,73 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "NTH_ELEMENT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+NTH_ELEMENT::NTH_ELEMENT(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_NTH_ELEMENT, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(20);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  const Index_type k =
+      std::max(Index_type(1),
+               static_cast<Index_type>(getActualProblemSize() * params.getKFraction()));
+  m_rank = std::min(k, getActualProblemSize()) - 1;
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type) + 0*sizeof(Real_type)) +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() ); // touched data size, not actual number of stores and loads
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Sort);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+NTH_ELEMENT::~NTH_ELEMENT()
+{
+}
+
+void NTH_ELEMENT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitDataSortInput(m_x, getActualProblemSize(), vid);
+  m_nth = 0.0;
+}
+
+void NTH_ELEMENT::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(&m_nth, 1, vid);
+}
+
+void NTH_ELEMENT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_x, vid);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
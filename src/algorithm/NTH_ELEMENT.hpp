@@ -0,0 +1,83 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// NTH_ELEMENT kernel reference implementation:
+///
+/// // x is not modified, so select from a copy of it
+/// std::copy(x+ibegin, x+iend, y);
+/// std::nth_element(y, y+rank, y+(iend-ibegin));
+/// Real_type nth = y[rank];
+///
+/// rank is k-1 where k is the problem size times the --k-fraction command
+/// line option, so nth is the k-th smallest value of x.
+///
+
+#ifndef RAJAPerf_Algorithm_NTH_ELEMENT_HPP
+#define RAJAPerf_Algorithm_NTH_ELEMENT_HPP
+
+#define NTH_ELEMENT_DATA_SETUP \
+  Real_ptr x = m_x; \
+  const Index_type rank = m_rank;
+
+
+#include "common/KernelBase.hpp"
+#include "OpenMPSelect.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class NTH_ELEMENT : public KernelBase
+{
+public:
+
+  NTH_ELEMENT(const RunParams& params);
+
+  ~NTH_ELEMENT();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  NTH_ELEMENT : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  NTH_ELEMENT : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  NTH_ELEMENT : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantBase(VariantID vid, omp_select::Algorithm alg);
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  Index_type m_rank;
+
+  Real_ptr m_x;
+  Real_type m_nth;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,269 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Hand-written OpenMP scan algorithms used by the Base_OpenMP tunings of
+/// the SCAN, SCAN_INCLUSIVE, and SCAN_INT kernels.
+///
+/// Each algorithm computes the exclusive (or inclusive) prefix sum of the
+/// len values in x, starting from init, and stores it in y.
+///
+///   tiled    - reduce-then-scan over tiles small enough that x stays in
+///              cache between the reduce and scan passes over a tile
+///   lookback - single pass decoupled look-back scan; threads claim blocks
+///              in order, publish block sums, and get their prefix from the
+///              sums and prefixes already published by preceding blocks
+///   simd     - tiled, with the scan of each tile done simd_width values
+///              at a time with a log-step scan held in registers
+///
+
+#ifndef RAJAPerf_Algorithm_OpenMPScan_HPP
+#define RAJAPerf_Algorithm_OpenMPScan_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include <omp.h>
+#endif
+
+namespace rajaperf
+{
+namespace algorithm
+{
+namespace omp_scan
+{
+
+enum Algorithm {
+  Tiled = 0,
+  LookBack,
+  Simd,
+
+  NumAlgorithms // Keep this one last and NEVER comment out (!!)
+};
+
+// tuning name for the given algorithm
+inline std::string getAlgorithmName(Algorithm alg)
+{
+  switch (alg) {
+    case Tiled:    return "tiled";
+    case LookBack: return "lookback";
+    case Simd:     return "simd";
+    default:       return "unknown";
+  }
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+// values each thread handles in a tile of the tiled scans
+constexpr Index_type tile_size_per_thread = 8192;
+
+// values in a block of the look-back scan
+constexpr Index_type lookback_block_size = 16384;
+
+// values scanned at once in registers by the simd scan
+constexpr Index_type simd_width = 8;
+
+//
+// Sequential scan of len values starting from carry, returns the sum.
+//
+template < bool inclusive, typename T >
+inline T scan_seq(const T* x, T* y, Index_type len, T carry)
+{
+  for (Index_type i = 0; i < len; ++i) {
+    if (inclusive) {
+      carry += x[i];
+      y[i] = carry;
+    } else {
+      const T val = x[i];
+      y[i] = carry;
+      carry += val;
+    }
+  }
+  return carry;
+}
+
+//
+// Scan of len values starting from carry using a log-step scan of
+// simd_width values at a time, returns the sum.
+//
+template < bool inclusive, typename T >
+inline T scan_simd(const T* x, T* y, Index_type len, T carry)
+{
+  Index_type i = 0;
+  for ( ; i + simd_width <= len; i += simd_width) {
+    T v[simd_width];
+    for (Index_type j = 0; j < simd_width; ++j) {
+      v[j] = x[i+j];
+    }
+    for (Index_type s = 1; s < simd_width; s *= 2) {
+      T shifted[simd_width];
+      for (Index_type j = 0; j < simd_width; ++j) {
+        shifted[j] = (j >= s) ? v[j-s] : T(0);
+      }
+      for (Index_type j = 0; j < simd_width; ++j) {
+        v[j] += shifted[j];
+      }
+    }
+    for (Index_type j = 0; j < simd_width; ++j) {
+      if (inclusive) {
+        y[i+j] = carry + v[j];
+      } else {
+        y[i+j] = carry + ((j > 0) ? v[j-1] : T(0));
+      }
+    }
+    carry += v[simd_width-1];
+  }
+  return scan_seq<inclusive>(x + i, y + i, len - i, carry);
+}
+
+template < bool inclusive, bool use_simd, typename T >
+inline void tiled_scan(const T* x, T* y, Index_type len, T init)
+{
+  const int max_threads = omp_get_max_threads();
+  std::vector<T> thread_sums(max_threads+1);
+  T carry = init;
+
+  #pragma omp parallel
+  {
+    const int nthreads = omp_get_num_threads();
+    const int tid = omp_get_thread_num();
+    const Index_type tile_size = tile_size_per_thread * nthreads;
+
+    for (Index_type tile_begin = 0; tile_begin < len; tile_begin += tile_size) {
+      const Index_type tile_len = std::min(tile_size, len - tile_begin);
+      const Index_type ibegin = tile_begin + tile_len * tid / nthreads;
+      const Index_type iend = tile_begin + tile_len * (tid+1) / nthreads;
+
+      T sum = T(0);
+      if (use_simd) {
+        #pragma omp simd reduction(+:sum)
+        for (Index_type i = ibegin; i < iend; ++i) {
+          sum += x[i];
+        }
+      } else {
+        for (Index_type i = ibegin; i < iend; ++i) {
+          sum += x[i];
+        }
+      }
+      thread_sums[tid+1] = sum;
+
+      #pragma omp barrier
+
+      #pragma omp single
+      {
+        thread_sums[0] = carry;
+        for (int t = 0; t < nthreads; ++t) {
+          thread_sums[t+1] += thread_sums[t];
+        }
+        carry = thread_sums[nthreads];
+      }
+
+      if (use_simd) {
+        scan_simd<inclusive>(x + ibegin, y + ibegin, iend - ibegin, thread_sums[tid]);
+      } else {
+        scan_seq<inclusive>(x + ibegin, y + ibegin, iend - ibegin, thread_sums[tid]);
+      }
+
+      // thread_sums is reused by the next tile
+      #pragma omp barrier
+    }
+  }
+}
+
+template < bool inclusive, typename T >
+inline void lookback_scan(const T* x, T* y, Index_type len, T init)
+{
+  // block status values
+  constexpr int status_empty = 0;
+  constexpr int status_aggregate = 1;
+  constexpr int status_prefix = 2;
+
+  const Index_type nblocks = (len + lookback_block_size - 1) / lookback_block_size;
+
+  std::unique_ptr<std::atomic<int>[]> status(new std::atomic<int>[nblocks]);
+  std::vector<T> aggregates(nblocks);
+  std::vector<T> prefixes(nblocks);
+  for (Index_type b = 0; b < nblocks; ++b) {
+    status[b].store(status_empty, std::memory_order_relaxed);
+  }
+
+  std::atomic<Index_type> next_block(0);
+
+  #pragma omp parallel
+  {
+    //
+    // Blocks are claimed in order, so every block a thread looks back at
+    // was claimed by a thread that will publish it without waiting.
+    //
+    for (Index_type b = next_block.fetch_add(1, std::memory_order_relaxed);
+         b < nblocks;
+         b = next_block.fetch_add(1, std::memory_order_relaxed)) {
+
+      const Index_type ibegin = b * lookback_block_size;
+      const Index_type iend = std::min(ibegin + lookback_block_size, len);
+
+      T aggregate = T(0);
+      for (Index_type i = ibegin; i < iend; ++i) {
+        aggregate += x[i];
+      }
+
+      T exclusive_prefix = init;
+      if (b == 0) {
+        prefixes[b] = init + aggregate;
+        status[b].store(status_prefix, std::memory_order_release);
+      } else {
+        aggregates[b] = aggregate;
+        status[b].store(status_aggregate, std::memory_order_release);
+
+        T lookback_sum = T(0);
+        for (Index_type pb = b-1; pb >= 0; --pb) {
+          int pb_status;
+          while ((pb_status = status[pb].load(std::memory_order_acquire)) == status_empty) {
+            // wait for preceding block to publish its sum
+          }
+          if (pb_status == status_prefix) {
+            lookback_sum += prefixes[pb];
+            break;
+          }
+          lookback_sum += aggregates[pb];
+        }
+        exclusive_prefix = lookback_sum;
+
+        prefixes[b] = exclusive_prefix + aggregate;
+        status[b].store(status_prefix, std::memory_order_release);
+      }
+
+      scan_seq<inclusive>(x + ibegin, y + ibegin, iend - ibegin, exclusive_prefix);
+    }
+  }
+}
+
+template < bool inclusive, typename T >
+inline void scan(Algorithm alg, const T* x, T* y, Index_type len, T init)
+{
+  switch (alg) {
+    case Tiled:    tiled_scan<inclusive, false>(x, y, len, init); break;
+    case LookBack: lookback_scan<inclusive>(x, y, len, init); break;
+    case Simd:     tiled_scan<inclusive, true>(x, y, len, init); break;
+    default: break;
+  }
+}
+
+#endif
+
+} // end namespace omp_scan
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
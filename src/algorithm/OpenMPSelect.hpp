@@ -0,0 +1,380 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Hand-written OpenMP selection algorithms used by the Base_OpenMP tunings
+/// of the TOPK and NTH_ELEMENT kernels.
+///
+/// top_k writes the indices of the k largest of the len keys to out, ordered
+/// by decreasing key and then increasing index. nth_element returns the key
+/// with the given rank (0 based) in increasing order.
+///
+///   radix - MSD radix select on the IEEE-754 bits of the keys, 8 bits per
+///           pass; each pass histograms the remaining candidates in parallel
+///           and keeps only those in the digit holding the wanted rank
+///   heap  - each thread keeps a heap of the best keys it has seen, then
+///           the sorted heaps of all threads are merged
+///
+
+#ifndef RAJAPerf_Algorithm_OpenMPSelect_HPP
+#define RAJAPerf_Algorithm_OpenMPSelect_HPP
+
+#include "common/RPTypes.hpp"
+#include "OpenMPSort.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include <omp.h>
+#endif
+
+namespace rajaperf
+{
+namespace algorithm
+{
+namespace omp_select
+{
+
+enum Algorithm {
+  Radix = 0,
+  Heap,
+
+  NumAlgorithms // Keep this one last and NEVER comment out (!!)
+};
+
+// tuning name for the given algorithm
+inline std::string getAlgorithmName(Algorithm alg)
+{
+  switch (alg) {
+    case Radix: return "radix";
+    case Heap:  return "heap";
+    default:    return "unknown";
+  }
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+// unsigned integer of the same width as Real_type, as in omp_sort::radix_sort
+using radix_type = decltype(omp_sort::radix_key(Real_type()));
+constexpr int radix_type_bits = 8*sizeof(radix_type);
+
+constexpr int radix_bits = 8;
+constexpr Index_type radix_size = Index_type(1) << radix_bits;
+
+// candidates below which the radix select finishes with std::nth_element
+constexpr Index_type radix_serial_size = Index_type(1) << 14;
+
+// inverse of omp_sort::radix_key
+inline Real_type radix_value(radix_type key)
+{
+  const radix_type sign = radix_type(1) << (radix_type_bits - 1);
+  const radix_type bits = (key & sign) ? (key ^ sign) : ~key;
+  Real_type val;
+  std::memcpy(&val, &bits, sizeof(val));
+  return val;
+}
+
+//
+// One pass of the radix select over the n radix keys given by key_at.
+// Finds the digit at shift that holds rank, makes rank relative to that
+// digit, and adds the digit to prefix. The keys with that digit are copied
+// to out unless all n keys have it; returns the number of keys with it.
+//
+template < typename KeyAt >
+inline Index_type radix_select_pass(Index_type n, KeyAt key_at, int shift,
+                                    Index_type& rank, radix_type& prefix,
+                                    std::vector<radix_type>& out)
+{
+  std::vector<Index_type> counts(omp_get_max_threads()*radix_size, 0);
+  Index_type digit = 0;
+  Index_type nmatch = 0;
+
+  #pragma omp parallel
+  {
+    const int nthreads = omp_get_num_threads();
+    const int tid = omp_get_thread_num();
+    const Index_type ibegin = n * tid / nthreads;
+    const Index_type iend = n * (tid+1) / nthreads;
+    Index_type* my_counts = counts.data() + tid*radix_size;
+
+    for (Index_type i = ibegin; i < iend; ++i) {
+      ++my_counts[(key_at(i) >> shift) & (radix_size-1)];
+    }
+
+    #pragma omp barrier
+
+    #pragma omp single
+    {
+      Index_type sum = 0;
+      for (Index_type d = 0; d < radix_size; ++d) {
+        Index_type count = 0;
+        for (int t = 0; t < nthreads; ++t) {
+          count += counts[t*radix_size + d];
+        }
+        if (rank < sum + count) {
+          digit = d;
+          nmatch = count;
+          rank -= sum;
+          break;
+        }
+        sum += count;
+      }
+
+      // thread offsets into out for the keys with the digit
+      Index_type offset = 0;
+      for (int t = 0; t < nthreads; ++t) {
+        const Index_type count = counts[t*radix_size + digit];
+        counts[t*radix_size + digit] = offset;
+        offset += count;
+      }
+
+      if (nmatch < n) {
+        out.resize(nmatch);
+      }
+    }
+
+    if (nmatch < n) {
+      radix_type* out_data = out.data();
+      Index_type o = my_counts[digit];
+      for (Index_type i = ibegin; i < iend; ++i) {
+        const radix_type key = key_at(i);
+        if (static_cast<Index_type>((key >> shift) & (radix_size-1)) == digit) {
+          out_data[o++] = key;
+        }
+      }
+    }
+  }
+
+  prefix |= static_cast<radix_type>(digit) << shift;
+  return nmatch;
+}
+
+// radix key of the key with the given rank in increasing order
+inline radix_type radix_select(const Real_type* keys, Index_type len, Index_type rank)
+{
+  std::vector<radix_type> cand;
+  std::vector<radix_type> next;
+  Index_type n = len;
+  radix_type prefix = 0;
+  bool compacted = false;
+
+  for (int shift = radix_type_bits - radix_bits; shift >= 0; shift -= radix_bits) {
+
+    Index_type nmatch;
+    if (compacted) {
+      const radix_type* cand_data = cand.data();
+      nmatch = radix_select_pass(n,
+                                 [=](Index_type i) { return cand_data[i]; },
+                                 shift, rank, prefix, next);
+    } else {
+      nmatch = radix_select_pass(n,
+                                 [=](Index_type i) { return omp_sort::radix_key(keys[i]); },
+                                 shift, rank, prefix, next);
+    }
+
+    if (nmatch < n) {
+      std::swap(cand, next);
+      compacted = true;
+      n = nmatch;
+
+      if (n <= radix_serial_size) {
+        std::nth_element(cand.begin(), cand.begin() + rank, cand.end());
+        return cand[rank];
+      }
+    }
+  }
+
+  return prefix;
+}
+
+inline void radix_top_k(const Real_type* keys, Index_type len, Index_type k,
+                        Index_type* out)
+{
+  const radix_type threshold = radix_select(keys, len, len - k);
+
+  //
+  // Take every key above the threshold, and the keys equal to it with the
+  // lowest indices until there are k.
+  //
+  std::vector<Index_type> above(omp_get_max_threads()+1, 0);
+  std::vector<Index_type> equal(omp_get_max_threads()+1, 0);
+
+  #pragma omp parallel
+  {
+    const int nthreads = omp_get_num_threads();
+    const int tid = omp_get_thread_num();
+    const Index_type ibegin = len * tid / nthreads;
+    const Index_type iend = len * (tid+1) / nthreads;
+
+    Index_type num_above = 0;
+    Index_type num_equal = 0;
+    for (Index_type i = ibegin; i < iend; ++i) {
+      const radix_type key = omp_sort::radix_key(keys[i]);
+      num_above += (key > threshold) ? 1 : 0;
+      num_equal += (key == threshold) ? 1 : 0;
+    }
+    above[tid+1] = num_above;
+    equal[tid+1] = num_equal;
+
+    #pragma omp barrier
+
+    #pragma omp single
+    {
+      for (int t = 0; t < nthreads; ++t) {
+        above[t+1] += above[t];
+      }
+      Index_type equal_left = k - above[nthreads];
+      for (int t = 0; t < nthreads; ++t) {
+        const Index_type take = std::min(equal[t+1], equal_left);
+        equal[t+1] = take;
+        equal_left -= take;
+      }
+      for (int t = 0; t < nthreads; ++t) {
+        equal[t+1] += equal[t];
+      }
+    }
+
+    Index_type o_above = above[tid];
+    Index_type o_equal = above[nthreads] + equal[tid];
+    const Index_type o_equal_end = above[nthreads] + equal[tid+1];
+    for (Index_type i = ibegin; i < iend; ++i) {
+      const radix_type key = omp_sort::radix_key(keys[i]);
+      if (key > threshold) {
+        out[o_above++] = i;
+      } else if (key == threshold && o_equal < o_equal_end) {
+        out[o_equal++] = i;
+      }
+    }
+  }
+
+  std::vector<Index_type> tmp(k);
+  auto key_of = [=](Index_type i) { return std::make_pair(-keys[i], i); };
+  omp_sort::merge_sort(out, tmp.data(), k, key_of);
+}
+
+//
+// Indices of the m best keys by the strict total order better, best first.
+//
+template < typename Better >
+inline void heap_best(Index_type len, Index_type m, Better better,
+                      Index_type* out)
+{
+  std::vector<std::vector<Index_type>> heaps(omp_get_max_threads());
+
+  #pragma omp parallel
+  {
+    const int nthreads = omp_get_num_threads();
+    const int tid = omp_get_thread_num();
+    const Index_type ibegin = len * tid / nthreads;
+    const Index_type iend = len * (tid+1) / nthreads;
+
+    // the front of the heap is the worst index kept
+    std::vector<Index_type>& heap = heaps[tid];
+    heap.reserve(std::min(m, iend - ibegin));
+    for (Index_type i = ibegin; i < iend; ++i) {
+      if (static_cast<Index_type>(heap.size()) < m) {
+        heap.push_back(i);
+        std::push_heap(heap.begin(), heap.end(), better);
+      } else if (better(i, heap.front())) {
+        std::pop_heap(heap.begin(), heap.end(), better);
+        heap.back() = i;
+        std::push_heap(heap.begin(), heap.end(), better);
+      }
+    }
+    std::sort_heap(heap.begin(), heap.end(), better);
+  }
+
+  //
+  // Merge the sorted heaps; the front of merge is the thread whose next
+  // index is best.
+  //
+  const int nheaps = static_cast<int>(heaps.size());
+  std::vector<size_t> next(nheaps, 0);
+  std::vector<int> merge;
+  for (int t = 0; t < nheaps; ++t) {
+    if (!heaps[t].empty()) {
+      merge.push_back(t);
+    }
+  }
+  auto worse_thread = [&](int lhs, int rhs) {
+    return better(heaps[rhs][next[rhs]], heaps[lhs][next[lhs]]);
+  };
+  std::make_heap(merge.begin(), merge.end(), worse_thread);
+
+  for (Index_type j = 0; j < m; ++j) {
+    std::pop_heap(merge.begin(), merge.end(), worse_thread);
+    const int t = merge.back();
+    out[j] = heaps[t][next[t]++];
+    if (next[t] < heaps[t].size()) {
+      std::push_heap(merge.begin(), merge.end(), worse_thread);
+    } else {
+      merge.pop_back();
+    }
+  }
+}
+
+inline void top_k(Algorithm alg, const Real_type* keys, Index_type len,
+                  Index_type k, Index_type* out)
+{
+  switch (alg) {
+    case Radix: {
+      radix_top_k(keys, len, k, out);
+      break;
+    }
+    case Heap: {
+      auto better = [=](Index_type lhs, Index_type rhs) {
+        return keys[lhs] > keys[rhs] || (keys[lhs] == keys[rhs] && lhs < rhs);
+      };
+      heap_best(len, k, better, out);
+      break;
+    }
+    default: break;
+  }
+}
+
+inline Real_type nth_element(Algorithm alg, const Real_type* keys,
+                             Index_type len, Index_type rank)
+{
+  switch (alg) {
+    case Radix: {
+      return radix_value(radix_select(keys, len, rank));
+    }
+    case Heap: {
+      // keep whichever of the smallest or largest keys is fewer
+      if (rank < len - rank) {
+        std::vector<Index_type> best(rank+1);
+        auto better = [=](Index_type lhs, Index_type rhs) {
+          return keys[lhs] < keys[rhs] || (keys[lhs] == keys[rhs] && lhs < rhs);
+        };
+        heap_best(len, rank+1, better, best.data());
+        return keys[best[rank]];
+      } else {
+        std::vector<Index_type> best(len-rank);
+        auto better = [=](Index_type lhs, Index_type rhs) {
+          return keys[lhs] > keys[rhs] || (keys[lhs] == keys[rhs] && lhs < rhs);
+        };
+        heap_best(len, len-rank, better, best.data());
+        return keys[best[len-rank-1]];
+      }
+    }
+    default: return 0.0;
+  }
+}
+
+#endif
+
+} // end namespace omp_select
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,340 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Hand-written OpenMP sort algorithms used by the Base_OpenMP tunings of
+/// the SORT and SORTPAIRS kernels.
+///
+/// Each algorithm sorts len values of type T in data by the key returned by
+/// key_of, using tmp (also len values) as scratch space; the sorted values
+/// are left in data.
+///
+///   radix  - LSD radix sort on the IEEE-754 bits of the key, 8 bits per
+///            pass; passes in which all keys share a digit are skipped
+///   merge  - each thread sorts a run, then runs are merged pairwise with
+///            the merges split across threads by merge path partitioning
+///   sample - keys are partitioned into one bucket per thread using
+///            splitters picked from a regular sample, then each bucket
+///            is sorted independently
+///
+
+#ifndef RAJAPerf_Algorithm_OpenMPSort_HPP
+#define RAJAPerf_Algorithm_OpenMPSort_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include <omp.h>
+#endif
+
+namespace rajaperf
+{
+namespace algorithm
+{
+namespace omp_sort
+{
+
+enum Algorithm {
+  Radix = 0,
+  Merge,
+  Sample,
+
+  NumAlgorithms // Keep this one last and NEVER comment out (!!)
+};
+
+// tuning name for the given algorithm
+inline std::string getAlgorithmName(Algorithm alg)
+{
+  switch (alg) {
+    case Radix:  return "radix";
+    case Merge:  return "merge";
+    case Sample: return "sample";
+    default:     return "unknown";
+  }
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+//
+// Unsigned integer with the same ordering as the floating point value;
+// flip all bits of negative values and the sign bit of the others.
+//
+inline std::uint64_t radix_key(double val)
+{
+  std::uint64_t bits;
+  std::memcpy(&bits, &val, sizeof(bits));
+  const std::uint64_t sign = std::uint64_t(1) << 63;
+  return (bits & sign) ? ~bits : (bits | sign);
+}
+
+inline std::uint32_t radix_key(float val)
+{
+  std::uint32_t bits;
+  std::memcpy(&bits, &val, sizeof(bits));
+  const std::uint32_t sign = std::uint32_t(1) << 31;
+  return (bits & sign) ? ~bits : (bits | sign);
+}
+
+constexpr int radix_bits = 8;
+constexpr Index_type radix_size = Index_type(1) << radix_bits;
+
+template < typename T, typename KeyOf >
+inline void radix_sort(T* data, T* tmp, Index_type len, KeyOf key_of)
+{
+  using radix_type = decltype(radix_key(key_of(data[0])));
+  constexpr int num_passes = (8*sizeof(radix_type)) / radix_bits;
+
+  std::vector<Index_type> offsets(omp_get_max_threads()*radix_size);
+  bool skip_pass = false;
+
+  #pragma omp parallel
+  {
+    const int nthreads = omp_get_num_threads();
+    const int tid = omp_get_thread_num();
+    const Index_type ibegin = len * tid / nthreads;
+    const Index_type iend = len * (tid+1) / nthreads;
+    Index_type* my_offsets = offsets.data() + tid*radix_size;
+
+    T* src = data;
+    T* dst = tmp;
+
+    for (int pass = 0; pass < num_passes; ++pass) {
+      const int shift = pass*radix_bits;
+
+      for (Index_type d = 0; d < radix_size; ++d) {
+        my_offsets[d] = 0;
+      }
+      for (Index_type i = ibegin; i < iend; ++i) {
+        ++my_offsets[(radix_key(key_of(src[i])) >> shift) & (radix_size-1)];
+      }
+
+      #pragma omp barrier
+
+      #pragma omp single
+      {
+        // digit major, thread minor exclusive scan keeps the sort stable
+        skip_pass = false;
+        Index_type sum = 0;
+        for (Index_type d = 0; d < radix_size; ++d) {
+          const Index_type digit_begin = sum;
+          for (int t = 0; t < nthreads; ++t) {
+            const Index_type count = offsets[t*radix_size + d];
+            offsets[t*radix_size + d] = sum;
+            sum += count;
+          }
+          if (sum - digit_begin == len) {
+            skip_pass = true;
+          }
+        }
+      }
+
+      if (!skip_pass) {
+        for (Index_type i = ibegin; i < iend; ++i) {
+          const Index_type d = (radix_key(key_of(src[i])) >> shift) & (radix_size-1);
+          dst[my_offsets[d]++] = src[i];
+        }
+        std::swap(src, dst);
+
+        #pragma omp barrier
+      }
+    }
+
+    if (src != data) {
+      #pragma omp for
+      for (Index_type i = 0; i < len; ++i) {
+        data[i] = tmp[i];
+      }
+    }
+  }
+}
+
+//
+// Number of values taken from a in the first k values of the stable merge
+// of sorted ranges a and b.
+//
+template < typename T, typename Compare >
+inline Index_type merge_path(const T* a, Index_type alen,
+                             const T* b, Index_type blen,
+                             Index_type k, Compare comp)
+{
+  Index_type lo = std::max(Index_type(0), k - blen);
+  Index_type hi = std::min(k, alen);
+  while (lo < hi) {
+    const Index_type i = lo + (hi - lo) / 2;
+    const Index_type j = k - i;
+    if (j > 0 && i < alen && !comp(b[j-1], a[i])) {
+      lo = i + 1;
+    } else {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+template < typename T, typename KeyOf >
+inline void merge_sort(T* data, T* tmp, Index_type len, KeyOf key_of)
+{
+  auto comp = [=](T const& lhs, T const& rhs) {
+    return key_of(lhs) < key_of(rhs);
+  };
+
+  const Index_type nthreads = omp_get_max_threads();
+  const Index_type nruns = std::max(Index_type(1), std::min(nthreads, len));
+  auto run_begin = [=](Index_type r) {
+    return len * std::min(r, nruns) / nruns;
+  };
+
+  #pragma omp parallel for schedule(static, 1)
+  for (Index_type r = 0; r < nruns; ++r) {
+    std::sort(data + run_begin(r), data + run_begin(r+1), comp);
+  }
+
+  T* src = data;
+  T* dst = tmp;
+
+  for (Index_type width = 1; width < nruns; width *= 2) {
+
+    const Index_type num_merges = (nruns + 2*width - 1) / (2*width);
+    const Index_type parts = std::max(Index_type(1), nthreads / num_merges);
+
+    #pragma omp parallel for schedule(static, 1)
+    for (Index_type p = 0; p < num_merges*parts; ++p) {
+      const Index_type m = p / parts;
+      const Index_type part = p % parts;
+
+      const Index_type a_begin = run_begin(2*m*width);
+      const Index_type b_begin = run_begin(2*m*width + width);
+      const Index_type b_end = run_begin(2*m*width + 2*width);
+      const Index_type alen = b_begin - a_begin;
+      const Index_type blen = b_end - b_begin;
+
+      const Index_type k0 = (alen + blen) * part / parts;
+      const Index_type k1 = (alen + blen) * (part+1) / parts;
+      const Index_type i0 = merge_path(src + a_begin, alen,
+                                       src + b_begin, blen, k0, comp);
+      const Index_type i1 = merge_path(src + a_begin, alen,
+                                       src + b_begin, blen, k1, comp);
+
+      std::merge(src + a_begin + i0, src + a_begin + i1,
+                 src + b_begin + (k0 - i0), src + b_begin + (k1 - i1),
+                 dst + a_begin + k0, comp);
+    }
+
+    std::swap(src, dst);
+  }
+
+  if (src != data) {
+    #pragma omp parallel for
+    for (Index_type i = 0; i < len; ++i) {
+      data[i] = tmp[i];
+    }
+  }
+}
+
+template < typename T, typename KeyOf >
+inline void sample_sort(T* data, T* tmp, Index_type len, KeyOf key_of)
+{
+  using key_type = typename std::decay<decltype(key_of(data[0]))>::type;
+
+  auto comp = [=](T const& lhs, T const& rhs) {
+    return key_of(lhs) < key_of(rhs);
+  };
+
+  const Index_type nbuckets = omp_get_max_threads();
+  constexpr Index_type oversample = 32;
+  const Index_type nsamples = nbuckets*oversample;
+
+  if (nbuckets == 1 || len < 2*nsamples) {
+    std::sort(data, data + len, comp);
+    return;
+  }
+
+  //
+  // Take a regular sample so sorted and reversed inputs are split evenly.
+  //
+  std::vector<key_type> samples(nsamples);
+  for (Index_type s = 0; s < nsamples; ++s) {
+    samples[s] = key_of(data[(2*s + 1) * len / (2*nsamples)]);
+  }
+  std::sort(samples.begin(), samples.end());
+
+  std::vector<key_type> splitters(nbuckets-1);
+  for (Index_type b = 0; b < nbuckets-1; ++b) {
+    splitters[b] = samples[(b+1)*oversample];
+  }
+
+  auto bucket_of = [&](T const& val) {
+    return std::upper_bound(splitters.begin(), splitters.end(), key_of(val)) -
+           splitters.begin();
+  };
+
+  // offsets[c*nbuckets + b] counts values of chunk c that fall in bucket b
+  const Index_type nchunks = nbuckets;
+  std::vector<Index_type> offsets(nchunks*nbuckets, 0);
+  std::vector<Index_type> bucket_begin(nbuckets+1, 0);
+
+  #pragma omp parallel for schedule(static, 1)
+  for (Index_type c = 0; c < nchunks; ++c) {
+    Index_type* chunk_offsets = offsets.data() + c*nbuckets;
+    for (Index_type i = len*c/nchunks; i < len*(c+1)/nchunks; ++i) {
+      ++chunk_offsets[bucket_of(data[i])];
+    }
+  }
+
+  Index_type sum = 0;
+  for (Index_type b = 0; b < nbuckets; ++b) {
+    bucket_begin[b] = sum;
+    for (Index_type c = 0; c < nchunks; ++c) {
+      const Index_type count = offsets[c*nbuckets + b];
+      offsets[c*nbuckets + b] = sum;
+      sum += count;
+    }
+  }
+  bucket_begin[nbuckets] = sum;
+
+  #pragma omp parallel for schedule(static, 1)
+  for (Index_type c = 0; c < nchunks; ++c) {
+    Index_type* chunk_offsets = offsets.data() + c*nbuckets;
+    for (Index_type i = len*c/nchunks; i < len*(c+1)/nchunks; ++i) {
+      tmp[chunk_offsets[bucket_of(data[i])]++] = data[i];
+    }
+  }
+
+  #pragma omp parallel for schedule(dynamic, 1)
+  for (Index_type b = 0; b < nbuckets; ++b) {
+    std::sort(tmp + bucket_begin[b], tmp + bucket_begin[b+1], comp);
+    std::copy(tmp + bucket_begin[b], tmp + bucket_begin[b+1],
+              data + bucket_begin[b]);
+  }
+}
+
+template < typename T, typename KeyOf >
+inline void sort(Algorithm alg, T* data, T* tmp, Index_type len, KeyOf key_of)
+{
+  switch (alg) {
+    case Radix:  radix_sort(data, tmp, len, key_of); break;
+    case Merge:  merge_sort(data, tmp, len, key_of); break;
+    case Sample: sample_sort(data, tmp, len, key_of); break;
+    default: break;
+  }
+}
+
+#endif
+
+} // end namespace omp_sort
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
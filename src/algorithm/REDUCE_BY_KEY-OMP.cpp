@@ -0,0 +1,163 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "REDUCE_BY_KEY.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void REDUCE_BY_KEY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE_BY_KEY_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      //
+      // Each thread counts the runs that begin in its share of the values,
+      // then sums those runs, reading past the end of its share to finish
+      // the last one.
+      //
+      std::vector<Index_type> thread_runs(omp_get_max_threads());
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type num_unique = 0;
+
+        #pragma omp parallel
+        {
+          const int nthreads = omp_get_num_threads();
+          const int tid = omp_get_thread_num();
+          const Index_type n = iend - ibegin;
+          const Index_type local_begin = ibegin + n * tid / nthreads;
+          const Index_type local_end = ibegin + n * (tid+1) / nthreads;
+
+          Index_type local_runs = 0;
+          for (Index_type i = local_begin; i < local_end; ++i ) {
+            local_runs += REDUCE_BY_KEY_IS_HEAD(i) ? 1 : 0;
+          }
+          thread_runs[tid] = local_runs;
+
+          #pragma omp barrier
+
+          #pragma omp single
+          {
+            Index_type run_count = 0;
+            for (int t = 0; t < nthreads; ++t) {
+              const Index_type count = thread_runs[t];
+              thread_runs[t] = run_count;
+              run_count += count;
+            }
+            num_unique = run_count;
+          }
+
+          Index_type r = thread_runs[tid];
+          Index_type i = local_begin;
+          while (i < local_end && !REDUCE_BY_KEY_IS_HEAD(i)) {
+            ++i;
+          }
+          while (i < local_end) {
+            const Int_type key = keys[i];
+            Real_type sum = 0.0;
+            do {
+              sum += x[i];
+              ++i;
+            } while (i < iend && keys[i] == key);
+            keys_out[r] = key;
+            sums[r] = sum;
+            ++r;
+          }
+        }
+
+        m_num_unique = num_unique;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      //
+      // Find where runs begin with a scan of head flags, then sum each run.
+      //
+      Index_ptr run_pos;
+      Index_ptr run_begin;
+      allocData(run_pos, iend - ibegin, vid);
+      allocData(run_begin, iend - ibegin + 1, vid);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          run_pos[i - ibegin] = REDUCE_BY_KEY_IS_HEAD(i) ? 1 : 0;
+        });
+
+        RAJA::exclusive_scan_inplace<RAJA::omp_parallel_for_exec>(
+            RAJA::make_span(run_pos, iend - ibegin));
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          if (REDUCE_BY_KEY_IS_HEAD(i)) {
+            keys_out[run_pos[i - ibegin]] = keys[i];
+            run_begin[run_pos[i - ibegin]] = i;
+          }
+        });
+
+        const Index_type num_unique = (iend > ibegin)
+            ? run_pos[iend - 1 - ibegin] + (REDUCE_BY_KEY_IS_HEAD(iend - 1) ? 1 : 0)
+            : 0;
+        run_begin[num_unique] = iend;
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, num_unique), [=](Index_type r) {
+          REDUCE_BY_KEY_RUN_BODY;
+        });
+
+        m_num_unique = num_unique;
+
+      }
+      stopTimer();
+
+      deallocData(run_pos, vid);
+      deallocData(run_begin, vid);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE_BY_KEY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,110 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "REDUCE_BY_KEY.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void REDUCE_BY_KEY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE_BY_KEY_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type num_unique = 0;
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          REDUCE_BY_KEY_BODY;
+        }
+
+        m_num_unique = num_unique;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      //
+      // Find where runs begin with a scan of head flags, then sum each run.
+      //
+      Index_ptr run_pos;
+      Index_ptr run_begin;
+      allocData(run_pos, iend - ibegin, vid);
+      allocData(run_begin, iend - ibegin + 1, vid);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          run_pos[i - ibegin] = REDUCE_BY_KEY_IS_HEAD(i) ? 1 : 0;
+        });
+
+        RAJA::exclusive_scan_inplace<RAJA::loop_exec>(
+            RAJA::make_span(run_pos, iend - ibegin));
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          if (REDUCE_BY_KEY_IS_HEAD(i)) {
+            keys_out[run_pos[i - ibegin]] = keys[i];
+            run_begin[run_pos[i - ibegin]] = i;
+          }
+        });
+
+        const Index_type num_unique = (iend > ibegin)
+            ? run_pos[iend - 1 - ibegin] + (REDUCE_BY_KEY_IS_HEAD(iend - 1) ? 1 : 0)
+            : 0;
+        run_begin[num_unique] = iend;
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, num_unique), [=](Index_type r) {
+          REDUCE_BY_KEY_RUN_BODY;
+        });
+
+        m_num_unique = num_unique;
+
+      }
+      stopTimer();
+
+      deallocData(run_pos, vid);
+      deallocData(run_begin, vid);
+
+      break;
+    }
+#endif
+
+    default : {
+      getCout() << "\n  REDUCE_BY_KEY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
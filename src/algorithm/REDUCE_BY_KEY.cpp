@@ -0,0 +1,100 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "REDUCE_BY_KEY.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+REDUCE_BY_KEY::REDUCE_BY_KEY(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_REDUCE_BY_KEY, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(100);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_mean_segment_length = 64;
+  m_num_segments = getSegmentOffsets(getActualProblemSize(),
+                                     m_mean_segment_length,
+                                     params.getSegmentLengths()).size() - 1;
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (0*sizeof(Int_type) + 1*sizeof(Int_type)) * getActualProblemSize() +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() +
+                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * m_num_segments +
+                  (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_num_segments );
+  setFLOPsPerRep(1 * getActualProblemSize());
+
+  setUsesFeature(Forall);
+  setUsesFeature(Scan);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+REDUCE_BY_KEY::~REDUCE_BY_KEY()
+{
+}
+
+void REDUCE_BY_KEY::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  std::vector<Index_type> offsets =
+      getSegmentOffsets(getActualProblemSize(), m_mean_segment_length,
+                        run_params.getSegmentLengths());
+
+  allocData(m_keys, getActualProblemSize(), vid);
+  {
+    auto reset_keys = scopedMoveData(m_keys, getActualProblemSize(), vid);
+    for (Index_type s = 0; s < m_num_segments; ++s) {
+      for (Index_type i = offsets[s]; i < offsets[s+1]; ++i) {
+        m_keys[i] = s;
+      }
+    }
+  }
+
+  allocAndInitDataRandValue(m_x, getActualProblemSize(), vid);
+
+  // there may be as many runs as values
+  allocAndInitData(m_keys_out, getActualProblemSize(), vid);
+  allocAndInitDataConst(m_sums, getActualProblemSize(), 0.0, vid);
+
+  m_num_unique = 0;
+}
+
+void REDUCE_BY_KEY::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_keys_out, m_num_segments, vid);
+  checksum[vid][tune_idx] += calcChecksum(m_sums, m_num_segments, vid);
+  checksum[vid][tune_idx] += static_cast<Checksum_type>(m_num_unique);
+}
+
+void REDUCE_BY_KEY::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_keys, vid);
+  deallocData(m_x, vid);
+  deallocData(m_keys_out, vid);
+  deallocData(m_sums, vid);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
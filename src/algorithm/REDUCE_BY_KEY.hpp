@@ -0,0 +1,107 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// REDUCE_BY_KEY kernel reference implementation:
+///
+/// // sum the values of each run of equal consecutive keys
+/// Index_type num_unique = 0;
+/// for (Index_type i = ibegin; i < iend; ++i) {
+///   if (i == ibegin || keys[i] != keys[i-1]) {
+///     keys_out[num_unique] = keys[i];
+///     sums[num_unique] = 0.0;
+///     ++num_unique;
+///   }
+///   sums[num_unique-1] += x[i];
+/// }
+///
+/// The lengths of the runs of keys follow the distribution given by the
+/// --segment-lengths command line option.
+///
+
+#ifndef RAJAPerf_Algorithm_REDUCE_BY_KEY_HPP
+#define RAJAPerf_Algorithm_REDUCE_BY_KEY_HPP
+
+#define REDUCE_BY_KEY_DATA_SETUP \
+  Int_ptr keys = m_keys; \
+  Real_ptr x = m_x; \
+  Int_ptr keys_out = m_keys_out; \
+  Real_ptr sums = m_sums;
+
+#define REDUCE_BY_KEY_IS_HEAD(i) \
+  ((i) == ibegin || keys[(i)] != keys[(i)-1])
+
+#define REDUCE_BY_KEY_BODY \
+  if (REDUCE_BY_KEY_IS_HEAD(i)) { \
+    keys_out[num_unique] = keys[i]; \
+    sums[num_unique] = 0.0; \
+    ++num_unique; \
+  } \
+  sums[num_unique-1] += x[i];
+
+#define REDUCE_BY_KEY_RUN_BODY \
+  Real_type sum = 0.0; \
+  for (Index_type i = run_begin[r]; i < run_begin[r+1]; ++i) { \
+    sum += x[i]; \
+  } \
+  sums[r] = sum;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class REDUCE_BY_KEY : public KernelBase
+{
+public:
+
+  REDUCE_BY_KEY(const RunParams& params);
+
+  ~REDUCE_BY_KEY();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  REDUCE_BY_KEY : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  REDUCE_BY_KEY : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  REDUCE_BY_KEY : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  Index_type m_mean_segment_length;
+  Index_type m_num_segments;
+  Index_type m_num_unique;
+
+  Int_ptr m_keys;
+  Real_ptr m_x;
+  Int_ptr m_keys_out;
+  Real_ptr m_sums;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -18,7 +18,7 @@ namespace algorithm
 {
 
 
-void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE_SUM::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -106,5 +106,89 @@ void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 #endif
 }
 
+void REDUCE_SUM::runOpenMPVariantRepro(VariantID vid, repro_reduce::Algorithm alg)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE_SUM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      auto reduce_sum_val = [=](Index_type i) -> Real_type {
+                              return x[i];
+                            };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        m_sum = m_sum_init + repro_reduce::sum(alg, ibegin, iend, reduce_sum_val);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE_SUM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(alg);
+#endif
+}
+
+void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if ( vid == Base_OpenMP ) {
+
+    for (int ialg = 0; ialg < repro_reduce::NumAlgorithms; ++ialg) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantRepro(vid, static_cast<repro_reduce::Algorithm>(ialg));
+
+      }
+
+      t += 1;
+
+    }
+
+  }
+}
+
+void REDUCE_SUM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+
+    for (int ialg = 0; ialg < repro_reduce::NumAlgorithms; ++ialg) {
+      addVariantTuningName(vid,
+          repro_reduce::getAlgorithmName(static_cast<repro_reduce::Algorithm>(ialg)));
+    }
+
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -33,6 +33,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "common/ReproducibleReduce.hpp"
 
 namespace rajaperf
 {
@@ -59,6 +60,10 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantRepro(VariantID vid, repro_reduce::Algorithm alg);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   void runCudaVariantCub(VariantID vid);
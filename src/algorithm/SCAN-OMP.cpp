@@ -18,7 +18,7 @@ namespace rajaperf
 namespace algorithm
 {
 
-void SCAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SCAN::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -185,5 +185,86 @@ void SCAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 #endif
 }
 
+void SCAN::runOpenMPVariantBase(VariantID vid, omp_scan::Algorithm alg)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SCAN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        SCAN_PROLOGUE;
+        omp_scan::scan<false>(alg, x + ibegin, y + ibegin, iend - ibegin, scan_var);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SCAN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(alg);
+#endif
+}
+
+void SCAN::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if ( vid == Base_OpenMP ) {
+
+    for (int ialg = 0; ialg < omp_scan::NumAlgorithms; ++ialg) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantBase(vid, static_cast<omp_scan::Algorithm>(ialg));
+
+      }
+
+      t += 1;
+
+    }
+
+  }
+}
+
+void SCAN::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+
+    for (int ialg = 0; ialg < omp_scan::NumAlgorithms; ++ialg) {
+      addVariantTuningName(vid,
+          omp_scan::getAlgorithmName(static_cast<omp_scan::Algorithm>(ialg)));
+    }
+
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
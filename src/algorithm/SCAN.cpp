@@ -63,7 +63,7 @@ SCAN::~SCAN()
 
 void SCAN::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  allocAndInitDataRandValue(m_x, getActualProblemSize(), vid);
+  allocAndInitDataSortInput(m_x, getActualProblemSize(), vid);
   allocAndInitDataConst(m_y, getActualProblemSize(), 0.0, vid);
 }
 
@@ -36,6 +36,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "OpenMPScan.hpp"
 
 namespace rajaperf
 {
@@ -62,6 +63,11 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
+
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantBase(VariantID vid, omp_scan::Algorithm alg);
+
 private:
   static const size_t default_gpu_block_size = 0;
 
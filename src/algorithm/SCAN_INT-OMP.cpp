@@ -0,0 +1,143 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SCAN_INT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void SCAN_INT::runOpenMPVariantDefault(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SCAN_INT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::exclusive_scan<RAJA::omp_parallel_for_exec>(RAJA_SCAN_INT_ARGS);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SCAN_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void SCAN_INT::runOpenMPVariantBase(VariantID vid, omp_scan::Algorithm alg)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SCAN_INT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        SCAN_INT_PROLOGUE;
+        omp_scan::scan<false>(alg, x + ibegin, y + ibegin, iend - ibegin, scan_var);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SCAN_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(alg);
+#endif
+}
+
+void SCAN_INT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( vid == Base_OpenMP ) {
+
+    for (int ialg = 0; ialg < omp_scan::NumAlgorithms; ++ialg) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantBase(vid, static_cast<omp_scan::Algorithm>(ialg));
+
+      }
+
+      t += 1;
+
+    }
+
+  } else {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantDefault(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void SCAN_INT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  if ( vid == Base_OpenMP ) {
+
+    for (int ialg = 0; ialg < omp_scan::NumAlgorithms; ++ialg) {
+      addVariantTuningName(vid,
+          omp_scan::getAlgorithmName(static_cast<omp_scan::Algorithm>(ialg)));
+    }
+
+  } else {
+
+    addVariantTuningName(vid, getDefaultTuningName());
+
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
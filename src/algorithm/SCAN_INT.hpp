@@ -0,0 +1,90 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SCAN_INT kernel reference implementation:
+///
+/// // exclusive scan of integer keys
+/// y[ibegin] = 0;
+/// for (Index_type i = ibegin+1; i < iend; ++i) {
+///   y[i] = y[i-1] + x[i-1];
+/// }
+///
+
+#ifndef RAJAPerf_Algorithm_SCAN_INT_HPP
+#define RAJAPerf_Algorithm_SCAN_INT_HPP
+
+#define SCAN_INT_DATA_SETUP \
+  Int_ptr x = m_x; \
+  Int_ptr y = m_y;
+
+#define SCAN_INT_PROLOGUE \
+  Int_type scan_var = 0;
+
+#define SCAN_INT_BODY \
+  y[i] = scan_var; \
+  scan_var += x[i];
+
+#define RAJA_SCAN_INT_ARGS \
+  RAJA::make_span(x + ibegin, iend - ibegin), \
+  RAJA::make_span(y + ibegin, iend - ibegin)
+
+
+#include "common/KernelBase.hpp"
+#include "OpenMPScan.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class SCAN_INT : public KernelBase
+{
+public:
+
+  SCAN_INT(const RunParams& params);
+
+  ~SCAN_INT();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantBase(VariantID vid, omp_scan::Algorithm alg);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SCAN_INT : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SCAN_INT : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SCAN_INT : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  Int_ptr m_x;
+  Int_ptr m_y;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
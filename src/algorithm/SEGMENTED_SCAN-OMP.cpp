@@ -0,0 +1,205 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SEGMENTED_SCAN.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void SEGMENTED_SCAN::runOpenMPVariantDefault(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  SEGMENTED_SCAN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type s = 0; s < num_segments; ++s ) {
+          SEGMENTED_SCAN_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, num_segments), [=](Index_type s) {
+          SEGMENTED_SCAN_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SEGMENTED_SCAN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+//
+// Each thread scans an equal share of the values regardless of segment
+// boundaries, then adds the sums carried in from preceding threads to the
+// values of the segment it started in the middle of.
+//
+void SEGMENTED_SCAN::runOpenMPVariantBalanced(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SEGMENTED_SCAN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const int max_threads = omp_get_max_threads();
+      std::vector<Real_type> tail_sums(max_threads);
+      std::vector<char> has_head(max_threads);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          const int nthreads = omp_get_num_threads();
+          const int tid = omp_get_thread_num();
+          const Index_type n = iend - ibegin;
+          const Index_type local_begin = ibegin + n * tid / nthreads;
+          const Index_type local_end = ibegin + n * (tid+1) / nthreads;
+
+          // first value in this thread's share that starts a segment
+          Index_type first_head = local_end;
+          Real_type scan_var = 0.0;
+
+          if (local_begin < local_end) {
+
+            // segment containing local_begin
+            Index_type s = std::upper_bound(offsets, offsets + num_segments + 1,
+                                            local_begin) - offsets - 1;
+            first_head = (offsets[s] == local_begin)
+                         ? local_begin
+                         : std::min(offsets[s+1], local_end);
+
+            Index_type next_head = offsets[s+1];
+            for (Index_type i = local_begin; i < local_end; ++i ) {
+              if (i == next_head) {
+                ++s;
+                next_head = offsets[s+1];
+                scan_var = 0.0;
+              }
+              y[i] = scan_var;
+              scan_var += x[i];
+            }
+          }
+          tail_sums[tid] = scan_var;
+          has_head[tid] = (first_head < local_end);
+
+          #pragma omp barrier
+
+          if (first_head != local_begin) {
+            Real_type carry = 0.0;
+            for (int t = tid-1; t >= 0; --t) {
+              carry += tail_sums[t];
+              if (has_head[t]) {
+                break;
+              }
+            }
+            for (Index_type i = local_begin; i < first_head; ++i ) {
+              y[i] += carry;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SEGMENTED_SCAN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void SEGMENTED_SCAN::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if ( vid == Base_OpenMP ) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantBalanced(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void SEGMENTED_SCAN::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    addVariantTuningName(vid, "balanced");
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
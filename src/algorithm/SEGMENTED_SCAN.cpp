@@ -0,0 +1,92 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SEGMENTED_SCAN.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+SEGMENTED_SCAN::SEGMENTED_SCAN(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_SEGMENTED_SCAN, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(100);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_mean_segment_length = 64;
+  m_num_segments = getSegmentOffsets(getActualProblemSize(),
+                                     m_mean_segment_length,
+                                     params.getSegmentLengths()).size() - 1;
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() +
+                  (0*sizeof(Index_type) + 1*sizeof(Index_type)) * (m_num_segments+1) );
+  setFLOPsPerRep(1 * getActualProblemSize());
+
+  checksum_scale_factor = 1e-2 *
+                 ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                              getActualProblemSize() ) /
+                 getActualProblemSize();
+
+  setUsesFeature(Forall);
+  setUsesFeature(Scan);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+SEGMENTED_SCAN::~SEGMENTED_SCAN()
+{
+}
+
+void SEGMENTED_SCAN::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  std::vector<Index_type> offsets =
+      getSegmentOffsets(getActualProblemSize(), m_mean_segment_length,
+                        run_params.getSegmentLengths());
+
+  allocData(m_offsets, m_num_segments+1, vid);
+  {
+    auto reset_offsets = scopedMoveData(m_offsets, m_num_segments+1, vid);
+    std::copy(offsets.begin(), offsets.end(), m_offsets);
+  }
+
+  allocAndInitDataRandValue(m_x, getActualProblemSize(), vid);
+  allocAndInitDataConst(m_y, getActualProblemSize(), 0.0, vid);
+}
+
+void SEGMENTED_SCAN::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_y, getActualProblemSize(), checksum_scale_factor, vid);
+}
+
+void SEGMENTED_SCAN::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_offsets, vid);
+  deallocData(m_x, vid);
+  deallocData(m_y, vid);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
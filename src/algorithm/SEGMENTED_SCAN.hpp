@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SEGMENTED_SCAN kernel reference implementation:
+///
+/// // exclusive scan of each segment [offsets[s], offsets[s+1])
+/// for (Index_type s = 0; s < num_segments; ++s) {
+///   Real_type scan_var = 0.0;
+///   for (Index_type i = offsets[s]; i < offsets[s+1]; ++i) {
+///     y[i] = scan_var;
+///     scan_var += x[i];
+///   }
+/// }
+///
+/// Segment lengths follow the distribution given by the --segment-lengths
+/// command line option.
+///
+
+#ifndef RAJAPerf_Algorithm_SEGMENTED_SCAN_HPP
+#define RAJAPerf_Algorithm_SEGMENTED_SCAN_HPP
+
+#define SEGMENTED_SCAN_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Index_ptr offsets = m_offsets; \
+  const Index_type num_segments = m_num_segments;
+
+#define SEGMENTED_SCAN_BODY \
+  Real_type scan_var = 0.0; \
+  for (Index_type i = offsets[s]; i < offsets[s+1]; ++i) { \
+    y[i] = scan_var; \
+    scan_var += x[i]; \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class SEGMENTED_SCAN : public KernelBase
+{
+public:
+
+  SEGMENTED_SCAN(const RunParams& params);
+
+  ~SEGMENTED_SCAN();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantBalanced(VariantID vid);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SEGMENTED_SCAN : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SEGMENTED_SCAN : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SEGMENTED_SCAN : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  Index_type m_mean_segment_length;
+  Index_type m_num_segments;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Index_ptr m_offsets;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -18,7 +18,7 @@ namespace algorithm
 {
 
 
-void SORT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORT::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -54,5 +54,96 @@ void SORT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 #endif
 }
 
+void SORT::runOpenMPVariantBase(VariantID vid, omp_sort::Algorithm alg)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      Real_ptr tmp;
+      allocData(tmp, iend - ibegin, vid);
+
+      auto key_of = [](Real_type const& val) { return val; };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        omp_sort::sort(alg, x + iend*irep + ibegin, tmp, iend - ibegin, key_of);
+
+      }
+      stopTimer();
+
+      deallocData(tmp, vid);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(alg);
+#endif
+}
+
+void SORT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( vid == Base_OpenMP ) {
+
+    for (int ialg = 0; ialg < omp_sort::NumAlgorithms; ++ialg) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantBase(vid, static_cast<omp_sort::Algorithm>(ialg));
+
+      }
+
+      t += 1;
+
+    }
+
+  } else {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantDefault(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void SORT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  if ( vid == Base_OpenMP ) {
+
+    for (int ialg = 0; ialg < omp_sort::NumAlgorithms; ++ialg) {
+      addVariantTuningName(vid,
+          omp_sort::getAlgorithmName(static_cast<omp_sort::Algorithm>(ialg)));
+    }
+
+  } else {
+
+    addVariantTuningName(vid, getDefaultTuningName());
+
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -36,6 +36,7 @@ SORT::SORT(const RunParams& params)
   setVariantDefined( Base_Seq );
   setVariantDefined( RAJA_Seq );
 
+  setVariantDefined( Base_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
   setVariantDefined( RAJA_CUDA );
@@ -49,7 +50,7 @@ SORT::~SORT()
 
 void SORT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  allocAndInitDataRandValue(m_x, getActualProblemSize()*getRunReps(), vid);
+  allocAndInitDataSortInput(m_x, getActualProblemSize()*getRunReps(), vid);
 }
 
 void SORT::updateChecksum(VariantID vid, size_t tune_idx)
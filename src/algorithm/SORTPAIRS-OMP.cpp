@@ -18,7 +18,7 @@ namespace algorithm
 {
 
 
-void SORTPAIRS::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORTPAIRS::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -54,5 +54,113 @@ void SORTPAIRS::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+void SORTPAIRS::runOpenMPVariantBase(VariantID vid, omp_sort::Algorithm alg)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORTPAIRS_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      using pair_type = std::pair<Real_type, Real_type>;
+
+      pair_type* pairs;
+      pair_type* tmp;
+      allocData(pairs, iend - ibegin, vid);
+      allocData(tmp, iend - ibegin, vid);
+
+      auto key_of = [](pair_type const& pair) { return pair.first; };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type iemp = ibegin; iemp < iend; ++iemp) {
+          pairs[iemp - ibegin] = pair_type(x[iend*irep + iemp], i[iend*irep + iemp]);
+        }
+
+        omp_sort::sort(alg, pairs, tmp, iend - ibegin, key_of);
+
+        #pragma omp parallel for
+        for (Index_type iemp = ibegin; iemp < iend; ++iemp) {
+          pair_type& pair = pairs[iemp - ibegin];
+          x[iend*irep + iemp] = pair.first;
+          i[iend*irep + iemp] = pair.second;
+        }
+
+      }
+      stopTimer();
+
+      deallocData(pairs, vid);
+      deallocData(tmp, vid);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORTPAIRS : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(alg);
+#endif
+}
+
+void SORTPAIRS::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( vid == Base_OpenMP ) {
+
+    for (int ialg = 0; ialg < omp_sort::NumAlgorithms; ++ialg) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantBase(vid, static_cast<omp_sort::Algorithm>(ialg));
+
+      }
+
+      t += 1;
+
+    }
+
+  } else {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantDefault(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void SORTPAIRS::setOpenMPTuningDefinitions(VariantID vid)
+{
+  if ( vid == Base_OpenMP ) {
+
+    for (int ialg = 0; ialg < omp_sort::NumAlgorithms; ++ialg) {
+      addVariantTuningName(vid,
+          omp_sort::getAlgorithmName(static_cast<omp_sort::Algorithm>(ialg)));
+    }
+
+  } else {
+
+    addVariantTuningName(vid, getDefaultTuningName());
+
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
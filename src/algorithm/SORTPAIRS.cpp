@@ -31,11 +31,15 @@ SORTPAIRS::SORTPAIRS(const RunParams& params)
   setBytesPerRep( (2*sizeof(Real_type) + 2*sizeof(Real_type)) * getActualProblemSize() ); // touched data size, not actual number of stores and loads
   setFLOPsPerRep(0);
 
+  m_unique_keys = params.getSortInput() != SortInput::FewUnique &&
+                  params.getSortInput() != SortInput::Zipf;
+
   setUsesFeature(Sort);
 
   setVariantDefined( Base_Seq );
   setVariantDefined( RAJA_Seq );
 
+  setVariantDefined( Base_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
   setVariantDefined( RAJA_CUDA );
@@ -49,14 +53,16 @@ SORTPAIRS::~SORTPAIRS()
 
 void SORTPAIRS::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  allocAndInitDataRandValue(m_x, getActualProblemSize()*getRunReps(), vid);
+  allocAndInitDataSortInput(m_x, getActualProblemSize()*getRunReps(), vid);
   allocAndInitDataRandValue(m_i, getActualProblemSize()*getRunReps(), vid);
 }
 
 void SORTPAIRS::updateChecksum(VariantID vid, size_t tune_idx)
 {
   checksum[vid][tune_idx] += calcChecksum(m_x, getActualProblemSize()*getRunReps(), vid);
-  checksum[vid][tune_idx] += calcChecksum(m_i, getActualProblemSize()*getRunReps(), vid);
+  if ( m_unique_keys ) {
+    checksum[vid][tune_idx] += calcChecksum(m_i, getActualProblemSize()*getRunReps(), vid);
+  }
 }
 
 void SORTPAIRS::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -11,6 +11,10 @@
 ///
 /// std::sort(x+ibegin, x+iend);
 ///
+/// The sorts are not stable, so with the fewunique and zipf sort inputs the
+/// order of the values of equal keys depends on the variant and tuning and
+/// only the keys are checksummed.
+///
 
 #ifndef RAJAPerf_Algorithm_SORTPAIRS_HPP
 #define RAJAPerf_Algorithm_SORTPAIRS_HPP
@@ -25,6 +29,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "OpenMPSort.hpp"
 
 namespace rajaperf
 {
@@ -47,6 +52,11 @@ public:
 
   void runSeqVariant(VariantID vid, size_t tune_idx);
   void runOpenMPVariant(VariantID vid, size_t tune_idx);
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantBase(VariantID vid, omp_sort::Algorithm alg);
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -59,6 +69,8 @@ private:
 
   Real_ptr m_x;
   Real_ptr m_i;
+
+  bool m_unique_keys;
 };
 
 } // end namespace algorithm
@@ -0,0 +1,176 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TOPK.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void TOPK::runOpenMPVariantDefault(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  TOPK_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case RAJA_OpenMP : {
+
+      Real_ptr keys;
+      Index_ptr idx;
+      allocData(keys, iend - ibegin, vid);
+      allocData(idx, iend - ibegin, vid);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type iemp) {
+          keys[iemp - ibegin] = x[iemp];
+          idx[iemp - ibegin] = iemp;
+        });
+
+        // stable, so equal keys stay in index order
+        RAJA::stable_sort_pairs<RAJA::omp_parallel_for_exec>(
+            RAJA::make_span(keys, iend - ibegin),
+            RAJA::make_span(idx, iend - ibegin),
+            RAJA::operators::greater<Real_type>{});
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, k), [=](Index_type j) {
+          TOPK_GATHER_BODY;
+        });
+
+      }
+      stopTimer();
+
+      deallocData(keys, vid);
+      deallocData(idx, vid);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TOPK : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void TOPK::runOpenMPVariantBase(VariantID vid, omp_select::Algorithm alg)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  TOPK_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      Index_ptr idx;
+      allocData(idx, k, vid);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        omp_select::top_k(alg, x + ibegin, iend - ibegin, k, idx);
+
+        #pragma omp parallel for
+        for (Index_type j = 0; j < k; ++j) {
+          idx[j] += ibegin;
+          TOPK_GATHER_BODY;
+        }
+
+      }
+      stopTimer();
+
+      deallocData(idx, vid);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TOPK : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(alg);
+#endif
+}
+
+void TOPK::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( vid == Base_OpenMP ) {
+
+    for (int ialg = 0; ialg < omp_select::NumAlgorithms; ++ialg) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantBase(vid, static_cast<omp_select::Algorithm>(ialg));
+
+      }
+
+      t += 1;
+
+    }
+
+  } else {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantDefault(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void TOPK::setOpenMPTuningDefinitions(VariantID vid)
+{
+  if ( vid == Base_OpenMP ) {
+
+    for (int ialg = 0; ialg < omp_select::NumAlgorithms; ++ialg) {
+      addVariantTuningName(vid,
+          omp_select::getAlgorithmName(static_cast<omp_select::Algorithm>(ialg)));
+    }
+
+  } else {
+
+    addVariantTuningName(vid, getDefaultTuningName());
+
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
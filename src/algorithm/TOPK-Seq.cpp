@@ -0,0 +1,188 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TOPK.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void TOPK::runSeqVariantBase(VariantID vid, bool use_nth_element)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  TOPK_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      // key and index; sorting these keeps the keys next to each other
+      using pair_type = std::pair<Real_type, Index_type>;
+
+      pair_type* pairs;
+      allocData(pairs, iend - ibegin, vid);
+
+      auto comp = [](pair_type const& lhs, pair_type const& rhs) {
+        return lhs.first > rhs.first ||
+               (lhs.first == rhs.first && lhs.second < rhs.second);
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type iemp = ibegin; iemp < iend; ++iemp) {
+          pairs[iemp - ibegin] = pair_type(x[iemp], iemp);
+        }
+
+        if (use_nth_element) {
+          std::nth_element(pairs, pairs + (k-1), pairs + (iend-ibegin), comp);
+          std::sort(pairs, pairs + k, comp);
+        } else {
+          std::partial_sort(pairs, pairs + k, pairs + (iend-ibegin), comp);
+        }
+
+        for (Index_type j = 0; j < k; ++j) {
+          topk_x[j] = pairs[j].first;
+          topk_i[j] = i[pairs[j].second];
+        }
+
+      }
+      stopTimer();
+
+      deallocData(pairs, vid);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TOPK : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void TOPK::runSeqVariantDefault(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  TOPK_DATA_SETUP;
+
+  switch ( vid ) {
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      Real_ptr keys;
+      Index_ptr idx;
+      allocData(keys, iend - ibegin, vid);
+      allocData(idx, iend - ibegin, vid);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type iemp) {
+          keys[iemp - ibegin] = x[iemp];
+          idx[iemp - ibegin] = iemp;
+        });
+
+        // stable, so equal keys stay in index order
+        RAJA::stable_sort_pairs<RAJA::loop_exec>(
+            RAJA::make_span(keys, iend - ibegin),
+            RAJA::make_span(idx, iend - ibegin),
+            RAJA::operators::greater<Real_type>{});
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, k), [=](Index_type j) {
+          TOPK_GATHER_BODY;
+        });
+
+      }
+      stopTimer();
+
+      deallocData(keys, vid);
+      deallocData(idx, vid);
+
+      break;
+    }
+#endif
+
+    default : {
+      ignore_unused(run_reps, ibegin, iend, x, i, topk_x, topk_i, k);
+      getCout() << "\n  TOPK : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void TOPK::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( vid == Base_Seq ) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantBase(vid, false);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runSeqVariantBase(vid, true);
+
+    }
+
+    t += 1;
+
+  } else {
+
+    if (tune_idx == t) {
+
+      runSeqVariantDefault(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void TOPK::setSeqTuningDefinitions(VariantID vid)
+{
+  if ( vid == Base_Seq ) {
+
+    addVariantTuningName(vid, "partial_sort");
+    addVariantTuningName(vid, "nth_element");
+
+  } else {
+
+    addVariantTuningName(vid, getDefaultTuningName());
+
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
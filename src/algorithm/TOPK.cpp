@@ -0,0 +1,78 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TOPK.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+TOPK::TOPK(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_TOPK, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(20);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_k = std::max(Index_type(1),
+                 static_cast<Index_type>(getActualProblemSize() * params.getKFraction()));
+  m_k = std::min(m_k, getActualProblemSize());
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() +
+                  (2*sizeof(Real_type) + 1*sizeof(Real_type)) * m_k ); // touched data size, not actual number of stores and loads
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Sort);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+TOPK::~TOPK()
+{
+}
+
+void TOPK::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitDataSortInput(m_x, getActualProblemSize(), vid);
+  allocAndInitDataRandValue(m_i, getActualProblemSize(), vid);
+  allocAndInitDataConst(m_topk_x, m_k, 0.0, vid);
+  allocAndInitDataConst(m_topk_i, m_k, 0.0, vid);
+}
+
+void TOPK::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_topk_x, m_k, vid);
+  checksum[vid][tune_idx] += calcChecksum(m_topk_i, m_k, vid);
+}
+
+void TOPK::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_x, vid);
+  deallocData(m_i, vid);
+  deallocData(m_topk_x, vid);
+  deallocData(m_topk_i, vid);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,102 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// TOPK kernel reference implementation:
+///
+/// // indices of the k largest keys, by decreasing key then increasing index
+/// std::iota(idx, idx+(iend-ibegin), ibegin);
+/// std::partial_sort(idx, idx+k, idx+(iend-ibegin),
+///     [=](Index_type a, Index_type b) {
+///       return x[a] > x[b] || (x[a] == x[b] && a < b);
+///     });
+///
+/// for (Index_type j = 0; j < k; ++j) {
+///   topk_x[j] = x[idx[j]];
+///   topk_i[j] = i[idx[j]];
+/// }
+///
+/// The keys x carry values i as in SORTPAIRS. k is the problem size times
+/// the --k-fraction command line option.
+///
+
+#ifndef RAJAPerf_Algorithm_TOPK_HPP
+#define RAJAPerf_Algorithm_TOPK_HPP
+
+#define TOPK_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr i = m_i; \
+  Real_ptr topk_x = m_topk_x; \
+  Real_ptr topk_i = m_topk_i; \
+  const Index_type k = m_k;
+
+#define TOPK_GATHER_BODY \
+  topk_x[j] = x[idx[j]]; \
+  topk_i[j] = i[idx[j]];
+
+
+#include "common/KernelBase.hpp"
+#include "OpenMPSelect.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class TOPK : public KernelBase
+{
+public:
+
+  TOPK(const RunParams& params);
+
+  ~TOPK();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  TOPK : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  TOPK : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  TOPK : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantBase(VariantID vid, bool use_nth_element);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantBase(VariantID vid, omp_select::Algorithm alg);
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  Index_type m_k;
+
+  Real_ptr m_x;
+  Real_ptr m_i;
+  Real_ptr m_topk_x;
+  Real_ptr m_topk_i;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -25,30 +25,31 @@ CONVECTION3DPA::CONVECTION3DPA(const RunParams& params)
 {
   m_NE_default = 15625;
 
-  setDefaultProblemSize(m_NE_default*CPA_Q1D*CPA_Q1D*CPA_Q1D);
+  constexpr Index_type Q1D = fem_order::q1d(default_order);
+
+  setDefaultProblemSize(m_NE_default*Q1D*Q1D*Q1D);
   setDefaultReps(50);
 
-  m_NE = std::max(getTargetProblemSize()/(CPA_Q1D*CPA_Q1D*CPA_Q1D), Index_type(1));
+  m_NE = getOrderNumElements(default_order);
 
-  setActualProblemSize( m_NE*CPA_Q1D*CPA_Q1D*CPA_Q1D );
+  setActualProblemSize( m_NE*Q1D*Q1D*Q1D );
 
   setItsPerRep(getActualProblemSize());
   setKernelsPerRep(1);
 
-  setBytesPerRep( 3*CPA_Q1D*CPA_D1D*sizeof(Real_type)  +
-                  CPA_VDIM*CPA_Q1D*CPA_Q1D*CPA_Q1D*m_NE*sizeof(Real_type) +
-                  CPA_D1D*CPA_D1D*CPA_D1D*m_NE*sizeof(Real_type) +
-                  CPA_D1D*CPA_D1D*CPA_D1D*m_NE*sizeof(Real_type) );
-
-  setFLOPsPerRep(m_NE * (
-                         4 * CPA_D1D * CPA_Q1D * CPA_D1D * CPA_D1D + //2
-                         6 * CPA_D1D * CPA_Q1D * CPA_Q1D * CPA_D1D + //3
-                         6 * CPA_D1D * CPA_Q1D * CPA_Q1D * CPA_Q1D + //4
-                         5 * CPA_Q1D * CPA_Q1D * CPA_Q1D +  // 5
-                         2 * CPA_Q1D * CPA_D1D * CPA_Q1D * CPA_Q1D + // 6
-                         2 * CPA_Q1D * CPA_D1D * CPA_Q1D * CPA_D1D + // 7
-                         (1 + 2*CPA_Q1D) * CPA_D1D * CPA_D1D * CPA_D1D // 8
-                         ));
+  setBytesPerRep( getOrderBytesPerRep(default_order) );
+  setFLOPsPerRep( getOrderFLOPsPerRep(default_order) );
+
+  seq_for(orders_type{}, [&](auto order) {
+    const Index_type q1d = fem_order::q1d(order);
+    const Index_type order_size = getOrderNumElements(order)*q1d*q1d*q1d;
+    setTuningProblemSize(fem_order::getTuningName(order), order_size);
+    setTuningItsPerRep(fem_order::getTuningName(order), order_size);
+    setTuningBytesPerRep(fem_order::getTuningName(order),
+                         getOrderBytesPerRep(order));
+    setTuningFLOPsPerRep(fem_order::getTuningName(order),
+                         getOrderFLOPsPerRep(order));
+  });
 
   setUsesFeature(Launch);
 
@@ -70,20 +71,63 @@ CONVECTION3DPA::~CONVECTION3DPA()
 {
 }
 
-void CONVECTION3DPA::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+// number of elements of the given order with about the target number of
+// quadrature points
+Index_type CONVECTION3DPA::getOrderNumElements(size_t order) const
+{
+  const Index_type Q1D = fem_order::q1d(order);
+  return std::max(getTargetProblemSize()/(Q1D*Q1D*Q1D), Index_type(1));
+}
+
+Index_type CONVECTION3DPA::getOrderBytesPerRep(size_t order) const
 {
+  const Index_type D1D = fem_order::d1d(order);
+  const Index_type Q1D = fem_order::q1d(order);
+  const Index_type NE = getOrderNumElements(order);
+
+  return 3*Q1D*D1D*sizeof(Real_type)  +
+         CPA_VDIM*Q1D*Q1D*Q1D*NE*sizeof(Real_type) +
+         D1D*D1D*D1D*NE*sizeof(Real_type) +
+         D1D*D1D*D1D*NE*sizeof(Real_type);
+}
 
-  allocAndInitDataConst(m_B,  int(CPA_Q1D*CPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_Bt, int(CPA_Q1D*CPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_G, int(CPA_Q1D*CPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_D, int(CPA_Q1D*CPA_Q1D*CPA_Q1D*CPA_VDIM*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_X, int(CPA_D1D*CPA_D1D*CPA_D1D*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_Y, int(CPA_D1D*CPA_D1D*CPA_D1D*m_NE), Real_type(0.0), vid);
+Index_type CONVECTION3DPA::getOrderFLOPsPerRep(size_t order) const
+{
+  const Index_type D1D = fem_order::d1d(order);
+  const Index_type Q1D = fem_order::q1d(order);
+  const Index_type NE = getOrderNumElements(order);
+
+  return NE * (
+           4 * D1D * Q1D * D1D * D1D + //2
+           6 * D1D * Q1D * Q1D * D1D + //3
+           6 * D1D * Q1D * Q1D * Q1D + //4
+           5 * Q1D * Q1D * Q1D +  // 5
+           2 * Q1D * D1D * Q1D * Q1D + // 6
+           2 * Q1D * D1D * Q1D * D1D + // 7
+           (1 + 2*Q1D) * D1D * D1D * D1D // 8
+           );
+}
+
+void CONVECTION3DPA::setUp(VariantID vid, size_t tune_idx)
+{
+  const size_t order =
+      fem_order::getOrder(orders_type{}, getVariantTuningProblemName(vid, tune_idx),
+                          default_order);
+  m_D1D = fem_order::d1d(order);
+  m_Q1D = fem_order::q1d(order);
+  m_NE = getOrderNumElements(order);
+
+  allocAndInitDataConst(m_B,  int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_Bt, int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_G, int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_D, int(m_Q1D*m_Q1D*m_Q1D*CPA_VDIM*m_NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_X, int(m_D1D*m_D1D*m_D1D*m_NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_Y, int(m_D1D*m_D1D*m_D1D*m_NE), Real_type(0.0), vid);
 }
 
 void CONVECTION3DPA::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_Y, CPA_D1D*CPA_D1D*CPA_D1D*m_NE, vid);
+  checksum[vid][tune_idx] += calcChecksum(m_Y, m_D1D*m_D1D*m_D1D*m_NE, vid);
 }
 
 void CONVECTION3DPA::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -55,6 +55,7 @@ void DEL_DOT_VEC_2D::runHipVariantImpl(VariantID vid)
   const Index_type iend = m_domain->n_real_zones;
 
   DEL_DOT_VEC_2D_DATA_SETUP;
+  DEL_DOT_VEC_2D_ZONES_DATA_SETUP;
 
   if ( vid == Base_HIP ) {
 
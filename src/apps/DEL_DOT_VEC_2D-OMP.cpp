@@ -14,6 +14,7 @@
 
 #include "camp/resource.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf
@@ -22,7 +23,7 @@ namespace apps
 {
 
 
-void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DEL_DOT_VEC_2D::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -31,6 +32,7 @@ void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
   const Index_type iend = m_domain->n_real_zones;
 
   DEL_DOT_VEC_2D_DATA_SETUP;
+  DEL_DOT_VEC_2D_ZONES_DATA_SETUP;
 
   switch ( vid ) {
 
@@ -104,5 +106,342 @@ void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 #endif
 }
 
+void DEL_DOT_VEC_2D::runOpenMPVariantLoopNest(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  DEL_DOT_VEC_2D_DATA_SETUP;
+  DEL_DOT_VEC_2D_NEST_DATA_SETUP;
+
+  auto deldotvec2d_nest_lam = [=](Index_type ii, Index_type jj) {
+                                DEL_DOT_VEC_2D_BODY_NEST_INDEX;
+                                DEL_DOT_VEC_2D_BODY;
+                              };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type jj = jmin ; jj < jmax ; ++jj ) {
+          for (Index_type ii = imin ; ii < imax ; ++ii ) {
+            DEL_DOT_VEC_2D_BODY_NEST_INDEX;
+            DEL_DOT_VEC_2D_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type jj = jmin ; jj < jmax ; ++jj ) {
+          for (Index_type ii = imin ; ii < imax ; ++ii ) {
+            deldotvec2d_nest_lam(ii, jj);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<1, RAJA::omp_parallel_for_exec,
+            RAJA::statement::For<0, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(imin, imax),
+                                                 RAJA::RangeSegment(jmin, jmax)),
+                                deldotvec2d_nest_lam );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DEL_DOT_VEC_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void DEL_DOT_VEC_2D::runOpenMPVariantTiled(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  DEL_DOT_VEC_2D_DATA_SETUP;
+  DEL_DOT_VEC_2D_NEST_DATA_SETUP;
+
+  const Index_type tile_i = s_tile_i;
+  const Index_type tile_j = s_tile_j;
+
+  auto deldotvec2d_nest_lam = [=](Index_type ii, Index_type jj) {
+                                DEL_DOT_VEC_2D_BODY_NEST_INDEX;
+                                DEL_DOT_VEC_2D_BODY;
+                              };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type jt = jmin ; jt < jmax ; jt += tile_j ) {
+          for (Index_type it = imin ; it < imax ; it += tile_i ) {
+            const Index_type jend = std::min(jt + tile_j, jmax);
+            const Index_type iend = std::min(it + tile_i, imax);
+
+            for (Index_type jj = jt ; jj < jend ; ++jj ) {
+              for (Index_type ii = it ; ii < iend ; ++ii ) {
+                DEL_DOT_VEC_2D_BODY_NEST_INDEX;
+                DEL_DOT_VEC_2D_BODY;
+              }
+            }
+
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type jt = jmin ; jt < jmax ; jt += tile_j ) {
+          for (Index_type it = imin ; it < imax ; it += tile_i ) {
+            const Index_type jend = std::min(jt + tile_j, jmax);
+            const Index_type iend = std::min(it + tile_i, imax);
+
+            for (Index_type jj = jt ; jj < jend ; ++jj ) {
+              for (Index_type ii = it ; ii < iend ; ++ii ) {
+                deldotvec2d_nest_lam(ii, jj);
+              }
+            }
+
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::Tile<1, RAJA::tile_fixed<s_tile_j>, RAJA::omp_parallel_for_exec,
+            RAJA::statement::Tile<0, RAJA::tile_fixed<s_tile_i>, RAJA::loop_exec,
+              RAJA::statement::For<1, RAJA::loop_exec,
+                RAJA::statement::For<0, RAJA::loop_exec,
+                  RAJA::statement::Lambda<0>
+                >
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(imin, imax),
+                                                 RAJA::RangeSegment(jmin, jmax)),
+                                deldotvec2d_nest_lam );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DEL_DOT_VEC_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void DEL_DOT_VEC_2D::runOpenMPVariantLayout(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+
+  DEL_DOT_VEC_2D_LAYOUT_DATA_SETUP;
+  DEL_DOT_VEC_2D_ZONES_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          DEL_DOT_VEC_2D_BODY_INDEX;
+          DEL_DOT_VEC_2D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto deldotvec2d_base_lam = [=](Index_type ii) {
+                                DEL_DOT_VEC_2D_BODY_INDEX;
+                                DEL_DOT_VEC_2D_BODY;
+                              };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          deldotvec2d_base_lam(ii);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      camp::resources::Resource working_res{camp::resources::Host::get_default()};
+      RAJA::TypedListSegment<Index_type> zones(real_zones, iend,
+                                               working_res, RAJA::Unowned);
+
+      auto deldotvec2d_lam = [=](Index_type i) {
+                               DEL_DOT_VEC_2D_BODY;
+                             };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(zones, deldotvec2d_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DEL_DOT_VEC_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantLoopNest(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantTiled(vid);
+
+  }
+
+  t += 1;
+
+  for (int l = 0; l < data_layout::NumLayouts; ++l) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantLayout(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void DEL_DOT_VEC_2D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, "loop_nest", getDefaultTuningName());
+  addVariantTuningName(vid, "tiled", getDefaultTuningName());
+
+  for (int l = 0; l < data_layout::NumLayouts; ++l) {
+    addVariantTuningName(vid,
+        data_layout::getLayoutName(static_cast<data_layout::Layout>(l)),
+        getDefaultTuningName());
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -38,6 +38,7 @@ void DEL_DOT_VEC_2D::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSE
   const Index_type iend = m_domain->n_real_zones;
 
   DEL_DOT_VEC_2D_DATA_SETUP;
+  DEL_DOT_VEC_2D_ZONES_DATA_SETUP;
 
   if ( vid == Base_OpenMPTarget ) {
 
@@ -14,6 +14,7 @@
 
 #include "camp/resource.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf
@@ -22,13 +23,14 @@ namespace apps
 {
 
 
-void DEL_DOT_VEC_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DEL_DOT_VEC_2D::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
 
   DEL_DOT_VEC_2D_DATA_SETUP;
+  DEL_DOT_VEC_2D_ZONES_DATA_SETUP;
 
   switch ( vid ) {
 
@@ -99,5 +101,331 @@ void DEL_DOT_VEC_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
 }
 
+void DEL_DOT_VEC_2D::runSeqVariantLoopNest(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  DEL_DOT_VEC_2D_DATA_SETUP;
+  DEL_DOT_VEC_2D_NEST_DATA_SETUP;
+
+#if defined(RUN_RAJA_SEQ)
+  auto deldotvec2d_nest_lam = [=](Index_type ii, Index_type jj) {
+                                DEL_DOT_VEC_2D_BODY_NEST_INDEX;
+                                DEL_DOT_VEC_2D_BODY;
+                              };
+#endif
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type jj = jmin ; jj < jmax ; ++jj ) {
+          for (Index_type ii = imin ; ii < imax ; ++ii ) {
+            DEL_DOT_VEC_2D_BODY_NEST_INDEX;
+            DEL_DOT_VEC_2D_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type jj = jmin ; jj < jmax ; ++jj ) {
+          for (Index_type ii = imin ; ii < imax ; ++ii ) {
+            deldotvec2d_nest_lam(ii, jj);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<1, RAJA::loop_exec,
+            RAJA::statement::For<0, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(imin, imax),
+                                                 RAJA::RangeSegment(jmin, jmax)),
+                                deldotvec2d_nest_lam );
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  DEL_DOT_VEC_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void DEL_DOT_VEC_2D::runSeqVariantTiled(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  DEL_DOT_VEC_2D_DATA_SETUP;
+  DEL_DOT_VEC_2D_NEST_DATA_SETUP;
+
+  const Index_type tile_i = s_tile_i;
+  const Index_type tile_j = s_tile_j;
+
+#if defined(RUN_RAJA_SEQ)
+  auto deldotvec2d_nest_lam = [=](Index_type ii, Index_type jj) {
+                                DEL_DOT_VEC_2D_BODY_NEST_INDEX;
+                                DEL_DOT_VEC_2D_BODY;
+                              };
+#endif
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type jt = jmin ; jt < jmax ; jt += tile_j ) {
+          for (Index_type it = imin ; it < imax ; it += tile_i ) {
+            const Index_type jend = std::min(jt + tile_j, jmax);
+            const Index_type iend = std::min(it + tile_i, imax);
+
+            for (Index_type jj = jt ; jj < jend ; ++jj ) {
+              for (Index_type ii = it ; ii < iend ; ++ii ) {
+                DEL_DOT_VEC_2D_BODY_NEST_INDEX;
+                DEL_DOT_VEC_2D_BODY;
+              }
+            }
+
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type jt = jmin ; jt < jmax ; jt += tile_j ) {
+          for (Index_type it = imin ; it < imax ; it += tile_i ) {
+            const Index_type jend = std::min(jt + tile_j, jmax);
+            const Index_type iend = std::min(it + tile_i, imax);
+
+            for (Index_type jj = jt ; jj < jend ; ++jj ) {
+              for (Index_type ii = it ; ii < iend ; ++ii ) {
+                deldotvec2d_nest_lam(ii, jj);
+              }
+            }
+
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::Tile<1, RAJA::tile_fixed<s_tile_j>, RAJA::loop_exec,
+            RAJA::statement::Tile<0, RAJA::tile_fixed<s_tile_i>, RAJA::loop_exec,
+              RAJA::statement::For<1, RAJA::loop_exec,
+                RAJA::statement::For<0, RAJA::loop_exec,
+                  RAJA::statement::Lambda<0>
+                >
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(imin, imax),
+                                                 RAJA::RangeSegment(jmin, jmax)),
+                                deldotvec2d_nest_lam );
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  DEL_DOT_VEC_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void DEL_DOT_VEC_2D::runSeqVariantLayout(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+
+  DEL_DOT_VEC_2D_LAYOUT_DATA_SETUP;
+  DEL_DOT_VEC_2D_ZONES_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          DEL_DOT_VEC_2D_BODY_INDEX;
+          DEL_DOT_VEC_2D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto deldotvec2d_base_lam = [=](Index_type ii) {
+                                    DEL_DOT_VEC_2D_BODY_INDEX;
+                                    DEL_DOT_VEC_2D_BODY;
+                                  };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          deldotvec2d_base_lam(ii);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      camp::resources::Resource working_res{camp::resources::Host::get_default()};
+      RAJA::TypedListSegment<Index_type> zones(real_zones, iend,
+                                               working_res, RAJA::Unowned);
+
+      auto deldotvec2d_lam = [=](Index_type i) {
+                               DEL_DOT_VEC_2D_BODY;
+                             };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(zones, deldotvec2d_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  DEL_DOT_VEC_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void DEL_DOT_VEC_2D::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantLoopNest(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantTiled(vid);
+
+  }
+
+  t += 1;
+
+  for (int l = 0; l < data_layout::NumLayouts; ++l) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantLayout(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void DEL_DOT_VEC_2D::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, "loop_nest", getDefaultTuningName());
+  addVariantTuningName(vid, "tiled", getDefaultTuningName());
+
+  for (int l = 0; l < data_layout::NumLayouts; ++l) {
+    addVariantTuningName(vid,
+        data_layout::getLayoutName(static_cast<data_layout::Layout>(l)),
+        getDefaultTuningName());
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -42,6 +42,13 @@ DEL_DOT_VEC_2D::DEL_DOT_VEC_2D(const RunParams& params)
                   (0*sizeof(Real_type)  + 4*sizeof(Real_type) ) * m_domain->n_real_nodes ) ; // touched data size, not actual number of stores and loads
   setFLOPsPerRep(54 * m_domain->n_real_zones);
 
+  // the loop nest tunings compute the zone index instead of reading it
+  const Index_type nest_bytes =
+                  (1*sizeof(Real_type)  + 0*sizeof(Real_type) ) * getItsPerRep() +
+                  (0*sizeof(Real_type)  + 4*sizeof(Real_type) ) * m_domain->n_real_nodes ;
+  setTuningBytesPerRep("loop_nest", nest_bytes);
+  setTuningBytesPerRep("tiled", nest_bytes);
+
   setUsesFeature(Forall);
 
   setVariantDefined( Base_Seq );
@@ -69,7 +76,7 @@ DEL_DOT_VEC_2D::~DEL_DOT_VEC_2D()
   delete m_domain;
 }
 
-void DEL_DOT_VEC_2D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DEL_DOT_VEC_2D::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_x, m_array_length, 0.0, vid);
   allocAndInitDataConst(m_y, m_array_length, 0.0, vid);
@@ -92,6 +99,26 @@ void DEL_DOT_VEC_2D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
   allocAndInitDataConst(m_div, m_array_length, 0.0, vid);
 
+  if ( usesLayout(vid, tune_idx) ) {
+    m_layout = data_layout::getLayout(getVariantTuningName(vid, tune_idx));
+
+    const Index_type layout_len = data_layout::getDataLength(4, m_array_length);
+    allocAndInitDataConst(m_layout_data, layout_len, 0.0, vid);
+
+    auto reset_layout = scopedMoveData(m_layout_data, layout_len, vid);
+    auto reset_x = scopedMoveData(m_x, m_array_length, vid);
+    auto reset_y = scopedMoveData(m_y, m_array_length, vid);
+    auto reset_xdot = scopedMoveData(m_xdot, m_array_length, vid);
+    auto reset_ydot = scopedMoveData(m_ydot, m_array_length, vid);
+
+    data_layout::FieldView fields =
+        data_layout::makeView(m_layout_data, m_layout, 4, m_array_length);
+    data_layout::setField(fields, 0, m_x, m_array_length);
+    data_layout::setField(fields, 1, m_y, m_array_length);
+    data_layout::setField(fields, 2, m_xdot, m_array_length);
+    data_layout::setField(fields, 3, m_ydot, m_array_length);
+  }
+
   m_ptiny = 1.0e-20;
   m_half = 0.5;
 }
@@ -101,7 +128,7 @@ void DEL_DOT_VEC_2D::updateChecksum(VariantID vid, size_t tune_idx)
   checksum[vid][tune_idx] += calcChecksum(m_div, m_array_length, vid);
 }
 
-void DEL_DOT_VEC_2D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DEL_DOT_VEC_2D::tearDown(VariantID vid, size_t tune_idx)
 {
   (void) vid;
 
@@ -111,6 +138,9 @@ void DEL_DOT_VEC_2D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
   deallocData(m_xdot, vid);
   deallocData(m_ydot, vid);
   deallocData(m_div, vid);
+  if ( usesLayout(vid, tune_idx) ) {
+    deallocData(m_layout_data, vid);
+  }
 }
 
 } // end namespace apps
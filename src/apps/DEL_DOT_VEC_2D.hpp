@@ -36,6 +36,15 @@
 ///   div[i] = dfxdx + dfydy + affine ;
 /// }
 ///
+/// The "loop_nest" tuning computes the zone index from a j, i loop nest
+/// instead of reading it from the real_zones list, and the "tiled" tuning
+/// runs the loop nest in tiles of s_tile_j x s_tile_i zones so the nodes
+/// shared with the next row of zones are still in cache when they are
+/// loaded again.
+///
+/// The "soa", "aos", and "aosoa" tunings store the x, y, xdot, and ydot
+/// nodal fields in one of the layouts in DataLayout.hpp.
+///
 
 #ifndef RAJAPerf_Apps_DEL_DOT_VEC_2D_HPP
 #define RAJAPerf_Apps_DEL_DOT_VEC_2D_HPP
@@ -58,13 +67,38 @@
   NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ; \
   NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ; \
   NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ; \
-  NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ; \
+  NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+#define DEL_DOT_VEC_2D_LAYOUT_DATA_SETUP \
+  data_layout::FieldView fields = \
+      data_layout::makeView(m_layout_data, m_layout, 4, m_array_length); \
+  Real_ptr div = m_div; \
+\
+  const Real_type ptiny = m_ptiny; \
+  const Real_type half = m_half; \
 \
+  NDFIELDSET2D(m_domain->jp, fields, 0, x1,x2,x3,x4) ; \
+  NDFIELDSET2D(m_domain->jp, fields, 1, y1,y2,y3,y4) ; \
+  NDFIELDSET2D(m_domain->jp, fields, 2, fx1,fx2,fx3,fx4) ; \
+  NDFIELDSET2D(m_domain->jp, fields, 3, fy1,fy2,fy3,fy4) ;
+
+#define DEL_DOT_VEC_2D_ZONES_DATA_SETUP \
   Index_ptr real_zones = m_real_zones;
 
+#define DEL_DOT_VEC_2D_NEST_DATA_SETUP \
+  const Index_type imin = m_domain->imin; \
+  const Index_type imax = m_domain->imax; \
+  const Index_type jmin = m_domain->jmin; \
+  const Index_type jmax = m_domain->jmax; \
+\
+  const Index_type jp = m_domain->jp;
+
 #define DEL_DOT_VEC_2D_BODY_INDEX \
   Index_type i = real_zones[ii];
 
+#define DEL_DOT_VEC_2D_BODY_NEST_INDEX \
+  Index_type i = ii + jj * jp;
+
 #define DEL_DOT_VEC_2D_BODY \
 \
   Real_type xi  = half * ( x1[i]  + x2[i]  - x3[i]  - x4[i]  ) ; \
@@ -92,6 +126,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "DataLayout.hpp"
 
 namespace rajaperf
 {
@@ -119,8 +154,18 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantLoopNest(VariantID vid);
+  void runSeqVariantTiled(VariantID vid);
+  void runSeqVariantLayout(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantLoopNest(VariantID vid);
+  void runOpenMPVariantTiled(VariantID vid);
+  void runOpenMPVariantLayout(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -130,6 +175,16 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  // zones in i and rows of zones in j in a tile
+  static const Index_type s_tile_i = 256;
+  static const Index_type s_tile_j = 16;
+
+  bool usesLayout(VariantID vid, size_t tune_idx) const
+  {
+    return data_layout::getLayout(getVariantTuningName(vid, tune_idx)) !=
+           data_layout::NumLayouts;
+  }
+
   Real_ptr m_x;
   Real_ptr m_y;
   Real_ptr m_xdot;
@@ -142,6 +197,9 @@ private:
   ADomain* m_domain;
   Index_type* m_real_zones;
   Index_type m_array_length;
+
+  data_layout::Layout m_layout;
+  Real_ptr m_layout_data;
 };
 
 } // end namespace apps
@@ -0,0 +1,206 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+// Uncomment to add compiler directives for loop unrolling
+//#define USE_RAJAPERF_UNROLL
+
+#include "DIFFUSION2DPA.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf {
+namespace apps {
+
+
+template < int D1D, int Q1D >
+void DIFFUSION2DPA::runSeqVariantImpl(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+
+  DIFFUSION2DPA_DATA_SETUP;
+
+  switch (vid) {
+
+  case Base_Seq: {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (int e = 0; e < NE; ++e) {
+
+        DIFFUSION2DPA_0_CPU
+
+        CPU_FOREACH(dy, y, D1D) {
+          CPU_FOREACH(dx, x, D1D) {
+            DIFFUSION2DPA_1
+          }
+          CPU_FOREACH(qx, x, Q1D) {
+            DIFFUSION2DPA_2
+          }
+        }
+
+        CPU_FOREACH(dy, y, D1D) {
+          CPU_FOREACH(qx, x, Q1D) {
+            DIFFUSION2DPA_3
+          }
+        }
+
+        CPU_FOREACH(qy, y, Q1D) {
+          CPU_FOREACH(qx, x, Q1D) {
+            DIFFUSION2DPA_4
+          }
+        }
+
+        CPU_FOREACH(dy, y, D1D) {
+          CPU_FOREACH(qx, x, Q1D) {
+            DIFFUSION2DPA_5
+          }
+        }
+
+        CPU_FOREACH(qy, y, Q1D) {
+          CPU_FOREACH(dx, x, D1D) {
+            DIFFUSION2DPA_6
+          }
+        }
+
+        CPU_FOREACH(dy, y, D1D) {
+          CPU_FOREACH(dx, x, D1D) {
+            DIFFUSION2DPA_7
+          }
+        }
+
+      } // element loop
+    }
+    stopTimer();
+
+    break;
+  }
+
+#if defined(RUN_RAJA_SEQ)
+  case RAJA_Seq: {
+
+    //Currently Teams requires two policies if compiled with a device
+    using launch_policy = RAJA::LaunchPolicy<RAJA::seq_launch_t>;
+
+    using outer_x = RAJA::LoopPolicy<RAJA::loop_exec>;
+
+    using inner_x = RAJA::LoopPolicy<RAJA::loop_exec>;
+
+    using inner_y = RAJA::LoopPolicy<RAJA::loop_exec>;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::launch<launch_policy>(
+        RAJA::LaunchParams(),
+        [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+          RAJA::loop<outer_x>(ctx, RAJA::RangeSegment(0, NE),
+            [&](int e) {
+
+              DIFFUSION2DPA_0_CPU
+
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
+                [&](int dy) {
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
+                    [&](int dx) {
+                      DIFFUSION2DPA_1
+                    }
+                  );  // RAJA::loop<inner_x>
+
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
+                    [&](int qx) {
+                      DIFFUSION2DPA_2
+                    }
+                  );  // RAJA::loop<inner_x>
+                }  // lambda (dy)
+              );  // RAJA::loop<inner_y>
+
+              ctx.teamSync();
+
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
+                [&](int dy) {
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
+                    [&](int qx) {
+                      DIFFUSION2DPA_3
+                    }
+                  );  // RAJA::loop<inner_x>
+                }  // lambda (dy)
+              );  // RAJA::loop<inner_y>
+
+              ctx.teamSync();
+
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
+                [&](int qy) {
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
+                    [&](int qx) {
+                      DIFFUSION2DPA_4
+                    }
+                  );  // RAJA::loop<inner_x>
+                }  // lambda (qy)
+              );  // RAJA::loop<inner_y>
+
+              ctx.teamSync();
+
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
+                [&](int dy) {
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, Q1D),
+                    [&](int qx) {
+                      DIFFUSION2DPA_5
+                    }
+                  );  // RAJA::loop<inner_x>
+                }  // lambda (dy)
+              );  // RAJA::loop<inner_y>
+
+              ctx.teamSync();
+
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, Q1D),
+                [&](int qy) {
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
+                    [&](int dx) {
+                      DIFFUSION2DPA_6
+                    }
+                  );  // RAJA::loop<inner_x>
+                }  // lambda (qy)
+              );  // RAJA::loop<inner_y>
+
+              ctx.teamSync();
+
+              RAJA::loop<inner_y>(ctx, RAJA::RangeSegment(0, D1D),
+                [&](int dy) {
+                  RAJA::loop<inner_x>(ctx, RAJA::RangeSegment(0, D1D),
+                    [&](int dx) {
+                      DIFFUSION2DPA_7
+                    }
+                  );  // RAJA::loop<inner_x>
+                }  // lambda (dy)
+              );  // RAJA::loop<inner_y>
+
+            }  // lambda (e)
+          );  // RAJA::loop<outer_x>
+
+        }  // outer lambda (ctx)
+      );  // RAJA::launch
+
+    }  // loop over kernel reps
+    stopTimer();
+
+    return;
+  }
+#endif // RUN_RAJA_SEQ
+
+  default:
+    getCout() << "\n DIFFUSION2DPA : Unknown Seq variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_FEM_ORDER_TUNING_DEFINE_BOILERPLATE(DIFFUSION2DPA, Seq)
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,285 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Action of 2D diffusion matrix via partial assembly
+///
+/// Based on MFEM's/CEED algorithms.
+/// Reference implementation
+/// https://github.com/mfem/mfem/blob/master/fem/bilininteg_diffusion_pa.cpp
+///
+/// for (int e = 0; e < NE; ++e) {
+///
+///   constexpr int MQ1 = Q1D;
+///   constexpr int MD1 = D1D;
+///   constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1;
+///   double sBG[2][MQ1*MD1];
+///   double (*B)[MD1] = (double (*)[MD1]) (sBG+0);
+///   double (*G)[MD1] = (double (*)[MD1]) (sBG+1);
+///   double (*Bt)[MQ1] = (double (*)[MQ1]) (sBG+0);
+///   double (*Gt)[MQ1] = (double (*)[MQ1]) (sBG+1);
+///   double sm0[2][MDQ*MDQ];
+///   double sm1[2][MDQ*MDQ];
+///   double (*X)[MD1] = (double (*)[MD1]) (sm0+0);
+///   double (*DQ0)[MQ1] = (double (*)[MQ1]) (sm1+0);
+///   double (*DQ1)[MQ1] = (double (*)[MQ1]) (sm1+1);
+///   double (*QQ0)[MQ1] = (double (*)[MQ1]) (sm0+0);
+///   double (*QQ1)[MQ1] = (double (*)[MQ1]) (sm0+1);
+///   double (*QD0)[MD1] = (double (*)[MD1]) (sm1+0);
+///   double (*QD1)[MD1] = (double (*)[MD1]) (sm1+1);
+///
+///   for (int dy = 0; dy < D1D; ++dy) {
+///     for (int dx = 0; dx < D1D; ++dx) {
+///       X[dy][dx] = x(dx,dy,e);
+///     }
+///     for (int qx = 0; qx < Q1D; ++qx) {
+///       B[qx][dy] = b(qx,dy);
+///       G[qx][dy] = g(qx,dy);
+///     }
+///   }
+///
+///   for (int dy = 0; dy < D1D; ++dy) {
+///     for (int qx = 0; qx < Q1D; ++qx) {
+///       double u = 0.0, v = 0.0;
+///       for (int dx = 0; dx < D1D; ++dx) {
+///         const double coords = X[dy][dx];
+///         u += coords * B[qx][dx];
+///         v += coords * G[qx][dx];
+///       }
+///       DQ0[dy][qx] = u;
+///       DQ1[dy][qx] = v;
+///     }
+///   }
+///
+///   for (int qy = 0; qy < Q1D; ++qy) {
+///     for (int qx = 0; qx < Q1D; ++qx) {
+///       double u = 0.0, v = 0.0;
+///       for (int dy = 0; dy < D1D; ++dy) {
+///         u += DQ1[dy][qx] * B[qy][dy];
+///         v += DQ0[dy][qx] * G[qy][dy];
+///       }
+///       const double O11 = d(qx,qy,0,e);
+///       const double O21 = d(qx,qy,1,e);
+///       const double O12 = symmetric ? O21 : d(qx,qy,2,e);
+///       const double O22 = symmetric ? d(qx,qy,2,e) : d(qx,qy,3,e);
+///       const double gX = u;
+///       const double gY = v;
+///       QQ0[qy][qx] = (O11 * gX) + (O12 * gY);
+///       QQ1[qy][qx] = (O21 * gX) + (O22 * gY);
+///     }
+///   }
+///
+///   for (int dy = 0; dy < D1D; ++dy) {
+///     for (int qx = 0; qx < Q1D; ++qx) {
+///       Bt[dy][qx] = b(qx,dy);
+///       Gt[dy][qx] = g(qx,dy);
+///     }
+///   }
+///
+///   for (int qy = 0; qy < Q1D; ++qy) {
+///     for (int dx = 0; dx < D1D; ++dx) {
+///       double u = 0.0, v = 0.0;
+///       for (int qx = 0; qx < Q1D; ++qx) {
+///         u += QQ0[qy][qx] * Gt[dx][qx];
+///         v += QQ1[qy][qx] * Bt[dx][qx];
+///       }
+///       QD0[qy][dx] = u;
+///       QD1[qy][dx] = v;
+///     }
+///   }
+///
+///   for (int dy = 0; dy < D1D; ++dy) {
+///     for (int dx = 0; dx < D1D; ++dx) {
+///       double u = 0.0, v = 0.0;
+///       for (int qy = 0; qy < Q1D; ++qy) {
+///         u += QD0[qy][dx] * Bt[dy][qy];
+///         v += QD1[qy][dx] * Gt[dy][qy];
+///       }
+///       y(dx,dy,e) += (u + v);
+///     }
+///   }
+///
+/// } // element loop
+///
+
+#ifndef RAJAPerf_Apps_DIFFUSION2DPA_HPP
+#define RAJAPerf_Apps_DIFFUSION2DPA_HPP
+
+#define DIFFUSION2DPA_DATA_SETUP \
+Real_ptr Basis = m_B; \
+Real_ptr dBasis = m_G; \
+Real_ptr D = m_D; \
+Real_ptr X = m_X; \
+Real_ptr Y = m_Y; \
+Index_type NE = m_NE; \
+const bool symmetric = true;
+
+#include "common/KernelBase.hpp"
+#include "FEM_MACROS.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+// Number of Dofs/Qpts in 1D, D1D and Q1D, are template parameters of the
+// variant implementations set by the polynomial order of the tuning
+#define D2PA_SYM 3
+#define d2pa_B(x, y) Basis[x + Q1D * y]
+#define d2pa_G(x, y) dBasis[x + Q1D * y]
+#define d2paX_(dx, dy, e) X[dx + D1D * dy + D1D * D1D * e]
+#define d2paY_(dx, dy, e) Y[dx + D1D * dy + D1D * D1D * e]
+#define d2pa_op(qx, qy, s, e)                                                  \
+  D[qx + Q1D * qy + Q1D * Q1D * s + Q1D * Q1D * D2PA_SYM * e]
+
+#define DIFFUSION2DPA_0_CPU \
+        constexpr int MQ1 = Q1D; \
+        constexpr int MD1 = D1D; \
+        constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
+        double sBG[2][MQ1*MD1]; \
+        double (*B)[MD1] = (double (*)[MD1]) (sBG+0); \
+        double (*G)[MD1] = (double (*)[MD1]) (sBG+1); \
+        double (*Bt)[MQ1] = (double (*)[MQ1]) (sBG+0); \
+        double (*Gt)[MQ1] = (double (*)[MQ1]) (sBG+1); \
+        double sm0[2][MDQ*MDQ]; \
+        double sm1[2][MDQ*MDQ]; \
+        double (*s_X)[MD1] = (double (*)[MD1]) (sm0+0); \
+        double (*DQ0)[MQ1] = (double (*)[MQ1]) (sm1+0); \
+        double (*DQ1)[MQ1] = (double (*)[MQ1]) (sm1+1); \
+        double (*QQ0)[MQ1] = (double (*)[MQ1]) (sm0+0); \
+        double (*QQ1)[MQ1] = (double (*)[MQ1]) (sm0+1); \
+        double (*QD0)[MD1] = (double (*)[MD1]) (sm1+0); \
+        double (*QD1)[MD1] = (double (*)[MD1]) (sm1+1);
+
+#define DIFFUSION2DPA_1 \
+  s_X[dy][dx] = d2paX_(dx, dy, e);
+
+#define DIFFUSION2DPA_2 \
+  B[qx][dy] = d2pa_B(qx, dy); \
+  G[qx][dy] = d2pa_G(qx, dy);
+
+// 4 * D1D * D1D * Q1D
+#define DIFFUSION2DPA_3 \
+  double u = 0.0, v = 0.0; \
+  RAJAPERF_UNROLL(MD1) \
+  for (int dx = 0; dx < D1D; ++dx) { \
+    const double coords = s_X[dy][dx]; \
+    u += coords * B[qx][dx]; \
+    v += coords * G[qx][dx]; \
+  } \
+  DQ0[dy][qx] = u; \
+  DQ1[dy][qx] = v;
+
+// 4 * D1D * Q1D * Q1D + 6 * Q1D * Q1D
+#define DIFFUSION2DPA_4 \
+  double u = 0.0, v = 0.0; \
+  RAJAPERF_UNROLL(MD1) \
+  for (int dy = 0; dy < D1D; ++dy) { \
+    u += DQ1[dy][qx] * B[qy][dy]; \
+    v += DQ0[dy][qx] * G[qy][dy]; \
+  } \
+  const double O11 = d2pa_op(qx, qy, 0, e); \
+  const double O21 = d2pa_op(qx, qy, 1, e); \
+  const double O12 = symmetric ? O21 : d2pa_op(qx, qy, 2, e); \
+  const double O22 = symmetric ? d2pa_op(qx, qy, 2, e) : d2pa_op(qx, qy, 3, e); \
+  const double gX = u; \
+  const double gY = v; \
+  QQ0[qy][qx] = (O11 * gX) + (O12 * gY); \
+  QQ1[qy][qx] = (O21 * gX) + (O22 * gY);
+
+#define DIFFUSION2DPA_5 \
+  Bt[dy][qx] = d2pa_B(qx, dy); \
+  Gt[dy][qx] = d2pa_G(qx, dy);
+
+// 4 * Q1D * Q1D * D1D
+#define DIFFUSION2DPA_6 \
+  double u = 0.0, v = 0.0; \
+  RAJAPERF_UNROLL(MQ1) \
+  for (int qx = 0; qx < Q1D; ++qx) { \
+    u += QQ0[qy][qx] * Gt[dx][qx]; \
+    v += QQ1[qy][qx] * Bt[dx][qx]; \
+  } \
+  QD0[qy][dx] = u; \
+  QD1[qy][dx] = v;
+
+// 4 * Q1D * D1D * D1D + 2 * D1D * D1D
+#define DIFFUSION2DPA_7 \
+  double u = 0.0, v = 0.0; \
+  RAJAPERF_UNROLL(MQ1) \
+  for (int qy = 0; qy < Q1D; ++qy) { \
+    u += QD0[qy][dx] * Bt[dy][qy]; \
+    v += QD1[qy][dx] * Gt[dy][qy]; \
+  } \
+  d2paY_(dx, dy, e) += (u + v);
+
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class DIFFUSION2DPA : public KernelBase
+{
+public:
+
+  DIFFUSION2DPA(const RunParams& params);
+
+  ~DIFFUSION2DPA();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  DIFFUSION2DPA : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  DIFFUSION2DPA : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  DIFFUSION2DPA : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < int D1D, int Q1D >
+  void runSeqVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_order = 2;
+  static const size_t max_order = 8;
+  using orders_type = fem_order::make_list_type<default_order,
+                                                fem_order::MaxOrder<max_order>>;
+
+  // element count, bytes, and FLOPs per rep of the given order
+  Index_type getOrderNumElements(size_t order) const;
+  Index_type getOrderBytesPerRep(size_t order) const;
+  Index_type getOrderFLOPsPerRep(size_t order) const;
+
+  Real_ptr m_B;
+  Real_ptr m_G;
+  Real_ptr m_D;
+  Real_ptr m_X;
+  Real_ptr m_Y;
+
+  Index_type m_NE;
+  int m_D1D;
+  int m_Q1D;
+  Index_type m_NE_default;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
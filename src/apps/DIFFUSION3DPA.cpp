@@ -25,31 +25,31 @@ DIFFUSION3DPA::DIFFUSION3DPA(const RunParams& params)
 {
   m_NE_default = 15625;
 
-  setDefaultProblemSize(m_NE_default*DPA_Q1D*DPA_Q1D*DPA_Q1D);
+  constexpr Index_type Q1D = fem_order::q1d(default_order);
+
+  setDefaultProblemSize(m_NE_default*Q1D*Q1D*Q1D);
   setDefaultReps(50);
 
-  m_NE = std::max(getTargetProblemSize()/(DPA_Q1D*DPA_Q1D*DPA_Q1D), Index_type(1));
+  m_NE = getOrderNumElements(default_order);
 
-  setActualProblemSize( m_NE*DPA_Q1D*DPA_Q1D*DPA_Q1D );
+  setActualProblemSize( m_NE*Q1D*Q1D*Q1D );
 
   setItsPerRep(getActualProblemSize());
   setKernelsPerRep(1);
 
-  setBytesPerRep( 2*DPA_Q1D*DPA_D1D*sizeof(Real_type)  +
-                  DPA_Q1D*DPA_Q1D*DPA_Q1D*SYM*m_NE*sizeof(Real_type) +
-                  DPA_D1D*DPA_D1D*DPA_D1D*m_NE*sizeof(Real_type) +
-                  DPA_D1D*DPA_D1D*DPA_D1D*m_NE*sizeof(Real_type) );
-
-  setFLOPsPerRep(m_NE * (DPA_Q1D * DPA_D1D +
-                         5 * DPA_D1D * DPA_D1D * DPA_Q1D * DPA_D1D +
-                         7 * DPA_D1D * DPA_D1D * DPA_Q1D * DPA_Q1D +
-                         7 * DPA_Q1D * DPA_D1D * DPA_Q1D * DPA_Q1D +
-                         15 * DPA_Q1D * DPA_Q1D * DPA_Q1D +
-                         DPA_Q1D * DPA_D1D +
-                         7 * DPA_Q1D * DPA_Q1D * DPA_D1D * DPA_Q1D +
-                         7 * DPA_Q1D * DPA_Q1D * DPA_D1D * DPA_D1D +
-                         7 * DPA_D1D * DPA_Q1D * DPA_D1D * DPA_D1D +
-                         3 * DPA_D1D * DPA_D1D * DPA_D1D));
+  setBytesPerRep( getOrderBytesPerRep(default_order) );
+  setFLOPsPerRep( getOrderFLOPsPerRep(default_order) );
+
+  seq_for(orders_type{}, [&](auto order) {
+    const Index_type q1d = fem_order::q1d(order);
+    const Index_type order_size = getOrderNumElements(order)*q1d*q1d*q1d;
+    setTuningProblemSize(fem_order::getTuningName(order), order_size);
+    setTuningItsPerRep(fem_order::getTuningName(order), order_size);
+    setTuningBytesPerRep(fem_order::getTuningName(order),
+                         getOrderBytesPerRep(order));
+    setTuningFLOPsPerRep(fem_order::getTuningName(order),
+                         getOrderFLOPsPerRep(order));
+  });
 
   setUsesFeature(Launch);
 
@@ -71,19 +71,63 @@ DIFFUSION3DPA::~DIFFUSION3DPA()
 {
 }
 
-void DIFFUSION3DPA::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+// number of elements of the given order with about the target number of
+// quadrature points
+Index_type DIFFUSION3DPA::getOrderNumElements(size_t order) const
+{
+  const Index_type Q1D = fem_order::q1d(order);
+  return std::max(getTargetProblemSize()/(Q1D*Q1D*Q1D), Index_type(1));
+}
+
+Index_type DIFFUSION3DPA::getOrderBytesPerRep(size_t order) const
 {
+  const Index_type D1D = fem_order::d1d(order);
+  const Index_type Q1D = fem_order::q1d(order);
+  const Index_type NE = getOrderNumElements(order);
+
+  return 2*Q1D*D1D*sizeof(Real_type)  +
+         Q1D*Q1D*Q1D*SYM*NE*sizeof(Real_type) +
+         D1D*D1D*D1D*NE*sizeof(Real_type) +
+         D1D*D1D*D1D*NE*sizeof(Real_type);
+}
 
-  allocAndInitDataConst(m_B, int(DPA_Q1D*DPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_G, int(DPA_Q1D*DPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_D, int(DPA_Q1D*DPA_Q1D*DPA_Q1D*SYM*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_X, int(DPA_D1D*DPA_D1D*DPA_D1D*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_Y, int(DPA_D1D*DPA_D1D*DPA_D1D*m_NE), Real_type(0.0), vid);
+Index_type DIFFUSION3DPA::getOrderFLOPsPerRep(size_t order) const
+{
+  const Index_type D1D = fem_order::d1d(order);
+  const Index_type Q1D = fem_order::q1d(order);
+  const Index_type NE = getOrderNumElements(order);
+
+  return NE * (Q1D * D1D +
+               5 * D1D * D1D * Q1D * D1D +
+               7 * D1D * D1D * Q1D * Q1D +
+               7 * Q1D * D1D * Q1D * Q1D +
+               15 * Q1D * Q1D * Q1D +
+               Q1D * D1D +
+               7 * Q1D * Q1D * D1D * Q1D +
+               7 * Q1D * Q1D * D1D * D1D +
+               7 * D1D * Q1D * D1D * D1D +
+               3 * D1D * D1D * D1D);
+}
+
+void DIFFUSION3DPA::setUp(VariantID vid, size_t tune_idx)
+{
+  const size_t order =
+      fem_order::getOrder(orders_type{}, getVariantTuningProblemName(vid, tune_idx),
+                          default_order);
+  m_D1D = fem_order::d1d(order);
+  m_Q1D = fem_order::q1d(order);
+  m_NE = getOrderNumElements(order);
+
+  allocAndInitDataConst(m_B, int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_G, int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_D, int(m_Q1D*m_Q1D*m_Q1D*SYM*m_NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_X, int(m_D1D*m_D1D*m_D1D*m_NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_Y, int(m_D1D*m_D1D*m_D1D*m_NE), Real_type(0.0), vid);
 }
 
 void DIFFUSION3DPA::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_Y, DPA_D1D*DPA_D1D*DPA_D1D*m_NE, vid);
+  checksum[vid][tune_idx] += calcChecksum(m_Y, m_D1D*m_D1D*m_D1D*m_NE, vid);
 }
 
 void DIFFUSION3DPA::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -15,8 +15,8 @@
 ///
 /// for (int e = 0; e < NE; ++e) {
 ///
-///   constexpr int MQ1 = DPA_Q1D;
-///   constexpr int MD1 = DPA_D1D;
+///   constexpr int MQ1 = Q1D;
+///   constexpr int MD1 = D1D;
 ///   constexpr int MDQ = (MQ1 >  ? MQ1 : MD1;
 ///   double sBG[MQ1*MD1];
 ///   double (*B)[MD1] = (double (*)[MD1]) sBG;
@@ -227,18 +227,17 @@ const bool symmetric = true;
 
 #include "RAJA/RAJA.hpp"
 
-//Number of Dofs/Qpts in 1D
-#define DPA_D1D 3
-#define DPA_Q1D 4
+// Number of Dofs/Qpts in 1D, D1D and Q1D, are template parameters of the
+// variant implementations set by the polynomial order of the tuning
 #define SYM 6
-#define b(x, y) Basis[x + DPA_Q1D * y]
-#define g(x, y) dBasis[x + DPA_Q1D * y]
+#define b(x, y) Basis[x + Q1D * y]
+#define g(x, y) dBasis[x + Q1D * y]
 #define dpaX_(dx, dy, dz, e)                                                      \
-  X[dx + DPA_D1D * dy + DPA_D1D * DPA_D1D * dz + DPA_D1D * DPA_D1D * DPA_D1D * e]
+  X[dx + D1D * dy + D1D * D1D * dz + D1D * D1D * D1D * e]
 #define dpaY_(dx, dy, dz, e)                                                      \
-  Y[dx + DPA_D1D * dy + DPA_D1D * DPA_D1D * dz + DPA_D1D * DPA_D1D * DPA_D1D * e]
+  Y[dx + D1D * dy + D1D * D1D * dz + D1D * D1D * D1D * e]
 #define d(qx, qy, qz, s, e)                                                    \
-  D[qx + DPA_Q1D * qy + DPA_Q1D * DPA_Q1D * qz + DPA_Q1D * DPA_Q1D * DPA_Q1D * s  +  DPA_Q1D * DPA_Q1D * DPA_Q1D * SYM * e]
+  D[qx + Q1D * qy + Q1D * Q1D * qz + Q1D * Q1D * Q1D * s  +  Q1D * Q1D * Q1D * SYM * e]
 
 // Half of B and G are stored in shared to get B, Bt, G and Gt.
 // Indices computation for SmemPADiffusionApply3D.
@@ -268,8 +267,8 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 }
 
 #define DIFFUSION3DPA_0_GPU \
-        constexpr int MQ1 = DPA_Q1D; \
-        constexpr int MD1 = DPA_D1D; \
+        constexpr int MQ1 = Q1D; \
+        constexpr int MD1 = D1D; \
         constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
         RAJA_TEAM_SHARED double sBG[MQ1*MD1]; \
         double (*B)[MD1] = (double (*)[MD1]) sBG; \
@@ -295,8 +294,8 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
         double (*QDD2)[MD1][MD1] = (double (*)[MD1][MD1]) (sm0+2);
 
 #define DIFFUSION3DPA_0_CPU \
-        constexpr int MQ1 = DPA_Q1D; \
-        constexpr int MD1 = DPA_D1D; \
+        constexpr int MQ1 = Q1D; \
+        constexpr int MD1 = D1D; \
         constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
         double sBG[MQ1*MD1]; \
         double (*B)[MD1] = (double (*)[MD1]) sBG; \
@@ -325,22 +324,22 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
         s_X[dz][dy][dx] = dpaX_(dx,dy,dz,e);
 
 #define DIFFUSION3DPA_2 \
-        const int i = qi(qx,dy,DPA_Q1D); \
-        const int j = dj(qx,dy,DPA_D1D); \
-        const int k = qk(qx,dy,DPA_Q1D); \
-        const int l = dl(qx,dy,DPA_D1D); \
+        const int i = qi(qx,dy,Q1D); \
+        const int j = dj(qx,dy,D1D); \
+        const int k = qk(qx,dy,Q1D); \
+        const int l = dl(qx,dy,D1D); \
         B[i][j] = b(qx,dy); \
         G[k][l] = g(qx,dy) * sign(qx,dy); \
 
 #define DIFFUSION3DPA_3 \
            double u = 0.0, v = 0.0; \
             RAJAPERF_UNROLL(MD1) \
-            for (int dx = 0; dx < DPA_D1D; ++dx) \
+            for (int dx = 0; dx < D1D; ++dx) \
             { \
-               const int i = qi(qx,dx,DPA_Q1D); \
-               const int j = dj(qx,dx,DPA_D1D); \
-               const int k = qk(qx,dx,DPA_Q1D); \
-               const int l = dl(qx,dx,DPA_D1D); \
+               const int i = qi(qx,dx,Q1D); \
+               const int j = dj(qx,dx,D1D); \
+               const int k = qk(qx,dx,Q1D); \
+               const int l = dl(qx,dx,D1D); \
                const double s = sign(qx,dx); \
                const double coords = s_X[dz][dy][dx]; \
                u += coords * B[i][j]; \
@@ -352,12 +351,12 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 #define DIFFUSION3DPA_4 \
    double u = 0.0, v = 0.0, w = 0.0; \
    RAJAPERF_UNROLL(MD1)  \
-   for (int dy = 0; dy < DPA_D1D; ++dy) \
+   for (int dy = 0; dy < D1D; ++dy) \
    { \
-      const int i = qi(qy,dy,DPA_Q1D); \
-      const int j = dj(qy,dy,DPA_D1D); \
-      const int k = qk(qy,dy,DPA_Q1D); \
-      const int l = dl(qy,dy,DPA_D1D); \
+      const int i = qi(qy,dy,Q1D); \
+      const int j = dj(qy,dy,D1D); \
+      const int k = qk(qy,dy,Q1D); \
+      const int l = dl(qy,dy,D1D); \
       const double s = sign(qy,dy); \
       u += DDQ1[dz][dy][qx] * B[i][j]; \
       v += DDQ0[dz][dy][qx] * G[k][l] * s; \
@@ -370,12 +369,12 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 #define DIFFUSION3DPA_5 \
                double u = 0.0, v = 0.0, w = 0.0; \
                RAJAPERF_UNROLL(MD1) \
-               for (int dz = 0; dz < DPA_D1D; ++dz) \
+               for (int dz = 0; dz < D1D; ++dz) \
                { \
-                  const int i = qi(qz,dz,DPA_Q1D); \
-                  const int j = dj(qz,dz,DPA_D1D); \
-                  const int k = qk(qz,dz,DPA_Q1D); \
-                  const int l = dl(qz,dz,DPA_D1D); \
+                  const int i = qi(qz,dz,Q1D); \
+                  const int j = dj(qz,dz,D1D); \
+                  const int k = qk(qz,dz,Q1D); \
+                  const int l = dl(qz,dz,D1D); \
                   const double s = sign(qz,dz); \
                   u += DQQ0[dz][qy][qx] * B[i][j]; \
                   v += DQQ1[dz][qy][qx] * B[i][j]; \
@@ -398,22 +397,22 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
                QQQ2[qz][qy][qx] = (O31*gX) + (O32*gY) + (O33*gZ);
 
 #define DIFFUSION3DPA_6 \
-               const int i = qi(q,d,DPA_Q1D); \
-               const int j = dj(q,d,DPA_D1D); \
-               const int k = qk(q,d,DPA_Q1D); \
-               const int l = dl(q,d,DPA_D1D); \
+               const int i = qi(q,d,Q1D); \
+               const int j = dj(q,d,D1D); \
+               const int k = qk(q,d,Q1D); \
+               const int l = dl(q,d,D1D); \
                Bt[j][i] = b(q,d); \
                Gt[l][k] = g(q,d) * sign(q,d);
 
 #define DIFFUSION3DPA_7 \
             double u = 0.0, v = 0.0, w = 0.0; \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qx = 0; qx < DPA_Q1D; ++qx) \
+            for (int qx = 0; qx < Q1D; ++qx) \
             { \
-              const int i = qi(qx,dx,DPA_Q1D); \
-              const int j = dj(qx,dx,DPA_D1D); \
-              const int k = qk(qx,dx,DPA_Q1D); \
-              const int l = dl(qx,dx,DPA_D1D); \
+              const int i = qi(qx,dx,Q1D); \
+              const int j = dj(qx,dx,D1D); \
+              const int k = qk(qx,dx,Q1D); \
+              const int l = dl(qx,dx,D1D); \
               const double s = sign(qx,dx); \
               u += QQQ0[qz][qy][qx] * Gt[l][k] * s; \
               v += QQQ1[qz][qy][qx] * Bt[j][i]; \
@@ -425,13 +424,13 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 
 #define DIFFUSION3DPA_8 \
         double u = 0.0, v = 0.0, w = 0.0; \
-        RAJAPERF_UNROLL(DPA_Q1D)  \
-        for (int qy = 0; qy < DPA_Q1D; ++qy) \
+        RAJAPERF_UNROLL(Q1D)  \
+        for (int qy = 0; qy < Q1D; ++qy) \
         { \
-          const int i = qi(qy,dy,DPA_Q1D); \
-          const int j = dj(qy,dy,DPA_D1D); \
-          const int k = qk(qy,dy,DPA_Q1D); \
-          const int l = dl(qy,dy,DPA_D1D); \
+          const int i = qi(qy,dy,Q1D); \
+          const int j = dj(qy,dy,D1D); \
+          const int k = qk(qy,dy,Q1D); \
+          const int l = dl(qy,dy,D1D); \
           const double s = sign(qy,dy); \
           u += QQD0[qz][qy][dx] * Bt[j][i]; \
           v += QQD1[qz][qy][dx] * Gt[l][k] * s; \
@@ -444,12 +443,12 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 #define DIFFUSION3DPA_9 \
         double u = 0.0, v = 0.0, w = 0.0; \
         RAJAPERF_UNROLL(MQ1) \
-        for (int qz = 0; qz < DPA_Q1D; ++qz)  \
+        for (int qz = 0; qz < Q1D; ++qz)  \
         {                                     \
-          const int i = qi(qz,dz,DPA_Q1D); \
-          const int j = dj(qz,dz,DPA_D1D); \
-          const int k = qk(qz,dz,DPA_Q1D); \
-          const int l = dl(qz,dz,DPA_D1D); \
+          const int i = qi(qz,dz,Q1D); \
+          const int j = dj(qz,dz,D1D); \
+          const int k = qk(qz,dz,Q1D); \
+          const int l = dl(qz,dz,D1D); \
           const double s = sign(qz,dz);    \
           u += QDD0[qz][dy][dx] * Bt[j][i];     \
           v += QDD1[qz][dy][dx] * Bt[j][i];     \
@@ -457,6 +456,202 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
         }                                       \
         dpaY_(dx,dy,dz,e) += (u + v + w);
 
+//
+// Batched CPU version, see MASS3DPA_BATCH_0_CPU. B and G are stored once
+// for the batch while the intermediate values get an element lane index.
+//
+#define DIFFUSION3DPA_BATCH_0_CPU \
+        constexpr int MQ1 = Q1D; \
+        constexpr int MD1 = D1D; \
+        constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
+        constexpr int W = RAJAPERF_FEM_BATCH_WIDTH; \
+        const int nw = (NE - e0 < W) ? static_cast<int>(NE - e0) : W; \
+        Index_type ew[W]; \
+        for (int iw = 0; iw < W; ++iw) { \
+          ew[iw] = e0 + ((iw < nw) ? iw : nw - 1); \
+        } \
+        double sBG[MQ1*MD1]; \
+        double (*B)[MD1] = (double (*)[MD1]) sBG; \
+        double (*G)[MD1] = (double (*)[MD1]) sBG; \
+        double (*Bt)[MQ1] = (double (*)[MQ1]) sBG; \
+        double (*Gt)[MQ1] = (double (*)[MQ1]) sBG; \
+        double sm0[3][MDQ*MDQ*MDQ][W]; \
+        double sm1[3][MDQ*MDQ*MDQ][W]; \
+        double (*s_X)[MD1][MD1][W]  = (double (*)[MD1][MD1][W]) (sm0+2); \
+        double (*DDQ0)[MD1][MQ1][W] = (double (*)[MD1][MQ1][W]) (sm0+0); \
+        double (*DDQ1)[MD1][MQ1][W] = (double (*)[MD1][MQ1][W]) (sm0+1); \
+        double (*DQQ0)[MQ1][MQ1][W] = (double (*)[MQ1][MQ1][W]) (sm1+0); \
+        double (*DQQ1)[MQ1][MQ1][W] = (double (*)[MQ1][MQ1][W]) (sm1+1); \
+        double (*DQQ2)[MQ1][MQ1][W] = (double (*)[MQ1][MQ1][W]) (sm1+2); \
+        double (*QQQ0)[MQ1][MQ1][W] = (double (*)[MQ1][MQ1][W]) (sm0+0); \
+        double (*QQQ1)[MQ1][MQ1][W] = (double (*)[MQ1][MQ1][W]) (sm0+1); \
+        double (*QQQ2)[MQ1][MQ1][W] = (double (*)[MQ1][MQ1][W]) (sm0+2); \
+        double (*QQD0)[MQ1][MD1][W] = (double (*)[MQ1][MD1][W]) (sm1+0); \
+        double (*QQD1)[MQ1][MD1][W] = (double (*)[MQ1][MD1][W]) (sm1+1); \
+        double (*QQD2)[MQ1][MD1][W] = (double (*)[MQ1][MD1][W]) (sm1+2); \
+        double (*QDD0)[MD1][MD1][W] = (double (*)[MD1][MD1][W]) (sm0+0); \
+        double (*QDD1)[MD1][MD1][W] = (double (*)[MD1][MD1][W]) (sm0+1); \
+        double (*QDD2)[MD1][MD1][W] = (double (*)[MD1][MD1][W]) (sm0+2);
+
+#define DIFFUSION3DPA_BATCH_1 \
+        BATCH_FOREACH(iw) { \
+          s_X[dz][dy][dx][iw] = dpaX_(dx,dy,dz,ew[iw]); \
+        }
+
+#define DIFFUSION3DPA_BATCH_3 \
+            double u[W], v[W]; \
+            BATCH_FOREACH(iw) { u[iw] = 0.0; v[iw] = 0.0; } \
+            for (int dx = 0; dx < D1D; ++dx) \
+            { \
+               const int i = qi(qx,dx,Q1D); \
+               const int j = dj(qx,dx,D1D); \
+               const int k = qk(qx,dx,Q1D); \
+               const int l = dl(qx,dx,D1D); \
+               const double s = sign(qx,dx); \
+               const double Bij = B[i][j]; \
+               const double Gkl = G[k][l] * s; \
+               BATCH_FOREACH(iw) { \
+                 const double coords = s_X[dz][dy][dx][iw]; \
+                 u[iw] += coords * Bij; \
+                 v[iw] += coords * Gkl; \
+               } \
+            } \
+            BATCH_FOREACH(iw) { \
+              DDQ0[dz][dy][qx][iw] = u[iw]; \
+              DDQ1[dz][dy][qx][iw] = v[iw]; \
+            }
+
+#define DIFFUSION3DPA_BATCH_4 \
+   double u[W], v[W], w[W]; \
+   BATCH_FOREACH(iw) { u[iw] = 0.0; v[iw] = 0.0; w[iw] = 0.0; } \
+   for (int dy = 0; dy < D1D; ++dy) \
+   { \
+      const int i = qi(qy,dy,Q1D); \
+      const int j = dj(qy,dy,D1D); \
+      const int k = qk(qy,dy,Q1D); \
+      const int l = dl(qy,dy,D1D); \
+      const double s = sign(qy,dy); \
+      const double Bij = B[i][j]; \
+      const double Gkl = G[k][l] * s; \
+      BATCH_FOREACH(iw) { \
+        u[iw] += DDQ1[dz][dy][qx][iw] * Bij; \
+        v[iw] += DDQ0[dz][dy][qx][iw] * Gkl; \
+        w[iw] += DDQ0[dz][dy][qx][iw] * Bij; \
+      } \
+   } \
+   BATCH_FOREACH(iw) { \
+     DQQ0[dz][qy][qx][iw] = u[iw]; \
+     DQQ1[dz][qy][qx][iw] = v[iw]; \
+     DQQ2[dz][qy][qx][iw] = w[iw]; \
+   }
+
+#define DIFFUSION3DPA_BATCH_5 \
+               double u[W], v[W], w[W]; \
+               BATCH_FOREACH(iw) { u[iw] = 0.0; v[iw] = 0.0; w[iw] = 0.0; } \
+               for (int dz = 0; dz < D1D; ++dz) \
+               { \
+                  const int i = qi(qz,dz,Q1D); \
+                  const int j = dj(qz,dz,D1D); \
+                  const int k = qk(qz,dz,Q1D); \
+                  const int l = dl(qz,dz,D1D); \
+                  const double s = sign(qz,dz); \
+                  const double Bij = B[i][j]; \
+                  const double Gkl = G[k][l] * s; \
+                  BATCH_FOREACH(iw) { \
+                    u[iw] += DQQ0[dz][qy][qx][iw] * Bij; \
+                    v[iw] += DQQ1[dz][qy][qx][iw] * Bij; \
+                    w[iw] += DQQ2[dz][qy][qx][iw] * Gkl; \
+                  } \
+               } \
+               BATCH_FOREACH(iw) { \
+                 const Index_type e = ew[iw]; \
+                 const double O11 = d(qx,qy,qz,0,e); \
+                 const double O12 = d(qx,qy,qz,1,e); \
+                 const double O13 = d(qx,qy,qz,2,e); \
+                 const double O21 = symmetric ? O12 : d(qx,qy,qz,3,e); \
+                 const double O22 = symmetric ? d(qx,qy,qz,3,e) : d(qx,qy,qz,4,e); \
+                 const double O23 = symmetric ? d(qx,qy,qz,4,e) : d(qx,qy,qz,5,e); \
+                 const double O31 = symmetric ? O13 : d(qx,qy,qz,6,e); \
+                 const double O32 = symmetric ? O23 : d(qx,qy,qz,7,e); \
+                 const double O33 = symmetric ? d(qx,qy,qz,5,e) : d(qx,qy,qz,8,e); \
+                 const double gX = u[iw]; \
+                 const double gY = v[iw]; \
+                 const double gZ = w[iw]; \
+                 QQQ0[qz][qy][qx][iw] = (O11*gX) + (O12*gY) + (O13*gZ); \
+                 QQQ1[qz][qy][qx][iw] = (O21*gX) + (O22*gY) + (O23*gZ); \
+                 QQQ2[qz][qy][qx][iw] = (O31*gX) + (O32*gY) + (O33*gZ); \
+               }
+
+#define DIFFUSION3DPA_BATCH_7 \
+            double u[W], v[W], w[W]; \
+            BATCH_FOREACH(iw) { u[iw] = 0.0; v[iw] = 0.0; w[iw] = 0.0; } \
+            for (int qx = 0; qx < Q1D; ++qx) \
+            { \
+              const int i = qi(qx,dx,Q1D); \
+              const int j = dj(qx,dx,D1D); \
+              const int k = qk(qx,dx,Q1D); \
+              const int l = dl(qx,dx,D1D); \
+              const double s = sign(qx,dx); \
+              const double Btji = Bt[j][i]; \
+              const double Gtlk = Gt[l][k] * s; \
+              BATCH_FOREACH(iw) { \
+                u[iw] += QQQ0[qz][qy][qx][iw] * Gtlk; \
+                v[iw] += QQQ1[qz][qy][qx][iw] * Btji; \
+                w[iw] += QQQ2[qz][qy][qx][iw] * Btji; \
+              } \
+            } \
+            BATCH_FOREACH(iw) { \
+              QQD0[qz][qy][dx][iw] = u[iw]; \
+              QQD1[qz][qy][dx][iw] = v[iw]; \
+              QQD2[qz][qy][dx][iw] = w[iw]; \
+            }
+
+#define DIFFUSION3DPA_BATCH_8 \
+        double u[W], v[W], w[W]; \
+        BATCH_FOREACH(iw) { u[iw] = 0.0; v[iw] = 0.0; w[iw] = 0.0; } \
+        for (int qy = 0; qy < Q1D; ++qy) \
+        { \
+          const int i = qi(qy,dy,Q1D); \
+          const int j = dj(qy,dy,D1D); \
+          const int k = qk(qy,dy,Q1D); \
+          const int l = dl(qy,dy,D1D); \
+          const double s = sign(qy,dy); \
+          const double Btji = Bt[j][i]; \
+          const double Gtlk = Gt[l][k] * s; \
+          BATCH_FOREACH(iw) { \
+            u[iw] += QQD0[qz][qy][dx][iw] * Btji; \
+            v[iw] += QQD1[qz][qy][dx][iw] * Gtlk; \
+            w[iw] += QQD2[qz][qy][dx][iw] * Btji; \
+          } \
+        } \
+        BATCH_FOREACH(iw) { \
+          QDD0[qz][dy][dx][iw] = u[iw]; \
+          QDD1[qz][dy][dx][iw] = v[iw]; \
+          QDD2[qz][dy][dx][iw] = w[iw]; \
+        }
+
+#define DIFFUSION3DPA_BATCH_9 \
+        double u[W], v[W], w[W]; \
+        BATCH_FOREACH(iw) { u[iw] = 0.0; v[iw] = 0.0; w[iw] = 0.0; } \
+        for (int qz = 0; qz < Q1D; ++qz)  \
+        {                                     \
+          const int i = qi(qz,dz,Q1D); \
+          const int j = dj(qz,dz,D1D); \
+          const int k = qk(qz,dz,Q1D); \
+          const int l = dl(qz,dz,D1D); \
+          const double s = sign(qz,dz);    \
+          const double Btji = Bt[j][i]; \
+          const double Gtlk = Gt[l][k] * s; \
+          BATCH_FOREACH(iw) { \
+            u[iw] += QDD0[qz][dy][dx][iw] * Btji; \
+            v[iw] += QDD1[qz][dy][dx][iw] * Btji; \
+            w[iw] += QDD2[qz][dy][dx][iw] * Gtlk; \
+          } \
+        }                                       \
+        for (int iw = 0; iw < nw; ++iw) { \
+          dpaY_(dx,dy,dz,ew[iw]) += (u[iw] + v[iw] + w[iw]); \
+        }
+
 namespace rajaperf
 {
 class RunParams;
@@ -482,16 +677,33 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  template < int D1D, int Q1D >
+  void runSeqVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < int D1D, int Q1D >
   void runHipVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runSeqVariantBatch(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantBatch(VariantID vid);
 
 private:
-  static const size_t default_gpu_block_size = DPA_Q1D * DPA_Q1D * DPA_Q1D;
-  using gpu_block_sizes_type = gpu_block_size::list_type<default_gpu_block_size>;
+  static const size_t default_order = 2;
+  static const size_t max_order = 8;
+  using orders_type = fem_order::make_list_type<default_order,
+                                                fem_order::MaxOrder<max_order>>;
+
+  // element count, bytes, and FLOPs per rep of the given order
+  Index_type getOrderNumElements(size_t order) const;
+  Index_type getOrderBytesPerRep(size_t order) const;
+  Index_type getOrderFLOPsPerRep(size_t order) const;
 
   Real_ptr m_B;
   Real_ptr m_Bt;
@@ -502,6 +714,8 @@ private:
   Real_ptr m_Y;
 
   Index_type m_NE;
+  int m_D1D;
+  int m_Q1D;
   Index_type m_NE_default;
 };
 
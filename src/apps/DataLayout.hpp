@@ -0,0 +1,171 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Data layouts of several mesh fields of the same length, used by the
+/// layout tunings of the VOL3D, NODAL_ACCUMULATION_3D, DEL_DOT_VEC_2D, and
+/// ENERGY kernels.
+///
+///   soa   - each field is contiguous, as in the separate arrays of the
+///           default tunings
+///   aos   - the fields of each entry are contiguous
+///   aosoa - the fields of each block of block_len entries are contiguous,
+///           each field is contiguous within a block
+///
+/// The fields are stored in a RAJA View indexed by (block, field, entry in
+/// block) whose layout is a permutation chosen at setup, so every layout
+/// runs the same code. The soa tuning pays the same indexing cost as the
+/// others, which separates the cost of the layout from that of the View.
+///
+
+#ifndef RAJAPerf_Apps_DataLayout_HPP
+#define RAJAPerf_Apps_DataLayout_HPP
+
+#include "common/RPTypes.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <string>
+
+namespace rajaperf
+{
+namespace apps
+{
+namespace data_layout
+{
+
+enum Layout {
+  SoA = 0,
+  AoS,
+  AoSoA,
+
+  NumLayouts // Keep this one last and NEVER comment out (!!)
+};
+
+// tuning name for the given layout
+inline std::string getLayoutName(Layout layout)
+{
+  switch (layout) {
+    case SoA:   return "soa";
+    case AoS:   return "aos";
+    case AoSoA: return "aosoa";
+    default:    return "unknown";
+  }
+}
+
+// layout of the tuning with the given name, NumLayouts if it has none
+inline Layout getLayout(const std::string& tuning_name)
+{
+  for (int l = 0; l < NumLayouts; ++l) {
+    if (tuning_name == getLayoutName(static_cast<Layout>(l))) {
+      return static_cast<Layout>(l);
+    }
+  }
+  return NumLayouts;
+}
+
+// entries of each field in a block of the aosoa layout; a power of two so
+// splitting an entry index into block and entry in block is cheap
+constexpr Index_type block_len = 8;
+
+using FieldView = RAJA::View<Real_type, RAJA::Layout<3, Index_type>>;
+
+inline Index_type getNumBlocks(Index_type len)
+{
+  return (len + block_len - 1) / block_len;
+}
+
+// values to allocate for num_fields fields of length len
+inline Index_type getDataLength(Index_type num_fields, Index_type len)
+{
+  return num_fields * getNumBlocks(len) * block_len;
+}
+
+inline FieldView makeView(Real_ptr data, Layout layout,
+                          Index_type num_fields, Index_type len)
+{
+  const Index_type num_blocks = getNumBlocks(len);
+
+  switch (layout) {
+    case AoS:
+      return FieldView(data,
+               RAJA::make_permuted_layout( {{num_blocks, num_fields, block_len}},
+                     RAJA::as_array<RAJA::Perm<0, 2, 1> >::get() ) );
+    case AoSoA:
+      return FieldView(data,
+               RAJA::make_permuted_layout( {{num_blocks, num_fields, block_len}},
+                     RAJA::as_array<RAJA::Perm<0, 1, 2> >::get() ) );
+    case SoA:
+    default:
+      return FieldView(data,
+               RAJA::make_permuted_layout( {{num_blocks, num_fields, block_len}},
+                     RAJA::as_array<RAJA::Perm<1, 0, 2> >::get() ) );
+  }
+}
+
+//
+// Pointer-like access to one field of a view starting at an offset, so the
+// kernel bodies index x1[i] the same way they index the separate arrays.
+//
+struct FieldPtr
+{
+  FieldView view;
+  Index_type field;
+  Index_type offset;
+
+  Real_type& operator[](Index_type i) const
+  {
+    const Index_type n = i + offset;
+    return view(n / block_len, field, n % block_len);
+  }
+};
+
+// copy a field between a separate array and a view
+inline void setField(FieldView view, Index_type field,
+                     const Real_type* src, Index_type len)
+{
+  FieldPtr dst{view, field, 0};
+  for (Index_type i = 0; i < len; ++i) {
+    dst[i] = src[i];
+  }
+}
+
+inline void getField(FieldView view, Index_type field,
+                     Real_type* dst, Index_type len)
+{
+  FieldPtr src{view, field, 0};
+  for (Index_type i = 0; i < len; ++i) {
+    dst[i] = src[i];
+  }
+}
+
+} // end namespace data_layout
+} // end namespace apps
+} // end namespace rajaperf
+
+//
+// Layout versions of the NDPTRSET and NDSET2D macros in AppsData.hpp
+// setting up FieldPtrs to the nodes of a zone.
+//
+#define NDFIELDSET(jp, kp,view,field,v0,v1,v2,v3,v4,v5,v6,v7)  \
+   rajaperf::apps::data_layout::FieldPtr v0{view, field, 0} ;  \
+   rajaperf::apps::data_layout::FieldPtr v1{view, field, 1} ;  \
+   rajaperf::apps::data_layout::FieldPtr v2{view, field, jp} ; \
+   rajaperf::apps::data_layout::FieldPtr v3{view, field, 1 + jp} ; \
+   rajaperf::apps::data_layout::FieldPtr v4{view, field, kp} ; \
+   rajaperf::apps::data_layout::FieldPtr v5{view, field, 1 + kp} ; \
+   rajaperf::apps::data_layout::FieldPtr v6{view, field, jp + kp} ; \
+   rajaperf::apps::data_layout::FieldPtr v7{view, field, 1 + jp + kp} ;
+
+#define NDFIELDSET2D(jp,view,field,v1,v2,v3,v4)  \
+   rajaperf::apps::data_layout::FieldPtr v4{view, field, 0} ;  \
+   rajaperf::apps::data_layout::FieldPtr v1{view, field, 1} ;  \
+   rajaperf::apps::data_layout::FieldPtr v2{view, field, 1 + jp} ;  \
+   rajaperf::apps::data_layout::FieldPtr v3{view, field, jp} ;
+
+#endif // closing endif for header file include guard
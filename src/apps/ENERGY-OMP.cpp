@@ -10,6 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +21,7 @@ namespace apps
 {
 
 
-void ENERGY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void ENERGY::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -182,5 +185,389 @@ void ENERGY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 #endif
 }
 
+void ENERGY::runOpenMPVariantLayout(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  ENERGY_LAYOUT_DATA_SETUP;
+
+  auto energy_lam1 = [=](Index_type i) {
+                       ENERGY_BODY1;
+                     };
+  auto energy_lam2 = [=](Index_type i) {
+                       ENERGY_BODY2;
+                     };
+  auto energy_lam3 = [=](Index_type i) {
+                       ENERGY_BODY3;
+                     };
+  auto energy_lam4 = [=](Index_type i) {
+                       ENERGY_BODY4;
+                     };
+  auto energy_lam5 = [=](Index_type i) {
+                       ENERGY_BODY5;
+                     };
+  auto energy_lam6 = [=](Index_type i) {
+                       ENERGY_BODY6;
+                     };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ENERGY_BODY1;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ENERGY_BODY2;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ENERGY_BODY3;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ENERGY_BODY4;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ENERGY_BODY5;
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ENERGY_BODY6;
+          }
+
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            energy_lam1(i);
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            energy_lam2(i);
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            energy_lam3(i);
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            energy_lam4(i);
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            energy_lam5(i);
+          }
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            energy_lam6(i);
+          }
+
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::region<RAJA::omp_parallel_region>( [=]() {
+
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), energy_lam1);
+
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), energy_lam2);
+
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), energy_lam3);
+
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), energy_lam4);
+
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), energy_lam5);
+
+          RAJA::forall< RAJA::omp_for_nowait_static_exec< > >(
+            RAJA::RangeSegment(ibegin, iend), energy_lam6);
+
+        }); // end omp parallel region
+
+      }
+      stopTimer();
+      break;
+    }
+
+    default : {
+      getCout() << "\n  ENERGY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void ENERGY::runOpenMPVariantTaskloop(VariantID vid, Index_type grainsize)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  ENERGY_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel
+      #pragma omp single nowait
+      {
+        #pragma omp taskloop grainsize(grainsize)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY1;
+        }
+
+        #pragma omp taskloop grainsize(grainsize)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY2;
+        }
+
+        #pragma omp taskloop grainsize(grainsize)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY3;
+        }
+
+        #pragma omp taskloop grainsize(grainsize)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY4;
+        }
+
+        #pragma omp taskloop grainsize(grainsize)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY5;
+        }
+
+        #pragma omp taskloop grainsize(grainsize)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY6;
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+
+    getCout() << "\n  ENERGY : Unknown OpenMP taskloop variant id = " << vid << std::endl;
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(grainsize);
+#endif
+}
+
+void ENERGY::runOpenMPVariantTaskgraph(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  ENERGY_DATA_SETUP;
+
+  const Index_type block_size = omp_task::taskgraph_task_size;
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      // The six loops only depend on each other through e_new and q_new at
+      // the same index, so each block of the range runs through all of them
+      // as a chain of tasks without waiting for the other blocks.
+      #pragma omp parallel
+      #pragma omp single nowait
+      for (Index_type ib = ibegin; ib < iend; ib += block_size) {
+        const Index_type ie = std::min(ib + block_size, iend);
+
+        #pragma omp task firstprivate(ib, ie) depend(out: e_new[ib])
+        for (Index_type i = ib; i < ie; ++i ) {
+          ENERGY_BODY1;
+        }
+
+        #pragma omp task firstprivate(ib, ie) depend(in: e_new[ib]) \
+                                              depend(out: q_new[ib])
+        for (Index_type i = ib; i < ie; ++i ) {
+          ENERGY_BODY2;
+        }
+
+        #pragma omp task firstprivate(ib, ie) depend(inout: e_new[ib]) \
+                                              depend(in: q_new[ib])
+        for (Index_type i = ib; i < ie; ++i ) {
+          ENERGY_BODY3;
+        }
+
+        #pragma omp task firstprivate(ib, ie) depend(inout: e_new[ib])
+        for (Index_type i = ib; i < ie; ++i ) {
+          ENERGY_BODY4;
+        }
+
+        #pragma omp task firstprivate(ib, ie) depend(inout: e_new[ib]) \
+                                              depend(in: q_new[ib])
+        for (Index_type i = ib; i < ie; ++i ) {
+          ENERGY_BODY5;
+        }
+
+        #pragma omp task firstprivate(ib, ie) depend(in: e_new[ib]) \
+                                              depend(out: q_new[ib])
+        for (Index_type i = ib; i < ie; ++i ) {
+          ENERGY_BODY6;
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+
+    getCout() << "\n  ENERGY : Unknown OpenMP taskgraph variant id = " << vid << std::endl;
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void ENERGY::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  for (int l = 0; l < data_layout::NumLayouts; ++l) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantLayout(vid);
+
+    }
+
+    t += 1;
+
+  }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  if (vid == Base_OpenMP) {
+
+    for (Index_type grainsize : omp_task::taskloop_grainsizes) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantTaskloop(vid, grainsize);
+
+      }
+
+      t += 1;
+
+    }
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantTaskgraph(vid);
+
+    }
+
+    t += 1;
+
+  }
+
+#endif
+}
+
+void ENERGY::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  for (int l = 0; l < data_layout::NumLayouts; ++l) {
+    addVariantTuningName(vid,
+        data_layout::getLayoutName(static_cast<data_layout::Layout>(l)),
+        getDefaultTuningName());
+  }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  if (vid == Base_OpenMP) {
+
+    for (Index_type grainsize : omp_task::taskloop_grainsizes) {
+      addVariantTuningName(vid, omp_task::taskloop_tuning_name(grainsize));
+    }
+
+    addVariantTuningName(vid, "taskgraph");
+
+  }
+
+#endif
+}
+
 } // end namespace apps
 } // end namespace rajaperf
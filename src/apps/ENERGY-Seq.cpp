@@ -18,7 +18,7 @@ namespace apps
 {
 
 
-void ENERGY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void ENERGY::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -162,5 +162,185 @@ void ENERGY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void ENERGY::runSeqVariantLayout(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  ENERGY_LAYOUT_DATA_SETUP;
+
+#if defined(RUN_RAJA_SEQ)
+  auto energy_lam1 = [=](Index_type i) {
+                       ENERGY_BODY1;
+                     };
+  auto energy_lam2 = [=](Index_type i) {
+                       ENERGY_BODY2;
+                     };
+  auto energy_lam3 = [=](Index_type i) {
+                       ENERGY_BODY3;
+                     };
+  auto energy_lam4 = [=](Index_type i) {
+                       ENERGY_BODY4;
+                     };
+  auto energy_lam5 = [=](Index_type i) {
+                       ENERGY_BODY5;
+                     };
+  auto energy_lam6 = [=](Index_type i) {
+                       ENERGY_BODY6;
+                     };
+#endif
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY1;
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY2;
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY3;
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY4;
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY5;
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          ENERGY_BODY6;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          energy_lam1(i);
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          energy_lam2(i);
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          energy_lam3(i);
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          energy_lam4(i);
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          energy_lam5(i);
+        }
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          energy_lam6(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::region<RAJA::seq_region>( [=]() {
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend), energy_lam1);
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend), energy_lam2);
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend), energy_lam3);
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend), energy_lam4);
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend), energy_lam5);
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend), energy_lam6);
+
+        }); // end sequential region (for single-source code)
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  ENERGY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void ENERGY::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  for (int l = 0; l < data_layout::NumLayouts; ++l) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantLayout(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void ENERGY::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  for (int l = 0; l < data_layout::NumLayouts; ++l) {
+    addVariantTuningName(vid,
+        data_layout::getLayoutName(static_cast<data_layout::Layout>(l)),
+        getDefaultTuningName());
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
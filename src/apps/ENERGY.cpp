@@ -68,7 +68,7 @@ ENERGY::~ENERGY()
 {
 }
 
-void ENERGY::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void ENERGY::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_e_new, getActualProblemSize(), 0.0, vid);
   allocAndInitData(m_e_old, getActualProblemSize(), vid);
@@ -90,15 +90,51 @@ void ENERGY::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   initData(m_e_cut, vid);
   initData(m_emin, vid);
   initData(m_q_cut, vid);
+
+  if ( usesLayout(vid, tune_idx) ) {
+    m_layout = data_layout::getLayout(getVariantTuningName(vid, tune_idx));
+
+    const Index_type len = getActualProblemSize();
+    const Index_type layout_len = data_layout::getDataLength(s_num_fields, len);
+    allocAndInitDataConst(m_layout_data, layout_len, 0.0, vid);
+
+    std::vector<Real_ptr*> layout_fields = getLayoutFields();
+
+    auto reset_layout = scopedMoveData(m_layout_data, layout_len, vid);
+    std::vector<AutoDataMover<Real_type>> reset_fields;
+    for (Real_ptr* field : layout_fields) {
+      reset_fields.emplace_back(scopedMoveData(*field, len, vid));
+    }
+
+    data_layout::FieldView fields =
+        data_layout::makeView(m_layout_data, m_layout, s_num_fields, len);
+    for (Index_type f = 0; f < s_num_fields; ++f) {
+      data_layout::setField(fields, f, *layout_fields[f], len);
+    }
+  }
 }
 
 void ENERGY::updateChecksum(VariantID vid, size_t tune_idx)
 {
+  if ( usesLayout(vid, tune_idx) ) {
+    const Index_type len = getActualProblemSize();
+    const Index_type layout_len = data_layout::getDataLength(s_num_fields, len);
+
+    auto reset_layout = scopedMoveData(m_layout_data, layout_len, vid);
+    auto reset_e_new = scopedMoveData(m_e_new, len, vid);
+    auto reset_q_new = scopedMoveData(m_q_new, len, vid);
+
+    data_layout::FieldView fields =
+        data_layout::makeView(m_layout_data, m_layout, s_num_fields, len);
+    data_layout::getField(fields, 0, m_e_new, len);
+    data_layout::getField(fields, 5, m_q_new, len);
+  }
+
   checksum[vid][tune_idx] += calcChecksum(m_e_new, getActualProblemSize(), vid);
   checksum[vid][tune_idx] += calcChecksum(m_q_new, getActualProblemSize(), vid);
 }
 
-void ENERGY::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void ENERGY::tearDown(VariantID vid, size_t tune_idx)
 {
   (void) vid;
 
@@ -117,6 +153,9 @@ void ENERGY::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   deallocData(m_ql_old, vid);
   deallocData(m_qq_old, vid);
   deallocData(m_vnewc, vid);
+  if ( usesLayout(vid, tune_idx) ) {
+    deallocData(m_layout_data, vid);
+  }
 }
 
 } // end namespace apps
@@ -83,6 +83,9 @@
 ///   }
 /// }
 ///
+/// The "soa", "aos", and "aosoa" tunings store the 15 zonal fields in one
+/// of the layouts in DataLayout.hpp.
+///
 
 #ifndef RAJAPerf_Apps_ENERGY_HPP
 #define RAJAPerf_Apps_ENERGY_HPP
@@ -108,6 +111,30 @@
   const Real_type emin = m_emin; \
   const Real_type q_cut = m_q_cut;
 
+#define ENERGY_LAYOUT_DATA_SETUP \
+  data_layout::FieldView fields = \
+      data_layout::makeView(m_layout_data, m_layout, s_num_fields, \
+                            getActualProblemSize()); \
+  data_layout::FieldPtr e_new{fields, 0, 0}; \
+  data_layout::FieldPtr e_old{fields, 1, 0}; \
+  data_layout::FieldPtr delvc{fields, 2, 0}; \
+  data_layout::FieldPtr p_new{fields, 3, 0}; \
+  data_layout::FieldPtr p_old{fields, 4, 0}; \
+  data_layout::FieldPtr q_new{fields, 5, 0}; \
+  data_layout::FieldPtr q_old{fields, 6, 0}; \
+  data_layout::FieldPtr work{fields, 7, 0}; \
+  data_layout::FieldPtr compHalfStep{fields, 8, 0}; \
+  data_layout::FieldPtr pHalfStep{fields, 9, 0}; \
+  data_layout::FieldPtr bvc{fields, 10, 0}; \
+  data_layout::FieldPtr pbvc{fields, 11, 0}; \
+  data_layout::FieldPtr ql_old{fields, 12, 0}; \
+  data_layout::FieldPtr qq_old{fields, 13, 0}; \
+  data_layout::FieldPtr vnewc{fields, 14, 0}; \
+  const Real_type rho0 = m_rho0; \
+  const Real_type e_cut = m_e_cut; \
+  const Real_type emin = m_emin; \
+  const Real_type q_cut = m_q_cut;
+
 #define ENERGY_BODY1 \
   e_new[i] = e_old[i] - 0.5 * delvc[i] * \
              (p_old[i] + q_old[i]) + 0.5 * work[i];
@@ -178,6 +205,9 @@
 
 
 #include "common/KernelBase.hpp"
+#include "DataLayout.hpp"
+
+#include <vector>
 
 namespace rajaperf
 {
@@ -204,8 +234,16 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantLayout(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantLayout(VariantID vid);
+  void runOpenMPVariantTaskloop(VariantID vid, Index_type grainsize);
+  void runOpenMPVariantTaskgraph(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -235,6 +273,24 @@ private:
   Real_type m_e_cut;
   Real_type m_emin;
   Real_type m_q_cut;
+
+  // the fields of the layout tunings, in the order of ENERGY_LAYOUT_DATA_SETUP
+  static const Index_type s_num_fields = 15;
+  std::vector<Real_ptr*> getLayoutFields()
+  {
+    return { &m_e_new, &m_e_old, &m_delvc, &m_p_new, &m_p_old,
+             &m_q_new, &m_q_old, &m_work, &m_compHalfStep, &m_pHalfStep,
+             &m_bvc, &m_pbvc, &m_ql_old, &m_qq_old, &m_vnewc };
+  }
+
+  bool usesLayout(VariantID vid, size_t tune_idx) const
+  {
+    return data_layout::getLayout(getVariantTuningName(vid, tune_idx)) !=
+           data_layout::NumLayouts;
+  }
+
+  data_layout::Layout m_layout;
+  Real_ptr m_layout_data;
 };
 
 } // end namespace apps
@@ -8,6 +8,10 @@
 #ifndef RAJAPerf_FEM_MACROS_HPP
 #define RAJAPerf_FEM_MACROS_HPP
 
+#include "common/GPUUtils.hpp"
+
+#include <string>
+
 #if defined(USE_RAJAPERF_UNROLL)
 // If enabled uses RAJA's RAJA_UNROLL_COUNT which is always on
 #define RAJAPERF_UNROLL(N) RAJA_UNROLL_COUNT(N)
@@ -26,4 +30,142 @@
 
 #define CPU_FOREACH(i, k, N) for (int i = 0; i < N; i++)
 
+// Number of elements processed together by the batched CPU tunings. The
+// data of the elements of a batch is interleaved, element index fastest,
+// so each sum factorization contraction is a loop of this length the
+// compiler vectorizes across elements. 8 doubles fill one AVX-512 or two
+// AVX2 registers.
+#if !defined(RAJAPERF_FEM_BATCH_WIDTH)
+#define RAJAPERF_FEM_BATCH_WIDTH 8
+#endif
+
+#define BATCH_FOREACH(w) \
+  RAJA_SIMD \
+  for (int w = 0; w < RAJAPERF_FEM_BATCH_WIDTH; w++)
+
+namespace rajaperf
+{
+
+namespace fem_order
+{
+
+// number of dofs in 1D of an element of polynomial order p
+constexpr int d1d(size_t p) { return static_cast<int>(p) + 1; }
+
+// number of quadrature points in 1D used for elements of polynomial order p
+constexpr int q1d(size_t p) { return static_cast<int>(p) + 2; }
+
+// true if I is a polynomial order of at least 1 and at most max_order
+template < size_t max_order >
+struct MaxOrder
+{
+  template < size_t I >
+  static constexpr bool valid() { return I >= 1 && I <= max_order; }
+};
+
+template < size_t... orders >
+using list_type = camp::int_seq<size_t, orders...>;
+
+// A camp::int_seq of size_t's that is rajaperf::configuration::fem_orders
+// if rajaperf::configuration::fem_orders is not empty
+// and a camp::int_seq of default_order otherwise
+// with invalid entries removed according to validity_checker
+template < size_t default_order,
+           typename validity_checker = gpu_block_size::AllowAny >
+using make_list_type =
+      typename gpu_block_size::detail::remove_invalid<validity_checker,
+        typename std::conditional< (gpu_block_size::detail::SizeOfIntSeq<rajaperf::configuration::fem_orders>::size > 0),
+          rajaperf::configuration::fem_orders,
+          list_type<default_order>
+        >::type
+      >::type;
+
+inline std::string getTuningName(size_t order)
+{
+  return "order_" + std::to_string(order);
+}
+
+// name of the tuning of the given order that batches elements on the CPU
+inline std::string getBatchTuningName(size_t order)
+{
+  return getTuningName(order) + "_batch" +
+         std::to_string(RAJAPERF_FEM_BATCH_WIDTH);
+}
+
+// order of the problem with the given name, or default_order if no order
+// in the list has that name
+template < size_t... orders >
+inline size_t getOrder(camp::int_seq<size_t, orders...> const&,
+                       const std::string& problem_name, size_t default_order)
+{
+  const size_t order_list[] = {orders..., default_order};
+  for (size_t order : order_list) {
+    if (problem_name == getTuningName(order)) {
+      return order;
+    }
+  }
+  return default_order;
+}
+
+} // closing brace for fem_order namespace
+
+} // closing brace for rajaperf namespace
+
+//
+#define RAJAPERF_FEM_ORDER_TUNING_DEFINE_BOILERPLATE(kernel, variant)          \
+  void kernel::run##variant##Variant(VariantID vid, size_t tune_idx)           \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    seq_for(orders_type{}, [&](auto order) {                                   \
+      if (tune_idx == t) {                                                     \
+        run##variant##VariantImpl<fem_order::d1d(order),                       \
+                                  fem_order::q1d(order)>(vid);                 \
+      }                                                                        \
+      t += 1;                                                                  \
+    });                                                                        \
+  }                                                                            \
+                                                                               \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                  \
+  {                                                                            \
+    seq_for(orders_type{}, [&](auto order) {                                   \
+      addVariantTuningName(vid, fem_order::getTuningName(order));              \
+    });                                                                        \
+  }
+
+//
+// Like RAJAPERF_FEM_ORDER_TUNING_DEFINE_BOILERPLATE, adding a tuning per
+// order to variant batch_vid that runs run##variant##VariantBatch. The
+// batched tuning runs the same problem as the tuning of its order.
+//
+#define RAJAPERF_FEM_ORDER_BATCH_TUNING_DEFINE_BOILERPLATE(kernel, variant, batch_vid) \
+  void kernel::run##variant##Variant(VariantID vid, size_t tune_idx)           \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    seq_for(orders_type{}, [&](auto order) {                                   \
+      if (tune_idx == t) {                                                     \
+        run##variant##VariantImpl<fem_order::d1d(order),                       \
+                                  fem_order::q1d(order)>(vid);                 \
+      }                                                                        \
+      t += 1;                                                                  \
+      if (vid == batch_vid) {                                                  \
+        if (tune_idx == t) {                                                   \
+          run##variant##VariantBatch<fem_order::d1d(order),                    \
+                                     fem_order::q1d(order)>(vid);              \
+        }                                                                      \
+        t += 1;                                                                \
+      }                                                                        \
+    });                                                                        \
+  }                                                                            \
+                                                                               \
+  void kernel::set##variant##TuningDefinitions(VariantID vid)                  \
+  {                                                                            \
+    seq_for(orders_type{}, [&](auto order) {                                   \
+      addVariantTuningName(vid, fem_order::getTuningName(order));              \
+      if (vid == batch_vid) {                                                  \
+        addVariantTuningName(vid, fem_order::getBatchTuningName(order),        \
+                                  fem_order::getTuningName(order));            \
+      }                                                                        \
+    });                                                                        \
+  }
+
 #endif // closing endif for header file include guard
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,13 +20,16 @@ namespace apps
 {
 
 
-void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Loop_T, typename List_T >
+void HALOEXCHANGE::runOpenMPVariantImpl(VariantID vid,
+                                        std::vector<List_T*> const& pack_index_lists,
+                                        std::vector<List_T*> const& unpack_index_lists)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
   const Index_type run_reps = getRunReps();
 
-  HALOEXCHANGE_DATA_SETUP;
+  HALOEXCHANGE_COMMON_DATA_SETUP;
 
   switch ( vid ) {
 
@@ -35,12 +40,12 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
+          List_T* list = pack_index_lists[l];
+          Loop_T len = pack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
             #pragma omp parallel for
-            for (Index_type i = 0; i < len; i++) {
+            for (Loop_T i = 0; i < len; i++) {
               HALOEXCHANGE_PACK_BODY;
             }
             buffer += len;
@@ -49,12 +54,12 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
+          List_T* list = unpack_index_lists[l];
+          Loop_T len = unpack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
             #pragma omp parallel for
-            for (Index_type i = 0; i < len; i++) {
+            for (Loop_T i = 0; i < len; i++) {
               HALOEXCHANGE_UNPACK_BODY;
             }
             buffer += len;
@@ -74,15 +79,15 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
+          List_T* list = pack_index_lists[l];
+          Loop_T len = pack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_pack_base_lam = [=](Index_type i) {
+            auto haloexchange_pack_base_lam = [=](Loop_T i) {
                   HALOEXCHANGE_PACK_BODY;
                 };
             #pragma omp parallel for
-            for (Index_type i = 0; i < len; i++) {
+            for (Loop_T i = 0; i < len; i++) {
               haloexchange_pack_base_lam(i);
             }
             buffer += len;
@@ -91,15 +96,15 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
+          List_T* list = unpack_index_lists[l];
+          Loop_T len = unpack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_unpack_base_lam = [=](Index_type i) {
+            auto haloexchange_unpack_base_lam = [=](Loop_T i) {
                   HALOEXCHANGE_UNPACK_BODY;
                 };
             #pragma omp parallel for
-            for (Index_type i = 0; i < len; i++) {
+            for (Loop_T i = 0; i < len; i++) {
               haloexchange_unpack_base_lam(i);
             }
             buffer += len;
@@ -121,15 +126,15 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
+          List_T* list = pack_index_lists[l];
+          Loop_T len = pack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_pack_base_lam = [=](Index_type i) {
+            auto haloexchange_pack_base_lam = [=](Loop_T i) {
                   HALOEXCHANGE_PACK_BODY;
                 };
             RAJA::forall<EXEC_POL>(
-                RAJA::TypedRangeSegment<Index_type>(0, len),
+                RAJA::TypedRangeSegment<Loop_T>(0, len),
                 haloexchange_pack_base_lam );
             buffer += len;
           }
@@ -137,15 +142,15 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
+          List_T* list = unpack_index_lists[l];
+          Loop_T len = unpack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_unpack_base_lam = [=](Index_type i) {
+            auto haloexchange_unpack_base_lam = [=](Loop_T i) {
                   HALOEXCHANGE_UNPACK_BODY;
                 };
             RAJA::forall<EXEC_POL>(
-                RAJA::TypedRangeSegment<Index_type>(0, len),
+                RAJA::TypedRangeSegment<Loop_T>(0, len),
                 haloexchange_unpack_base_lam );
             buffer += len;
           }
@@ -165,6 +170,409 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(pack_index_lists);
+  RAJA_UNUSED_VAR(unpack_index_lists);
+#endif
+}
+
+template < bool use_memcpy >
+void HALOEXCHANGE::runOpenMPVariantRuns(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_COMMON_DATA_SETUP;
+
+  std::vector<Index_ptr> pack_runs = m_pack_runs;
+  std::vector<Index_type> pack_run_counts = m_pack_run_counts;
+  std::vector<Index_ptr> unpack_runs = m_unpack_runs;
+  std::vector<Index_type> unpack_run_counts = m_unpack_run_counts;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Index_ptr runs = pack_runs[l];
+          Index_type num_runs = pack_run_counts[l];
+          Index_type len = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            #pragma omp parallel for
+            for (Index_type r = 0; r < num_runs; r++) {
+              HALOEXCHANGE_PACK_RUN_BODY;
+            }
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Index_ptr runs = unpack_runs[l];
+          Index_type num_runs = unpack_run_counts[l];
+          Index_type len = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            #pragma omp parallel for
+            for (Index_type r = 0; r < num_runs; r++) {
+              HALOEXCHANGE_UNPACK_RUN_BODY;
+            }
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Index_ptr runs = pack_runs[l];
+          Index_type num_runs = pack_run_counts[l];
+          Index_type len = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_pack_run_base_lam = [=](Index_type r) {
+                  HALOEXCHANGE_PACK_RUN_BODY;
+                };
+            #pragma omp parallel for
+            for (Index_type r = 0; r < num_runs; r++) {
+              haloexchange_pack_run_base_lam(r);
+            }
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Index_ptr runs = unpack_runs[l];
+          Index_type num_runs = unpack_run_counts[l];
+          Index_type len = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_unpack_run_base_lam = [=](Index_type r) {
+                  HALOEXCHANGE_UNPACK_RUN_BODY;
+                };
+            #pragma omp parallel for
+            for (Index_type r = 0; r < num_runs; r++) {
+              haloexchange_unpack_run_base_lam(r);
+            }
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL = RAJA::omp_parallel_for_exec;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Index_ptr runs = pack_runs[l];
+          Index_type num_runs = pack_run_counts[l];
+          Index_type len = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_pack_run_base_lam = [=](Index_type r) {
+                  HALOEXCHANGE_PACK_RUN_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, num_runs),
+                haloexchange_pack_run_base_lam );
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Index_ptr runs = unpack_runs[l];
+          Index_type num_runs = unpack_run_counts[l];
+          Index_type len = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_unpack_run_base_lam = [=](Index_type r) {
+                  HALOEXCHANGE_UNPACK_RUN_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, num_runs),
+                haloexchange_unpack_run_base_lam );
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALOEXCHANGE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HALOEXCHANGE::runOpenMPVariantTaskloop(VariantID vid, Index_type grainsize)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel
+      #pragma omp single nowait
+      {
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            #pragma omp taskloop grainsize(grainsize) nogroup
+            for (Index_type i = 0; i < len; i++) {
+              HALOEXCHANGE_PACK_BODY;
+            }
+            buffer += len;
+          }
+        }
+
+        #pragma omp taskwait
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            #pragma omp taskloop grainsize(grainsize) nogroup
+            for (Index_type i = 0; i < len; i++) {
+              HALOEXCHANGE_UNPACK_BODY;
+            }
+            buffer += len;
+          }
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+
+    getCout() << "\n HALOEXCHANGE : Unknown OpenMP taskloop variant id = " << vid << std::endl;
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(grainsize);
+#endif
+}
+
+void HALOEXCHANGE::runOpenMPVariantTaskgraph(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      // Each unpack only waits for the pack that fills its part of the
+      // buffer, so unpacking overlaps with packing the other messages.
+      #pragma omp parallel
+      #pragma omp single nowait
+      {
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            #pragma omp task firstprivate(buffer, list, var, len) \
+                             depend(out: buffer[0])
+            for (Index_type i = 0; i < len; i++) {
+              HALOEXCHANGE_PACK_BODY;
+            }
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            #pragma omp task firstprivate(buffer, list, var, len) \
+                             depend(in: buffer[0])
+            for (Index_type i = 0; i < len; i++) {
+              HALOEXCHANGE_UNPACK_BODY;
+            }
+            buffer += len;
+          }
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+
+    getCout() << "\n HALOEXCHANGE : Unknown OpenMP taskgraph variant id = " << vid << std::endl;
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<Index_type, Int_type>(vid, m_pack_index_lists, m_unpack_index_lists);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<Int_type, Int_type>(vid, m_pack_index_lists, m_unpack_index_lists);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<Index_type, Index_type>(vid, m_pack_index_lists_64, m_unpack_index_lists_64);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<Int_type, Index_type>(vid, m_pack_index_lists_64, m_unpack_index_lists_64);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantRuns<false>(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantRuns<true>(vid);
+
+  }
+
+  t += 1;
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  if (vid == Base_OpenMP) {
+
+    for (Index_type grainsize : omp_task::taskloop_grainsizes) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantTaskloop(vid, grainsize);
+
+      }
+
+      t += 1;
+
+    }
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantTaskgraph(vid);
+
+    }
+
+    t += 1;
+
+  }
+
+#endif
+}
+
+void HALOEXCHANGE::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  addVariantTuningName(vid, getIndexTuningName<Int_type, Int_type>(),
+                       getDefaultTuningName());
+  addVariantTuningName(vid, getIndexTuningName<Index_type, Index_type>(),
+                       getDefaultTuningName());
+  addVariantTuningName(vid, getIndexTuningName<Int_type, Index_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, "runs", getDefaultTuningName());
+  addVariantTuningName(vid, "runs_memcpy", getDefaultTuningName());
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  if (vid == Base_OpenMP) {
+
+    for (Index_type grainsize : omp_task::taskloop_grainsizes) {
+      addVariantTuningName(vid, omp_task::taskloop_tuning_name(grainsize));
+    }
+
+    addVariantTuningName(vid, "taskgraph");
+
+  }
+
 #endif
 }
 
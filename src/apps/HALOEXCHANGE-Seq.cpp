@@ -18,11 +18,14 @@ namespace apps
 {
 
 
-void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Loop_T, typename List_T >
+void HALOEXCHANGE::runSeqVariantImpl(VariantID vid,
+                                     std::vector<List_T*> const& pack_index_lists,
+                                     std::vector<List_T*> const& unpack_index_lists)
 {
   const Index_type run_reps = getRunReps();
 
-  HALOEXCHANGE_DATA_SETUP;
+  HALOEXCHANGE_COMMON_DATA_SETUP;
 
   switch ( vid ) {
 
@@ -33,11 +36,11 @@ void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
+          List_T* list = pack_index_lists[l];
+          Loop_T len = pack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            for (Index_type i = 0; i < len; i++) {
+            for (Loop_T i = 0; i < len; i++) {
               HALOEXCHANGE_PACK_BODY;
             }
             buffer += len;
@@ -46,11 +49,11 @@ void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
+          List_T* list = unpack_index_lists[l];
+          Loop_T len = unpack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            for (Index_type i = 0; i < len; i++) {
+            for (Loop_T i = 0; i < len; i++) {
               HALOEXCHANGE_UNPACK_BODY;
             }
             buffer += len;
@@ -71,14 +74,14 @@ void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
+          List_T* list = pack_index_lists[l];
+          Loop_T len = pack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_pack_base_lam = [=](Index_type i) {
+            auto haloexchange_pack_base_lam = [=](Loop_T i) {
                   HALOEXCHANGE_PACK_BODY;
                 };
-            for (Index_type i = 0; i < len; i++) {
+            for (Loop_T i = 0; i < len; i++) {
               haloexchange_pack_base_lam(i);
             }
             buffer += len;
@@ -87,14 +90,14 @@ void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
+          List_T* list = unpack_index_lists[l];
+          Loop_T len = unpack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_unpack_base_lam = [=](Index_type i) {
+            auto haloexchange_unpack_base_lam = [=](Loop_T i) {
                   HALOEXCHANGE_UNPACK_BODY;
                 };
-            for (Index_type i = 0; i < len; i++) {
+            for (Loop_T i = 0; i < len; i++) {
               haloexchange_unpack_base_lam(i);
             }
             buffer += len;
@@ -116,15 +119,15 @@ void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
+          List_T* list = pack_index_lists[l];
+          Loop_T len = pack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_pack_base_lam = [=](Index_type i) {
+            auto haloexchange_pack_base_lam = [=](Loop_T i) {
                   HALOEXCHANGE_PACK_BODY;
                 };
             RAJA::forall<EXEC_POL>(
-                RAJA::TypedRangeSegment<Index_type>(0, len),
+                RAJA::TypedRangeSegment<Loop_T>(0, len),
                 haloexchange_pack_base_lam );
             buffer += len;
           }
@@ -132,15 +135,15 @@ void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
+          List_T* list = unpack_index_lists[l];
+          Loop_T len = unpack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_unpack_base_lam = [=](Index_type i) {
+            auto haloexchange_unpack_base_lam = [=](Loop_T i) {
                   HALOEXCHANGE_UNPACK_BODY;
                 };
             RAJA::forall<EXEC_POL>(
-                RAJA::TypedRangeSegment<Index_type>(0, len),
+                RAJA::TypedRangeSegment<Loop_T>(0, len),
                 haloexchange_unpack_base_lam );
             buffer += len;
           }
@@ -161,5 +164,228 @@ void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 }
 
+template < bool use_memcpy >
+void HALOEXCHANGE::runSeqVariantRuns(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_COMMON_DATA_SETUP;
+
+  std::vector<Index_ptr> pack_runs = m_pack_runs;
+  std::vector<Index_type> pack_run_counts = m_pack_run_counts;
+  std::vector<Index_ptr> unpack_runs = m_unpack_runs;
+  std::vector<Index_type> unpack_run_counts = m_unpack_run_counts;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Index_ptr runs = pack_runs[l];
+          Index_type num_runs = pack_run_counts[l];
+          Index_type len = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type r = 0; r < num_runs; r++) {
+              HALOEXCHANGE_PACK_RUN_BODY;
+            }
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Index_ptr runs = unpack_runs[l];
+          Index_type num_runs = unpack_run_counts[l];
+          Index_type len = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type r = 0; r < num_runs; r++) {
+              HALOEXCHANGE_UNPACK_RUN_BODY;
+            }
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Index_ptr runs = pack_runs[l];
+          Index_type num_runs = pack_run_counts[l];
+          Index_type len = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_pack_run_base_lam = [=](Index_type r) {
+                  HALOEXCHANGE_PACK_RUN_BODY;
+                };
+            for (Index_type r = 0; r < num_runs; r++) {
+              haloexchange_pack_run_base_lam(r);
+            }
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Index_ptr runs = unpack_runs[l];
+          Index_type num_runs = unpack_run_counts[l];
+          Index_type len = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_unpack_run_base_lam = [=](Index_type r) {
+                  HALOEXCHANGE_UNPACK_RUN_BODY;
+                };
+            for (Index_type r = 0; r < num_runs; r++) {
+              haloexchange_unpack_run_base_lam(r);
+            }
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      using EXEC_POL = RAJA::loop_exec;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Index_ptr runs = pack_runs[l];
+          Index_type num_runs = pack_run_counts[l];
+          Index_type len = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_pack_run_base_lam = [=](Index_type r) {
+                  HALOEXCHANGE_PACK_RUN_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, num_runs),
+                haloexchange_pack_run_base_lam );
+            buffer += len;
+          }
+        }
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = buffers[l];
+          Index_ptr runs = unpack_runs[l];
+          Index_type num_runs = unpack_run_counts[l];
+          Index_type len = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_unpack_run_base_lam = [=](Index_type r) {
+                  HALOEXCHANGE_UNPACK_RUN_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, num_runs),
+                haloexchange_unpack_run_base_lam );
+            buffer += len;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n HALOEXCHANGE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<Index_type, Int_type>(vid, m_pack_index_lists, m_unpack_index_lists);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<Int_type, Int_type>(vid, m_pack_index_lists, m_unpack_index_lists);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<Index_type, Index_type>(vid, m_pack_index_lists_64, m_unpack_index_lists_64);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<Int_type, Index_type>(vid, m_pack_index_lists_64, m_unpack_index_lists_64);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantRuns<false>(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantRuns<true>(vid);
+
+  }
+
+  t += 1;
+}
+
+void HALOEXCHANGE::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getIndexTuningName<Int_type, Int_type>(),
+                       getDefaultTuningName());
+  addVariantTuningName(vid, getIndexTuningName<Index_type, Index_type>(),
+                       getDefaultTuningName());
+  addVariantTuningName(vid, getIndexTuningName<Int_type, Index_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, "runs", getDefaultTuningName());
+  addVariantTuningName(vid, "runs_memcpy", getDefaultTuningName());
+}
+
 } // end namespace apps
 } // end namespace rajaperf
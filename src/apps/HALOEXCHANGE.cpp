@@ -12,6 +12,7 @@
 
 #include "common/DataUtils.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 namespace rajaperf
@@ -52,12 +53,44 @@ HALOEXCHANGE::HALOEXCHANGE(const RunParams& params)
 
   setItsPerRep( m_num_vars * (m_var_size - getActualProblemSize()) );
   setKernelsPerRep( 2 * s_num_neighbors * m_num_vars );
-  setBytesPerRep( (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * getItsPerRep() +
-                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +
-                  (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * getItsPerRep() +
-                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() );
+  // bytes with index lists of entries of list_size bytes, the default
+  // tuning uses Int_type lists
+  auto list_bytes_per_rep = [&](size_t list_size) {
+    return (0*list_size         + 1*list_size        ) * getItsPerRep() +
+           (1*sizeof(Real_type)  + 1*sizeof(Real_type) ) * getItsPerRep() +
+           (0*list_size         + 1*list_size        ) * getItsPerRep() +
+           (1*sizeof(Real_type)  + 1*sizeof(Real_type) ) * getItsPerRep();
+  };
+  setBytesPerRep( list_bytes_per_rep(sizeof(Int_type)) );
+  setTuningBytesPerRep( getIndexTuningName<Int_type, Int_type>(),
+                        list_bytes_per_rep(sizeof(Int_type)) );
+  setTuningBytesPerRep( getIndexTuningName<Index_type, Index_type>(),
+                        list_bytes_per_rep(sizeof(Index_type)) );
+  setTuningBytesPerRep( getIndexTuningName<Int_type, Index_type>(),
+                        list_bytes_per_rep(sizeof(Index_type)) );
   setFLOPsPerRep(0);
 
+  // the runs tunings read a (var start, buffer start, length) triple per
+  // unit-stride run instead of an index per element, every list is a box of
+  // runs along the first dimension
+  Index_type num_runs = 0;
+  for (int dk = -1; dk <= 1; ++dk) {
+    for (int dj = -1; dj <= 1; ++dj) {
+      for (int di = -1; di <= 1; ++di) {
+        if (di == 0 && dj == 0 && dk == 0) continue;
+        num_runs += (dj == 0 ? m_grid_dims[1] : m_halo_width) *
+                    (dk == 0 ? m_grid_dims[2] : m_halo_width);
+      }
+    }
+  }
+  const Index_type runs_bytes_per_rep =
+      (0*sizeof(Index_type) + 3*sizeof(Index_type)) * m_num_vars * num_runs +
+      (1*sizeof(Real_type)  + 1*sizeof(Real_type) ) * getItsPerRep() +
+      (0*sizeof(Index_type) + 3*sizeof(Index_type)) * m_num_vars * num_runs +
+      (1*sizeof(Real_type)  + 1*sizeof(Real_type) ) * getItsPerRep();
+  setTuningBytesPerRep("runs", runs_bytes_per_rep);
+  setTuningBytesPerRep("runs_memcpy", runs_bytes_per_rep);
+
   setUsesFeature(Forall);
 
   setVariantDefined( Base_Seq );
@@ -82,7 +115,7 @@ HALOEXCHANGE::~HALOEXCHANGE()
 {
 }
 
-void HALOEXCHANGE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HALOEXCHANGE::setUp(VariantID vid, size_t tune_idx)
 {
   m_vars.resize(m_num_vars, nullptr);
   for (Index_type v = 0; v < m_num_vars; ++v) {
@@ -96,13 +129,38 @@ void HALOEXCHANGE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
     }
   }
 
-  m_pack_index_lists.resize(s_num_neighbors, nullptr);
   m_pack_index_list_lengths.resize(s_num_neighbors, 0);
-  create_pack_lists(m_pack_index_lists, m_pack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
-
-  m_unpack_index_lists.resize(s_num_neighbors, nullptr);
   m_unpack_index_list_lengths.resize(s_num_neighbors, 0);
-  create_unpack_lists(m_unpack_index_lists, m_unpack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+
+  if ( usesIndexLists64(vid, tune_idx) ) {
+
+    m_pack_index_lists_64.resize(s_num_neighbors, nullptr);
+    create_pack_lists(m_pack_index_lists_64, m_pack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+
+    m_unpack_index_lists_64.resize(s_num_neighbors, nullptr);
+    create_unpack_lists(m_unpack_index_lists_64, m_unpack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+
+  } else {
+
+    m_pack_index_lists.resize(s_num_neighbors, nullptr);
+    create_pack_lists(m_pack_index_lists, m_pack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+
+    m_unpack_index_lists.resize(s_num_neighbors, nullptr);
+    create_unpack_lists(m_unpack_index_lists, m_unpack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+
+  }
+
+  if ( usesRuns(vid, tune_idx) ) {
+
+    m_pack_runs.resize(s_num_neighbors, nullptr);
+    m_pack_run_counts.resize(s_num_neighbors, 0);
+    create_runs(m_pack_runs, m_pack_run_counts, m_pack_index_lists, m_pack_index_list_lengths, s_num_neighbors, vid);
+
+    m_unpack_runs.resize(s_num_neighbors, nullptr);
+    m_unpack_run_counts.resize(s_num_neighbors, 0);
+    create_runs(m_unpack_runs, m_unpack_run_counts, m_unpack_index_lists, m_unpack_index_list_lengths, s_num_neighbors, vid);
+
+  }
 
   m_buffers.resize(s_num_neighbors, nullptr);
   for (Index_type l = 0; l < s_num_neighbors; ++l) {
@@ -118,20 +176,44 @@ void HALOEXCHANGE::updateChecksum(VariantID vid, size_t tune_idx)
   }
 }
 
-void HALOEXCHANGE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HALOEXCHANGE::tearDown(VariantID vid, size_t tune_idx)
 {
   for (int l = 0; l < s_num_neighbors; ++l) {
     deallocData(m_buffers[l], vid);
   }
   m_buffers.clear();
 
-  destroy_unpack_lists(m_unpack_index_lists, s_num_neighbors, vid);
-  m_unpack_index_list_lengths.clear();
-  m_unpack_index_lists.clear();
+  if ( usesRuns(vid, tune_idx) ) {
+
+    destroy_runs(m_unpack_runs, s_num_neighbors, vid);
+    m_unpack_runs.clear();
+    m_unpack_run_counts.clear();
+
+    destroy_runs(m_pack_runs, s_num_neighbors, vid);
+    m_pack_runs.clear();
+    m_pack_run_counts.clear();
+
+  }
+
+  if ( usesIndexLists64(vid, tune_idx) ) {
+
+    destroy_unpack_lists(m_unpack_index_lists_64, s_num_neighbors, vid);
+    m_unpack_index_lists_64.clear();
+
+    destroy_pack_lists(m_pack_index_lists_64, s_num_neighbors, vid);
+    m_pack_index_lists_64.clear();
+
+  } else {
+
+    destroy_unpack_lists(m_unpack_index_lists, s_num_neighbors, vid);
+    m_unpack_index_lists.clear();
+
+    destroy_pack_lists(m_pack_index_lists, s_num_neighbors, vid);
+    m_pack_index_lists.clear();
 
-  destroy_pack_lists(m_pack_index_lists, s_num_neighbors, vid);
+  }
+  m_unpack_index_list_lengths.clear();
   m_pack_index_list_lengths.clear();
-  m_pack_index_lists.clear();
 
   for (int v = 0; v < m_num_vars; ++v) {
     deallocData(m_vars[v], vid);
@@ -156,8 +238,9 @@ struct Extent
 //
 // Function to generate index lists for packing.
 //
+template < typename List_T >
 void HALOEXCHANGE::create_pack_lists(
-    std::vector<Int_ptr>& pack_index_lists,
+    std::vector<List_T*>& pack_index_lists,
     std::vector<Index_type >& pack_index_list_lengths,
     const Index_type halo_width, const Index_type* grid_dims,
     const Index_type num_neighbors,
@@ -264,7 +347,7 @@ void HALOEXCHANGE::create_pack_lists(
     allocAndInitData(pack_index_lists[l], pack_index_list_lengths[l], vid);
     auto reset_list = scopedMoveData(pack_index_lists[l], pack_index_list_lengths[l], vid);
 
-    Int_ptr pack_list = pack_index_lists[l];
+    List_T* pack_list = pack_index_lists[l];
 
     Index_type list_idx = 0;
     for (Index_type kk = extent.k_min; kk < extent.k_max; ++kk) {
@@ -287,8 +370,9 @@ void HALOEXCHANGE::create_pack_lists(
 //
 // Function to destroy packing index lists.
 //
+template < typename List_T >
 void HALOEXCHANGE::destroy_pack_lists(
-    std::vector<Int_ptr>& pack_index_lists,
+    std::vector<List_T*>& pack_index_lists,
     const Index_type num_neighbors,
     VariantID vid)
 {
@@ -302,8 +386,9 @@ void HALOEXCHANGE::destroy_pack_lists(
 //
 // Function to generate index lists for unpacking.
 //
+template < typename List_T >
 void HALOEXCHANGE::create_unpack_lists(
-    std::vector<Int_ptr>& unpack_index_lists,
+    std::vector<List_T*>& unpack_index_lists,
     std::vector<Index_type >& unpack_index_list_lengths,
     const Index_type halo_width, const Index_type* grid_dims,
     const Index_type num_neighbors,
@@ -410,7 +495,7 @@ void HALOEXCHANGE::create_unpack_lists(
     allocAndInitData(unpack_index_lists[l], unpack_index_list_lengths[l], vid);
     auto reset_list = scopedMoveData(unpack_index_lists[l], unpack_index_list_lengths[l], vid);
 
-    Int_ptr unpack_list = unpack_index_lists[l];
+    List_T* unpack_list = unpack_index_lists[l];
 
     Index_type list_idx = 0;
     for (Index_type kk = extent.k_min; kk < extent.k_max; ++kk) {
@@ -433,8 +518,9 @@ void HALOEXCHANGE::create_unpack_lists(
 //
 // Function to destroy unpacking index lists.
 //
+template < typename List_T >
 void HALOEXCHANGE::destroy_unpack_lists(
-    std::vector<Int_ptr>& unpack_index_lists,
+    std::vector<List_T*>& unpack_index_lists,
     const Index_type num_neighbors,
     VariantID vid)
 {
@@ -445,5 +531,56 @@ void HALOEXCHANGE::destroy_unpack_lists(
   }
 }
 
+//
+// Function to generate the unit-stride runs of index lists.
+//
+void HALOEXCHANGE::create_runs(
+    std::vector<Index_ptr>& runs,
+    std::vector<Index_type >& run_counts,
+    std::vector<Int_ptr> const& index_lists,
+    std::vector<Index_type > const& index_list_lengths,
+    const Index_type num_neighbors,
+    VariantID vid)
+{
+  for (Index_type l = 0; l < num_neighbors; ++l) {
+
+    Int_ptr list = index_lists[l];
+    Index_type len = index_list_lengths[l];
+
+    std::vector<Index_type> list_runs;
+    for (Index_type i = 0; i < len; ++i) {
+      if (i > 0 && list[i] == list[i-1] + 1) {
+        list_runs.back() += 1;
+      } else {
+        list_runs.push_back(list[i]);
+        list_runs.push_back(i);
+        list_runs.push_back(1);
+      }
+    }
+
+    run_counts[l] = list_runs.size() / 3;
+
+    allocAndInitData(runs[l], 3*run_counts[l], vid);
+    auto reset_runs = scopedMoveData(runs[l], 3*run_counts[l], vid);
+
+    std::copy(list_runs.begin(), list_runs.end(), runs[l]);
+  }
+}
+
+//
+// Function to destroy unit-stride runs.
+//
+void HALOEXCHANGE::destroy_runs(
+    std::vector<Index_ptr>& runs,
+    const Index_type num_neighbors,
+    VariantID vid)
+{
+  (void) vid;
+
+  for (Index_type l = 0; l < num_neighbors; ++l) {
+    deallocData(runs[l], vid);
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -41,33 +41,74 @@
 ///   }
 /// }
 ///
+/// The default tuning uses Index_type loop indices and Int_type index
+/// lists; the "loop<bits>_list<bits>" tunings of the Seq and OpenMP variants
+/// use other combinations of 32-bit (Int_type) and 64-bit (Index_type)
+/// loop indices and index lists.
+///
+/// The "runs" tunings of the Seq and OpenMP variants replace each index list
+/// with the unit-stride runs it is made of, described by their start in the
+/// variable, start in the buffer and length, and copy each run with a
+/// contiguous loop ("runs") or with memcpy ("runs_memcpy").
+///
 
 #ifndef RAJAPerf_Apps_HALOEXCHANGE_HPP
 #define RAJAPerf_Apps_HALOEXCHANGE_HPP
 
-#define HALOEXCHANGE_DATA_SETUP \
+#define HALOEXCHANGE_COMMON_DATA_SETUP \
   std::vector<Real_ptr> vars = m_vars; \
   std::vector<Real_ptr> buffers = m_buffers; \
 \
   Index_type num_neighbors = s_num_neighbors; \
   Index_type num_vars = m_num_vars; \
-  std::vector<Int_ptr> pack_index_lists = m_pack_index_lists; \
   std::vector<Index_type> pack_index_list_lengths = m_pack_index_list_lengths; \
-  std::vector<Int_ptr> unpack_index_lists = m_unpack_index_lists; \
   std::vector<Index_type> unpack_index_list_lengths = m_unpack_index_list_lengths;
 
+#define HALOEXCHANGE_DATA_SETUP \
+  HALOEXCHANGE_COMMON_DATA_SETUP \
+  std::vector<Int_ptr> pack_index_lists = m_pack_index_lists; \
+  std::vector<Int_ptr> unpack_index_lists = m_unpack_index_lists;
+
 #define HALOEXCHANGE_PACK_BODY \
   buffer[i] = var[list[i]];
 
 #define HALOEXCHANGE_UNPACK_BODY \
   var[list[i]] = buffer[i];
 
+#define HALOEXCHANGE_RUN_SETUP \
+  const Index_type var_start = runs[3*r]; \
+  const Index_type buffer_start = runs[3*r + 1]; \
+  const Index_type run_len = runs[3*r + 2];
+
+#define HALOEXCHANGE_PACK_RUN_BODY \
+  HALOEXCHANGE_RUN_SETUP \
+  if (use_memcpy) { \
+    std::memcpy(buffer + buffer_start, var + var_start, \
+                run_len*sizeof(Real_type)); \
+  } else { \
+    for (Index_type i = 0; i < run_len; i++) { \
+      buffer[buffer_start + i] = var[var_start + i]; \
+    } \
+  }
+
+#define HALOEXCHANGE_UNPACK_RUN_BODY \
+  HALOEXCHANGE_RUN_SETUP \
+  if (use_memcpy) { \
+    std::memcpy(var + var_start, buffer + buffer_start, \
+                run_len*sizeof(Real_type)); \
+  } else { \
+    for (Index_type i = 0; i < run_len; i++) { \
+      var[var_start + i] = buffer[buffer_start + i]; \
+    } \
+  }
+
 
 #include "common/KernelBase.hpp"
 
 #include "RAJA/RAJA.hpp"
 
 #include <vector>
+#include <cstring>
 
 namespace rajaperf
 {
@@ -94,8 +135,24 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename Loop_T, typename List_T >
+  void runSeqVariantImpl(VariantID vid,
+                         std::vector<List_T*> const& pack_index_lists,
+                         std::vector<List_T*> const& unpack_index_lists);
+  template < typename Loop_T, typename List_T >
+  void runOpenMPVariantImpl(VariantID vid,
+                            std::vector<List_T*> const& pack_index_lists,
+                            std::vector<List_T*> const& unpack_index_lists);
+  template < bool use_memcpy >
+  void runSeqVariantRuns(VariantID vid);
+  template < bool use_memcpy >
+  void runOpenMPVariantRuns(VariantID vid);
+  void runOpenMPVariantTaskloop(VariantID vid, Index_type grainsize);
+  void runOpenMPVariantTaskgraph(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -127,20 +184,57 @@ private:
   std::vector<Int_ptr> m_unpack_index_lists;
   std::vector<Index_type > m_unpack_index_list_lengths;
 
-  void create_pack_lists(std::vector<Int_ptr>& pack_index_lists,
+  // index lists used by the tunings with Index_type index lists
+  std::vector<Index_ptr> m_pack_index_lists_64;
+  std::vector<Index_ptr> m_unpack_index_lists_64;
+
+  bool usesIndexLists64(VariantID vid, size_t tune_idx) const
+  {
+    return isIndexTuning<Index_type, Index_type>(vid, tune_idx) ||
+           isIndexTuning<Int_type, Index_type>(vid, tune_idx);
+  }
+
+  // (var start, buffer start, length) triples of the unit-stride runs in
+  // each index list, used by the runs tunings
+  std::vector<Index_ptr> m_pack_runs;
+  std::vector<Index_type > m_pack_run_counts;
+  std::vector<Index_ptr> m_unpack_runs;
+  std::vector<Index_type > m_unpack_run_counts;
+
+  bool usesRuns(VariantID vid, size_t tune_idx) const
+  {
+    const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+    return tuning_name == "runs" || tuning_name == "runs_memcpy";
+  }
+
+  void create_runs(std::vector<Index_ptr>& runs,
+                   std::vector<Index_type >& run_counts,
+                   std::vector<Int_ptr> const& index_lists,
+                   std::vector<Index_type > const& index_list_lengths,
+                   const Index_type num_neighbors,
+                   VariantID vid);
+  void destroy_runs(std::vector<Index_ptr>& runs,
+                    const Index_type num_neighbors,
+                    VariantID vid);
+
+  template < typename List_T >
+  void create_pack_lists(std::vector<List_T*>& pack_index_lists,
                          std::vector<Index_type >& pack_index_list_lengths,
                          const Index_type halo_width, const Index_type* grid_dims,
                          const Index_type num_neighbors,
                          VariantID vid);
-  void destroy_pack_lists(std::vector<Int_ptr>& pack_index_lists,
+  template < typename List_T >
+  void destroy_pack_lists(std::vector<List_T*>& pack_index_lists,
                           const Index_type num_neighbors,
                           VariantID vid);
-  void create_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
+  template < typename List_T >
+  void create_unpack_lists(std::vector<List_T*>& unpack_index_lists,
                            std::vector<Index_type >& unpack_index_list_lengths,
                            const Index_type halo_width, const Index_type* grid_dims,
                            const Index_type num_neighbors,
                            VariantID vid);
-  void destroy_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
+  template < typename List_T >
+  void destroy_unpack_lists(std::vector<List_T*>& unpack_index_lists,
                             const Index_type num_neighbors,
                             VariantID vid);
 };
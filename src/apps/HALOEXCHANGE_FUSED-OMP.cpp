@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,19 +20,22 @@ namespace apps
 {
 
 
-void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Loop_T, typename List_T >
+void HALOEXCHANGE_FUSED::runOpenMPVariantImpl(VariantID vid,
+                                              std::vector<List_T*> const& pack_index_lists,
+                                              std::vector<List_T*> const& unpack_index_lists)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
   const Index_type run_reps = getRunReps();
 
-  HALOEXCHANGE_FUSED_DATA_SETUP;
+  HALOEXCHANGE_FUSED_COMMON_DATA_SETUP;
 
   switch ( vid ) {
 
     case Base_OpenMP : {
 
-      HALOEXCHANGE_FUSED_MANUAL_FUSER_SETUP;
+      HALOEXCHANGE_FUSED_MANUAL_FUSER_SETUP_T(Loop_T, List_T);
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -39,8 +44,8 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
+          List_T* list = pack_index_lists[l];
+          Loop_T len = pack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
             pack_ptr_holders[pack_index] = ptr_holder{buffer, list, var};
@@ -56,10 +61,10 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
           #pragma omp task firstprivate(j)
           {
             Real_ptr   buffer = pack_ptr_holders[j].buffer;
-            Int_ptr    list   = pack_ptr_holders[j].list;
+            List_T*    list   = pack_ptr_holders[j].list;
             Real_ptr   var    = pack_ptr_holders[j].var;
-            Index_type len    = pack_lens[j];
-            for (Index_type i = 0; i < len; i++) {
+            Loop_T     len    = pack_lens[j];
+            for (Loop_T i = 0; i < len; i++) {
               HALOEXCHANGE_FUSED_PACK_BODY;
             }
           }
@@ -68,10 +73,10 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
         #pragma omp parallel for
         for (Index_type j = 0; j < pack_index; j++) {
           Real_ptr   buffer = pack_ptr_holders[j].buffer;
-          Int_ptr    list   = pack_ptr_holders[j].list;
+          List_T*    list   = pack_ptr_holders[j].list;
           Real_ptr   var    = pack_ptr_holders[j].var;
-          Index_type len    = pack_lens[j];
-          for (Index_type i = 0; i < len; i++) {
+          Loop_T     len    = pack_lens[j];
+          for (Loop_T i = 0; i < len; i++) {
             HALOEXCHANGE_FUSED_PACK_BODY;
           }
         }
@@ -81,8 +86,8 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
+          List_T* list = unpack_index_lists[l];
+          Loop_T len = unpack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
             unpack_ptr_holders[unpack_index] = ptr_holder{buffer, list, var};
@@ -98,10 +103,10 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
           #pragma omp task firstprivate(j)
           {
             Real_ptr   buffer = unpack_ptr_holders[j].buffer;
-            Int_ptr    list   = unpack_ptr_holders[j].list;
+            List_T*    list   = unpack_ptr_holders[j].list;
             Real_ptr   var    = unpack_ptr_holders[j].var;
-            Index_type len    = unpack_lens[j];
-            for (Index_type i = 0; i < len; i++) {
+            Loop_T     len    = unpack_lens[j];
+            for (Loop_T i = 0; i < len; i++) {
               HALOEXCHANGE_FUSED_UNPACK_BODY;
             }
           }
@@ -110,10 +115,10 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
         #pragma omp parallel for
         for (Index_type j = 0; j < unpack_index; j++) {
           Real_ptr   buffer = unpack_ptr_holders[j].buffer;
-          Int_ptr    list   = unpack_ptr_holders[j].list;
+          List_T*    list   = unpack_ptr_holders[j].list;
           Real_ptr   var    = unpack_ptr_holders[j].var;
-          Index_type len    = unpack_lens[j];
-          for (Index_type i = 0; i < len; i++) {
+          Loop_T     len    = unpack_lens[j];
+          for (Loop_T i = 0; i < len; i++) {
             HALOEXCHANGE_FUSED_UNPACK_BODY;
           }
         }
@@ -129,7 +134,7 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 
     case Lambda_OpenMP : {
 
-      HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_SETUP;
+      HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_SETUP_T(Loop_T, List_T);
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -138,8 +143,8 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
+          List_T* list = pack_index_lists[l];
+          Loop_T len = pack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
             new(&pack_lambdas[pack_index]) pack_lambda_type(make_pack_lambda(buffer, list, var));
@@ -155,8 +160,8 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
           #pragma omp task firstprivate(j)
           {
             auto       pack_lambda = pack_lambdas[j];
-            Index_type len         = pack_lens[j];
-            for (Index_type i = 0; i < len; i++) {
+            Loop_T     len         = pack_lens[j];
+            for (Loop_T i = 0; i < len; i++) {
               pack_lambda(i);
             }
           }
@@ -165,8 +170,8 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
         #pragma omp parallel for
         for (Index_type j = 0; j < pack_index; j++) {
           auto       pack_lambda = pack_lambdas[j];
-          Index_type len         = pack_lens[j];
-          for (Index_type i = 0; i < len; i++) {
+          Loop_T     len         = pack_lens[j];
+          for (Loop_T i = 0; i < len; i++) {
             pack_lambda(i);
           }
         }
@@ -176,8 +181,8 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
+          List_T* list = unpack_index_lists[l];
+          Loop_T len = unpack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
             new(&unpack_lambdas[unpack_index]) unpack_lambda_type(make_unpack_lambda(buffer, list, var));
@@ -193,8 +198,8 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
           #pragma omp task firstprivate(j)
           {
             auto       unpack_lambda = unpack_lambdas[j];
-            Index_type len           = unpack_lens[j];
-            for (Index_type i = 0; i < len; i++) {
+            Loop_T     len           = unpack_lens[j];
+            for (Loop_T i = 0; i < len; i++) {
               unpack_lambda(i);
             }
           }
@@ -203,8 +208,8 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
         #pragma omp parallel for
         for (Index_type j = 0; j < unpack_index; j++) {
           auto       unpack_lambda = unpack_lambdas[j];
-          Index_type len           = unpack_lens[j];
-          for (Index_type i = 0; i < len; i++) {
+          Loop_T     len           = unpack_lens[j];
+          for (Loop_T i = 0; i < len; i++) {
             unpack_lambda(i);
           }
         }
@@ -232,17 +237,17 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
                                    RAJA::constant_stride_array_of_objects >;
 
       using workpool = RAJA::WorkPool< workgroup_policy,
-                                       Index_type,
+                                       Loop_T,
                                        RAJA::xargs<>,
                                        Allocator >;
 
       using workgroup = RAJA::WorkGroup< workgroup_policy,
-                                         Index_type,
+                                         Loop_T,
                                          RAJA::xargs<>,
                                          Allocator >;
 
       using worksite = RAJA::WorkSite< workgroup_policy,
-                                       Index_type,
+                                       Loop_T,
                                        RAJA::xargs<>,
                                        Allocator >;
 
@@ -256,15 +261,15 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
+          List_T* list = pack_index_lists[l];
+          Loop_T len = pack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_fused_pack_base_lam = [=](Index_type i) {
+            auto haloexchange_fused_pack_base_lam = [=](Loop_T i) {
                   HALOEXCHANGE_FUSED_PACK_BODY;
                 };
             pool_pack.enqueue(
-                RAJA::TypedRangeSegment<Index_type>(0, len),
+                RAJA::TypedRangeSegment<Loop_T>(0, len),
                 haloexchange_fused_pack_base_lam );
             buffer += len;
           }
@@ -274,15 +279,15 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
+          List_T* list = unpack_index_lists[l];
+          Loop_T len = unpack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_fused_unpack_base_lam = [=](Index_type i) {
+            auto haloexchange_fused_unpack_base_lam = [=](Loop_T i) {
                   HALOEXCHANGE_FUSED_UNPACK_BODY;
                 };
             pool_unpack.enqueue(
-                RAJA::TypedRangeSegment<Index_type>(0, len),
+                RAJA::TypedRangeSegment<Loop_T>(0, len),
                 haloexchange_fused_unpack_base_lam );
             buffer += len;
           }
@@ -304,6 +309,531 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(pack_index_lists);
+  RAJA_UNUSED_VAR(unpack_index_lists);
+#endif
+}
+
+void HALOEXCHANGE_FUSED::runOpenMPVariantPlan(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_FUSED_COMMON_DATA_SETUP;
+  HALOEXCHANGE_FUSED_PLAN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if _OPENMP >= 200805
+        #pragma omp parallel
+        #pragma omp single nowait
+        for (Index_type j = 0; j < num_pack_items; j++) {
+          #pragma omp task firstprivate(j)
+          {
+            Real_ptr   buffer = pack_plan[j].buffer;
+            Int_ptr    list   = pack_plan[j].list;
+            Real_ptr   var    = pack_plan[j].var;
+            Index_type len    = pack_plan[j].len;
+            for (Index_type i = 0; i < len; i++) {
+              HALOEXCHANGE_FUSED_PACK_BODY;
+            }
+          }
+        }
+#else
+        #pragma omp parallel for
+        for (Index_type j = 0; j < num_pack_items; j++) {
+          Real_ptr   buffer = pack_plan[j].buffer;
+          Int_ptr    list   = pack_plan[j].list;
+          Real_ptr   var    = pack_plan[j].var;
+          Index_type len    = pack_plan[j].len;
+          for (Index_type i = 0; i < len; i++) {
+            HALOEXCHANGE_FUSED_PACK_BODY;
+          }
+        }
+#endif
+
+#if _OPENMP >= 200805
+        #pragma omp parallel
+        #pragma omp single nowait
+        for (Index_type j = 0; j < num_unpack_items; j++) {
+          #pragma omp task firstprivate(j)
+          {
+            Real_ptr   buffer = unpack_plan[j].buffer;
+            Int_ptr    list   = unpack_plan[j].list;
+            Real_ptr   var    = unpack_plan[j].var;
+            Index_type len    = unpack_plan[j].len;
+            for (Index_type i = 0; i < len; i++) {
+              HALOEXCHANGE_FUSED_UNPACK_BODY;
+            }
+          }
+        }
+#else
+        #pragma omp parallel for
+        for (Index_type j = 0; j < num_unpack_items; j++) {
+          Real_ptr   buffer = unpack_plan[j].buffer;
+          Int_ptr    list   = unpack_plan[j].list;
+          Real_ptr   var    = unpack_plan[j].var;
+          Index_type len    = unpack_plan[j].len;
+          for (Index_type i = 0; i < len; i++) {
+            HALOEXCHANGE_FUSED_UNPACK_BODY;
+          }
+        }
+#endif
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_SETUP;
+
+      for (Index_type j = 0; j < num_pack_items; j++) {
+        new(&pack_lambdas[j]) pack_lambda_type(make_pack_lambda(
+            pack_plan[j].buffer, pack_plan[j].list, pack_plan[j].var));
+        pack_lens[j] = pack_plan[j].len;
+      }
+      for (Index_type j = 0; j < num_unpack_items; j++) {
+        new(&unpack_lambdas[j]) unpack_lambda_type(make_unpack_lambda(
+            unpack_plan[j].buffer, unpack_plan[j].list, unpack_plan[j].var));
+        unpack_lens[j] = unpack_plan[j].len;
+      }
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if _OPENMP >= 200805
+        #pragma omp parallel
+        #pragma omp single nowait
+        for (Index_type j = 0; j < num_pack_items; j++) {
+          #pragma omp task firstprivate(j)
+          {
+            auto       pack_lambda = pack_lambdas[j];
+            Index_type len         = pack_lens[j];
+            for (Index_type i = 0; i < len; i++) {
+              pack_lambda(i);
+            }
+          }
+        }
+#else
+        #pragma omp parallel for
+        for (Index_type j = 0; j < num_pack_items; j++) {
+          auto       pack_lambda = pack_lambdas[j];
+          Index_type len         = pack_lens[j];
+          for (Index_type i = 0; i < len; i++) {
+            pack_lambda(i);
+          }
+        }
+#endif
+
+#if _OPENMP >= 200805
+        #pragma omp parallel
+        #pragma omp single nowait
+        for (Index_type j = 0; j < num_unpack_items; j++) {
+          #pragma omp task firstprivate(j)
+          {
+            auto       unpack_lambda = unpack_lambdas[j];
+            Index_type len           = unpack_lens[j];
+            for (Index_type i = 0; i < len; i++) {
+              unpack_lambda(i);
+            }
+          }
+        }
+#else
+        #pragma omp parallel for
+        for (Index_type j = 0; j < num_unpack_items; j++) {
+          auto       unpack_lambda = unpack_lambdas[j];
+          Index_type len           = unpack_lens[j];
+          for (Index_type i = 0; i < len; i++) {
+            unpack_lambda(i);
+          }
+        }
+#endif
+
+      }
+      stopTimer();
+
+      HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_TEARDOWN;
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using AllocatorHolder = RAJAPoolAllocatorHolder<
+        RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>>;
+      using Allocator = AllocatorHolder::Allocator<char>;
+
+      AllocatorHolder allocatorHolder;
+
+      using workgroup_policy = RAJA::WorkGroupPolicy <
+                                   RAJA::omp_work,
+                                   RAJA::ordered,
+                                   RAJA::constant_stride_array_of_objects >;
+
+      using workpool = RAJA::WorkPool< workgroup_policy,
+                                       Index_type,
+                                       RAJA::xargs<>,
+                                       Allocator >;
+
+      using workgroup = RAJA::WorkGroup< workgroup_policy,
+                                         Index_type,
+                                         RAJA::xargs<>,
+                                         Allocator >;
+
+      using worksite = RAJA::WorkSite< workgroup_policy,
+                                       Index_type,
+                                       RAJA::xargs<>,
+                                       Allocator >;
+
+      workpool pool_pack  (allocatorHolder.template getAllocator<char>());
+      workpool pool_unpack(allocatorHolder.template getAllocator<char>());
+      pool_pack.reserve(num_pack_items, 1024ull*1024ull);
+      pool_unpack.reserve(num_unpack_items, 1024ull*1024ull);
+
+      for (Index_type j = 0; j < num_pack_items; j++) {
+        Real_ptr buffer = pack_plan[j].buffer;
+        Int_ptr  list   = pack_plan[j].list;
+        Real_ptr var    = pack_plan[j].var;
+        auto haloexchange_fused_pack_base_lam = [=](Index_type i) {
+              HALOEXCHANGE_FUSED_PACK_BODY;
+            };
+        pool_pack.enqueue(
+            RAJA::TypedRangeSegment<Index_type>(0, pack_plan[j].len),
+            haloexchange_fused_pack_base_lam );
+      }
+      workgroup group_pack = pool_pack.instantiate();
+
+      for (Index_type j = 0; j < num_unpack_items; j++) {
+        Real_ptr buffer = unpack_plan[j].buffer;
+        Int_ptr  list   = unpack_plan[j].list;
+        Real_ptr var    = unpack_plan[j].var;
+        auto haloexchange_fused_unpack_base_lam = [=](Index_type i) {
+              HALOEXCHANGE_FUSED_UNPACK_BODY;
+            };
+        pool_unpack.enqueue(
+            RAJA::TypedRangeSegment<Index_type>(0, unpack_plan[j].len),
+            haloexchange_fused_unpack_base_lam );
+      }
+      workgroup group_unpack = pool_unpack.instantiate();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        worksite site_pack = group_pack.run();
+
+        worksite site_unpack = group_unpack.run();
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALOEXCHANGE_FUSED : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HALOEXCHANGE_FUSED::runOpenMPVariantTaskloop(VariantID vid, Index_type grainsize)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_FUSED_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    HALOEXCHANGE_FUSED_MANUAL_FUSER_SETUP;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Index_type pack_index = 0;
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        Int_ptr list = pack_index_lists[l];
+        Index_type  len  = pack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          pack_ptr_holders[pack_index] = ptr_holder{buffer, list, var};
+          pack_lens[pack_index] = len;
+          pack_index += 1;
+          buffer += len;
+        }
+      }
+
+      Index_type unpack_index = 0;
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        Int_ptr list = unpack_index_lists[l];
+        Index_type  len  = unpack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          unpack_ptr_holders[unpack_index] = ptr_holder{buffer, list, var};
+          unpack_lens[unpack_index] = len;
+          unpack_index += 1;
+          buffer += len;
+        }
+      }
+
+      #pragma omp parallel
+      #pragma omp single nowait
+      {
+        for (Index_type j = 0; j < pack_index; j++) {
+          Real_ptr   buffer = pack_ptr_holders[j].buffer;
+          Int_ptr    list   = pack_ptr_holders[j].list;
+          Real_ptr   var    = pack_ptr_holders[j].var;
+          Index_type len    = pack_lens[j];
+          #pragma omp taskloop grainsize(grainsize) nogroup
+          for (Index_type i = 0; i < len; i++) {
+            HALOEXCHANGE_FUSED_PACK_BODY;
+          }
+        }
+
+        #pragma omp taskwait
+
+        for (Index_type j = 0; j < unpack_index; j++) {
+          Real_ptr   buffer = unpack_ptr_holders[j].buffer;
+          Int_ptr    list   = unpack_ptr_holders[j].list;
+          Real_ptr   var    = unpack_ptr_holders[j].var;
+          Index_type len    = unpack_lens[j];
+          #pragma omp taskloop grainsize(grainsize) nogroup
+          for (Index_type i = 0; i < len; i++) {
+            HALOEXCHANGE_FUSED_UNPACK_BODY;
+          }
+        }
+      }
+
+    }
+    stopTimer();
+
+    HALOEXCHANGE_FUSED_MANUAL_FUSER_TEARDOWN;
+
+  } else {
+
+    getCout() << "\n HALOEXCHANGE_FUSED : Unknown OpenMP taskloop variant id = " << vid << std::endl;
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(grainsize);
+#endif
+}
+
+void HALOEXCHANGE_FUSED::runOpenMPVariantTaskgraph(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_FUSED_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    HALOEXCHANGE_FUSED_MANUAL_FUSER_SETUP;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Index_type pack_index = 0;
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        Int_ptr list = pack_index_lists[l];
+        Index_type  len  = pack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          pack_ptr_holders[pack_index] = ptr_holder{buffer, list, var};
+          pack_lens[pack_index] = len;
+          pack_index += 1;
+          buffer += len;
+        }
+      }
+
+      Index_type unpack_index = 0;
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        Int_ptr list = unpack_index_lists[l];
+        Index_type  len  = unpack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          unpack_ptr_holders[unpack_index] = ptr_holder{buffer, list, var};
+          unpack_lens[unpack_index] = len;
+          unpack_index += 1;
+          buffer += len;
+        }
+      }
+
+      // The pack and unpack tasks for a message share its buffer, so each
+      // unpack starts as soon as its own pack is done.
+      #pragma omp parallel
+      #pragma omp single nowait
+      {
+        for (Index_type j = 0; j < pack_index; j++) {
+          Real_ptr buffer = pack_ptr_holders[j].buffer;
+          #pragma omp task firstprivate(j, buffer) depend(out: buffer[0])
+          {
+            Int_ptr    list   = pack_ptr_holders[j].list;
+            Real_ptr   var    = pack_ptr_holders[j].var;
+            Index_type len    = pack_lens[j];
+            for (Index_type i = 0; i < len; i++) {
+              HALOEXCHANGE_FUSED_PACK_BODY;
+            }
+          }
+        }
+
+        for (Index_type j = 0; j < unpack_index; j++) {
+          Real_ptr buffer = unpack_ptr_holders[j].buffer;
+          #pragma omp task firstprivate(j, buffer) depend(in: buffer[0])
+          {
+            Int_ptr    list   = unpack_ptr_holders[j].list;
+            Real_ptr   var    = unpack_ptr_holders[j].var;
+            Index_type len    = unpack_lens[j];
+            for (Index_type i = 0; i < len; i++) {
+              HALOEXCHANGE_FUSED_UNPACK_BODY;
+            }
+          }
+        }
+      }
+
+    }
+    stopTimer();
+
+    HALOEXCHANGE_FUSED_MANUAL_FUSER_TEARDOWN;
+
+  } else {
+
+    getCout() << "\n HALOEXCHANGE_FUSED : Unknown OpenMP taskgraph variant id = " << vid << std::endl;
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<Index_type, Int_type>(vid, m_pack_index_lists, m_unpack_index_lists);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<Int_type, Int_type>(vid, m_pack_index_lists, m_unpack_index_lists);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<Index_type, Index_type>(vid, m_pack_index_lists_64, m_unpack_index_lists_64);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<Int_type, Index_type>(vid, m_pack_index_lists_64, m_unpack_index_lists_64);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantPlan(vid);
+
+  }
+
+  t += 1;
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  if (vid == Base_OpenMP) {
+
+    for (Index_type grainsize : omp_task::taskloop_grainsizes) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantTaskloop(vid, grainsize);
+
+      }
+
+      t += 1;
+
+    }
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantTaskgraph(vid);
+
+    }
+
+    t += 1;
+
+  }
+
+#endif
+}
+
+void HALOEXCHANGE_FUSED::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  addVariantTuningName(vid, getIndexTuningName<Int_type, Int_type>(),
+                       getDefaultTuningName());
+  addVariantTuningName(vid, getIndexTuningName<Index_type, Index_type>(),
+                       getDefaultTuningName());
+  addVariantTuningName(vid, getIndexTuningName<Int_type, Index_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, "persistent_plan");
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  if (vid == Base_OpenMP) {
+
+    for (Index_type grainsize : omp_task::taskloop_grainsizes) {
+      addVariantTuningName(vid, omp_task::taskloop_tuning_name(grainsize));
+    }
+
+    addVariantTuningName(vid, "taskgraph");
+
+  }
+
 #endif
 }
 
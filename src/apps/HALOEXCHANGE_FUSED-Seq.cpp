@@ -18,17 +18,20 @@ namespace apps
 {
 
 
-void HALOEXCHANGE_FUSED::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Loop_T, typename List_T >
+void HALOEXCHANGE_FUSED::runSeqVariantImpl(VariantID vid,
+                                           std::vector<List_T*> const& pack_index_lists,
+                                           std::vector<List_T*> const& unpack_index_lists)
 {
   const Index_type run_reps = getRunReps();
 
-  HALOEXCHANGE_FUSED_DATA_SETUP;
+  HALOEXCHANGE_FUSED_COMMON_DATA_SETUP;
 
   switch ( vid ) {
 
     case Base_Seq : {
 
-      HALOEXCHANGE_FUSED_MANUAL_FUSER_SETUP;
+      HALOEXCHANGE_FUSED_MANUAL_FUSER_SETUP_T(Loop_T, List_T);
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -37,8 +40,8 @@ void HALOEXCHANGE_FUSED::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
+          List_T* list = pack_index_lists[l];
+          Loop_T len = pack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
             pack_ptr_holders[pack_index] = ptr_holder{buffer, list, var};
@@ -49,10 +52,10 @@ void HALOEXCHANGE_FUSED::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
         }
         for (Index_type j = 0; j < pack_index; j++) {
           Real_ptr   buffer = pack_ptr_holders[j].buffer;
-          Int_ptr    list   = pack_ptr_holders[j].list;
+          List_T*    list   = pack_ptr_holders[j].list;
           Real_ptr   var    = pack_ptr_holders[j].var;
-          Index_type len    = pack_lens[j];
-          for (Index_type i = 0; i < len; i++) {
+          Loop_T     len    = pack_lens[j];
+          for (Loop_T i = 0; i < len; i++) {
             HALOEXCHANGE_FUSED_PACK_BODY;
           }
         }
@@ -61,8 +64,8 @@ void HALOEXCHANGE_FUSED::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
+          List_T* list = unpack_index_lists[l];
+          Loop_T len = unpack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
             unpack_ptr_holders[unpack_index] = ptr_holder{buffer, list, var};
@@ -73,10 +76,10 @@ void HALOEXCHANGE_FUSED::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
         }
         for (Index_type j = 0; j < unpack_index; j++) {
           Real_ptr   buffer = unpack_ptr_holders[j].buffer;
-          Int_ptr    list   = unpack_ptr_holders[j].list;
+          List_T*    list   = unpack_ptr_holders[j].list;
           Real_ptr   var    = unpack_ptr_holders[j].var;
-          Index_type len    = unpack_lens[j];
-          for (Index_type i = 0; i < len; i++) {
+          Loop_T     len    = unpack_lens[j];
+          for (Loop_T i = 0; i < len; i++) {
             HALOEXCHANGE_FUSED_UNPACK_BODY;
           }
         }
@@ -92,7 +95,7 @@ void HALOEXCHANGE_FUSED::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
 #if defined(RUN_RAJA_SEQ)
     case Lambda_Seq : {
 
-      HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_SETUP;
+      HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_SETUP_T(Loop_T, List_T);
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -101,8 +104,8 @@ void HALOEXCHANGE_FUSED::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
+          List_T* list = pack_index_lists[l];
+          Loop_T len = pack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
             new(&pack_lambdas[pack_index]) pack_lambda_type(make_pack_lambda(buffer, list, var));
@@ -113,8 +116,8 @@ void HALOEXCHANGE_FUSED::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
         }
         for (Index_type j = 0; j < pack_index; j++) {
           auto       pack_lambda = pack_lambdas[j];
-          Index_type len         = pack_lens[j];
-          for (Index_type i = 0; i < len; i++) {
+          Loop_T     len         = pack_lens[j];
+          for (Loop_T i = 0; i < len; i++) {
             pack_lambda(i);
           }
         }
@@ -123,8 +126,8 @@ void HALOEXCHANGE_FUSED::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
+          List_T* list = unpack_index_lists[l];
+          Loop_T len = unpack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
             new(&unpack_lambdas[unpack_index]) unpack_lambda_type(make_unpack_lambda(buffer, list, var));
@@ -135,8 +138,8 @@ void HALOEXCHANGE_FUSED::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
         }
         for (Index_type j = 0; j < unpack_index; j++) {
           auto       unpack_lambda = unpack_lambdas[j];
-          Index_type len           = unpack_lens[j];
-          for (Index_type i = 0; i < len; i++) {
+          Loop_T     len           = unpack_lens[j];
+          for (Loop_T i = 0; i < len; i++) {
             unpack_lambda(i);
           }
         }
@@ -163,17 +166,17 @@ void HALOEXCHANGE_FUSED::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
                                    RAJA::constant_stride_array_of_objects >;
 
       using workpool = RAJA::WorkPool< workgroup_policy,
-                                       Index_type,
+                                       Loop_T,
                                        RAJA::xargs<>,
                                        Allocator >;
 
       using workgroup = RAJA::WorkGroup< workgroup_policy,
-                                         Index_type,
+                                         Loop_T,
                                          RAJA::xargs<>,
                                          Allocator >;
 
       using worksite = RAJA::WorkSite< workgroup_policy,
-                                       Index_type,
+                                       Loop_T,
                                        RAJA::xargs<>,
                                        Allocator >;
 
@@ -187,15 +190,15 @@ void HALOEXCHANGE_FUSED::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
+          List_T* list = pack_index_lists[l];
+          Loop_T len = pack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_fused_pack_base_lam = [=](Index_type i) {
+            auto haloexchange_fused_pack_base_lam = [=](Loop_T i) {
                   HALOEXCHANGE_FUSED_PACK_BODY;
                 };
             pool_pack.enqueue(
-                RAJA::TypedRangeSegment<Index_type>(0, len),
+                RAJA::TypedRangeSegment<Loop_T>(0, len),
                 haloexchange_fused_pack_base_lam );
             buffer += len;
           }
@@ -205,15 +208,15 @@ void HALOEXCHANGE_FUSED::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
 
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
-          Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
+          List_T* list = unpack_index_lists[l];
+          Loop_T len = unpack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_fused_unpack_base_lam = [=](Index_type i) {
+            auto haloexchange_fused_unpack_base_lam = [=](Loop_T i) {
                   HALOEXCHANGE_FUSED_UNPACK_BODY;
                 };
             pool_unpack.enqueue(
-                RAJA::TypedRangeSegment<Index_type>(0, len),
+                RAJA::TypedRangeSegment<Loop_T>(0, len),
                 haloexchange_fused_unpack_base_lam );
             buffer += len;
           }
@@ -236,5 +239,228 @@ void HALOEXCHANGE_FUSED::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
 
 }
 
+void HALOEXCHANGE_FUSED::runSeqVariantPlan(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_FUSED_COMMON_DATA_SETUP;
+  HALOEXCHANGE_FUSED_PLAN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type j = 0; j < num_pack_items; j++) {
+          Real_ptr   buffer = pack_plan[j].buffer;
+          Int_ptr    list   = pack_plan[j].list;
+          Real_ptr   var    = pack_plan[j].var;
+          Index_type len    = pack_plan[j].len;
+          for (Index_type i = 0; i < len; i++) {
+            HALOEXCHANGE_FUSED_PACK_BODY;
+          }
+        }
+
+        for (Index_type j = 0; j < num_unpack_items; j++) {
+          Real_ptr   buffer = unpack_plan[j].buffer;
+          Int_ptr    list   = unpack_plan[j].list;
+          Real_ptr   var    = unpack_plan[j].var;
+          Index_type len    = unpack_plan[j].len;
+          for (Index_type i = 0; i < len; i++) {
+            HALOEXCHANGE_FUSED_UNPACK_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_SETUP;
+
+      for (Index_type j = 0; j < num_pack_items; j++) {
+        new(&pack_lambdas[j]) pack_lambda_type(make_pack_lambda(
+            pack_plan[j].buffer, pack_plan[j].list, pack_plan[j].var));
+        pack_lens[j] = pack_plan[j].len;
+      }
+      for (Index_type j = 0; j < num_unpack_items; j++) {
+        new(&unpack_lambdas[j]) unpack_lambda_type(make_unpack_lambda(
+            unpack_plan[j].buffer, unpack_plan[j].list, unpack_plan[j].var));
+        unpack_lens[j] = unpack_plan[j].len;
+      }
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type j = 0; j < num_pack_items; j++) {
+          auto       pack_lambda = pack_lambdas[j];
+          Index_type len         = pack_lens[j];
+          for (Index_type i = 0; i < len; i++) {
+            pack_lambda(i);
+          }
+        }
+
+        for (Index_type j = 0; j < num_unpack_items; j++) {
+          auto       unpack_lambda = unpack_lambdas[j];
+          Index_type len           = unpack_lens[j];
+          for (Index_type i = 0; i < len; i++) {
+            unpack_lambda(i);
+          }
+        }
+
+      }
+      stopTimer();
+
+      HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_TEARDOWN;
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      using AllocatorHolder = RAJAPoolAllocatorHolder<
+        RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>>;
+      using Allocator = AllocatorHolder::Allocator<char>;
+
+      AllocatorHolder allocatorHolder;
+
+      using workgroup_policy = RAJA::WorkGroupPolicy <
+                                   RAJA::loop_work,
+                                   RAJA::ordered,
+                                   RAJA::constant_stride_array_of_objects >;
+
+      using workpool = RAJA::WorkPool< workgroup_policy,
+                                       Index_type,
+                                       RAJA::xargs<>,
+                                       Allocator >;
+
+      using workgroup = RAJA::WorkGroup< workgroup_policy,
+                                         Index_type,
+                                         RAJA::xargs<>,
+                                         Allocator >;
+
+      using worksite = RAJA::WorkSite< workgroup_policy,
+                                       Index_type,
+                                       RAJA::xargs<>,
+                                       Allocator >;
+
+      workpool pool_pack  (allocatorHolder.template getAllocator<char>());
+      workpool pool_unpack(allocatorHolder.template getAllocator<char>());
+      pool_pack.reserve(num_pack_items, 1024ull*1024ull);
+      pool_unpack.reserve(num_unpack_items, 1024ull*1024ull);
+
+      for (Index_type j = 0; j < num_pack_items; j++) {
+        Real_ptr buffer = pack_plan[j].buffer;
+        Int_ptr  list   = pack_plan[j].list;
+        Real_ptr var    = pack_plan[j].var;
+        auto haloexchange_fused_pack_base_lam = [=](Index_type i) {
+              HALOEXCHANGE_FUSED_PACK_BODY;
+            };
+        pool_pack.enqueue(
+            RAJA::TypedRangeSegment<Index_type>(0, pack_plan[j].len),
+            haloexchange_fused_pack_base_lam );
+      }
+      workgroup group_pack = pool_pack.instantiate();
+
+      for (Index_type j = 0; j < num_unpack_items; j++) {
+        Real_ptr buffer = unpack_plan[j].buffer;
+        Int_ptr  list   = unpack_plan[j].list;
+        Real_ptr var    = unpack_plan[j].var;
+        auto haloexchange_fused_unpack_base_lam = [=](Index_type i) {
+              HALOEXCHANGE_FUSED_UNPACK_BODY;
+            };
+        pool_unpack.enqueue(
+            RAJA::TypedRangeSegment<Index_type>(0, unpack_plan[j].len),
+            haloexchange_fused_unpack_base_lam );
+      }
+      workgroup group_unpack = pool_unpack.instantiate();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        worksite site_pack = group_pack.run();
+
+        worksite site_unpack = group_unpack.run();
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n HALOEXCHANGE_FUSED : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void HALOEXCHANGE_FUSED::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<Index_type, Int_type>(vid, m_pack_index_lists, m_unpack_index_lists);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<Int_type, Int_type>(vid, m_pack_index_lists, m_unpack_index_lists);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<Index_type, Index_type>(vid, m_pack_index_lists_64, m_unpack_index_lists_64);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<Int_type, Index_type>(vid, m_pack_index_lists_64, m_unpack_index_lists_64);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantPlan(vid);
+
+  }
+
+  t += 1;
+}
+
+void HALOEXCHANGE_FUSED::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getIndexTuningName<Int_type, Int_type>(),
+                       getDefaultTuningName());
+  addVariantTuningName(vid, getIndexTuningName<Index_type, Index_type>(),
+                       getDefaultTuningName());
+  addVariantTuningName(vid, getIndexTuningName<Int_type, Index_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, "persistent_plan");
+}
+
 } // end namespace apps
 } // end namespace rajaperf
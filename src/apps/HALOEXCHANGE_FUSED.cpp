@@ -52,10 +52,21 @@ HALOEXCHANGE_FUSED::HALOEXCHANGE_FUSED(const RunParams& params)
 
   setItsPerRep( m_num_vars * (m_var_size - getActualProblemSize()) );
   setKernelsPerRep( 2 );
-  setBytesPerRep( (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * getItsPerRep() +
-                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +
-                  (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * getItsPerRep() +
-                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() );
+  // bytes with index lists of entries of list_size bytes, the default
+  // tuning uses Int_type lists
+  auto list_bytes_per_rep = [&](size_t list_size) {
+    return (0*list_size         + 1*list_size        ) * getItsPerRep() +
+           (1*sizeof(Real_type)  + 1*sizeof(Real_type) ) * getItsPerRep() +
+           (0*list_size         + 1*list_size        ) * getItsPerRep() +
+           (1*sizeof(Real_type)  + 1*sizeof(Real_type) ) * getItsPerRep();
+  };
+  setBytesPerRep( list_bytes_per_rep(sizeof(Int_type)) );
+  setTuningBytesPerRep( getIndexTuningName<Int_type, Int_type>(),
+                        list_bytes_per_rep(sizeof(Int_type)) );
+  setTuningBytesPerRep( getIndexTuningName<Index_type, Index_type>(),
+                        list_bytes_per_rep(sizeof(Index_type)) );
+  setTuningBytesPerRep( getIndexTuningName<Int_type, Index_type>(),
+                        list_bytes_per_rep(sizeof(Index_type)) );
   setFLOPsPerRep(0);
 
   setUsesFeature(Workgroup);
@@ -82,7 +93,7 @@ HALOEXCHANGE_FUSED::~HALOEXCHANGE_FUSED()
 {
 }
 
-void HALOEXCHANGE_FUSED::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HALOEXCHANGE_FUSED::setUp(VariantID vid, size_t tune_idx)
 {
   m_vars.resize(m_num_vars, nullptr);
   for (Index_type v = 0; v < m_num_vars; ++v) {
@@ -96,19 +107,37 @@ void HALOEXCHANGE_FUSED::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
     }
   }
 
-  m_pack_index_lists.resize(s_num_neighbors, nullptr);
   m_pack_index_list_lengths.resize(s_num_neighbors, 0);
-  create_pack_lists(m_pack_index_lists, m_pack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
-
-  m_unpack_index_lists.resize(s_num_neighbors, nullptr);
   m_unpack_index_list_lengths.resize(s_num_neighbors, 0);
-  create_unpack_lists(m_unpack_index_lists, m_unpack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+
+  if ( usesIndexLists64(vid, tune_idx) ) {
+
+    m_pack_index_lists_64.resize(s_num_neighbors, nullptr);
+    create_pack_lists(m_pack_index_lists_64, m_pack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+
+    m_unpack_index_lists_64.resize(s_num_neighbors, nullptr);
+    create_unpack_lists(m_unpack_index_lists_64, m_unpack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+
+  } else {
+
+    m_pack_index_lists.resize(s_num_neighbors, nullptr);
+    create_pack_lists(m_pack_index_lists, m_pack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+
+    m_unpack_index_lists.resize(s_num_neighbors, nullptr);
+    create_unpack_lists(m_unpack_index_lists, m_unpack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+
+  }
 
   m_buffers.resize(s_num_neighbors, nullptr);
   for (Index_type l = 0; l < s_num_neighbors; ++l) {
     Index_type buffer_len = m_num_vars * m_pack_index_list_lengths[l];
     allocAndInitData(m_buffers[l], buffer_len, vid);
   }
+
+  if ( usesPersistentPlan(vid, tune_idx) ) {
+    create_plan(m_pack_plan, m_pack_index_lists, m_pack_index_list_lengths);
+    create_plan(m_unpack_plan, m_unpack_index_lists, m_unpack_index_list_lengths);
+  }
 }
 
 void HALOEXCHANGE_FUSED::updateChecksum(VariantID vid, size_t tune_idx)
@@ -118,20 +147,35 @@ void HALOEXCHANGE_FUSED::updateChecksum(VariantID vid, size_t tune_idx)
   }
 }
 
-void HALOEXCHANGE_FUSED::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HALOEXCHANGE_FUSED::tearDown(VariantID vid, size_t tune_idx)
 {
+  m_unpack_plan.clear();
+  m_pack_plan.clear();
+
   for (int l = 0; l < s_num_neighbors; ++l) {
     deallocData(m_buffers[l], vid);
   }
   m_buffers.clear();
 
-  destroy_unpack_lists(m_unpack_index_lists, s_num_neighbors, vid);
-  m_unpack_index_list_lengths.clear();
-  m_unpack_index_lists.clear();
+  if ( usesIndexLists64(vid, tune_idx) ) {
+
+    destroy_unpack_lists(m_unpack_index_lists_64, s_num_neighbors, vid);
+    m_unpack_index_lists_64.clear();
+
+    destroy_pack_lists(m_pack_index_lists_64, s_num_neighbors, vid);
+    m_pack_index_lists_64.clear();
 
-  destroy_pack_lists(m_pack_index_lists, s_num_neighbors, vid);
+  } else {
+
+    destroy_unpack_lists(m_unpack_index_lists, s_num_neighbors, vid);
+    m_unpack_index_lists.clear();
+
+    destroy_pack_lists(m_pack_index_lists, s_num_neighbors, vid);
+    m_pack_index_lists.clear();
+
+  }
+  m_unpack_index_list_lengths.clear();
   m_pack_index_list_lengths.clear();
-  m_pack_index_lists.clear();
 
   for (int v = 0; v < m_num_vars; ++v) {
     deallocData(m_vars[v], vid);
@@ -139,6 +183,29 @@ void HALOEXCHANGE_FUSED::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
   m_vars.clear();
 }
 
+//
+// Function to generate the fused loops of the persistent plan, one per
+// neighbor and variable in the order of the buffers.
+//
+void HALOEXCHANGE_FUSED::create_plan(
+    std::vector<plan_item>& plan,
+    std::vector<Int_ptr> const& index_lists,
+    std::vector<Index_type > const& index_list_lengths)
+{
+  plan.clear();
+  plan.reserve(s_num_neighbors * m_num_vars);
+
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    Real_ptr buffer = m_buffers[l];
+    Int_ptr list = index_lists[l];
+    Index_type len = index_list_lengths[l];
+    for (Index_type v = 0; v < m_num_vars; ++v) {
+      plan.push_back(plan_item{buffer, list, m_vars[v], len});
+      buffer += len;
+    }
+  }
+}
+
 namespace {
 
 struct Extent
@@ -156,8 +223,9 @@ struct Extent
 //
 // Function to generate index lists for packing.
 //
+template < typename List_T >
 void HALOEXCHANGE_FUSED::create_pack_lists(
-    std::vector<Int_ptr>& pack_index_lists,
+    std::vector<List_T*>& pack_index_lists,
     std::vector<Index_type >& pack_index_list_lengths,
     const Index_type halo_width, const Index_type* grid_dims,
     const Index_type num_neighbors,
@@ -264,7 +332,7 @@ void HALOEXCHANGE_FUSED::create_pack_lists(
     allocAndInitData(pack_index_lists[l], pack_index_list_lengths[l], vid);
     auto reset_list = scopedMoveData(pack_index_lists[l], pack_index_list_lengths[l], vid);
 
-    Int_ptr pack_list = pack_index_lists[l];
+    List_T* pack_list = pack_index_lists[l];
 
     Index_type list_idx = 0;
     for (Index_type kk = extent.k_min; kk < extent.k_max; ++kk) {
@@ -287,8 +355,9 @@ void HALOEXCHANGE_FUSED::create_pack_lists(
 //
 // Function to destroy packing index lists.
 //
+template < typename List_T >
 void HALOEXCHANGE_FUSED::destroy_pack_lists(
-    std::vector<Int_ptr>& pack_index_lists,
+    std::vector<List_T*>& pack_index_lists,
     const Index_type num_neighbors,
     VariantID vid)
 {
@@ -302,8 +371,9 @@ void HALOEXCHANGE_FUSED::destroy_pack_lists(
 //
 // Function to generate index lists for unpacking.
 //
+template < typename List_T >
 void HALOEXCHANGE_FUSED::create_unpack_lists(
-    std::vector<Int_ptr>& unpack_index_lists,
+    std::vector<List_T*>& unpack_index_lists,
     std::vector<Index_type >& unpack_index_list_lengths,
     const Index_type halo_width, const Index_type* grid_dims,
     const Index_type num_neighbors,
@@ -410,7 +480,7 @@ void HALOEXCHANGE_FUSED::create_unpack_lists(
     allocAndInitData(unpack_index_lists[l], unpack_index_list_lengths[l], vid);
     auto reset_list = scopedMoveData(unpack_index_lists[l], unpack_index_list_lengths[l], vid);
 
-    Int_ptr unpack_list = unpack_index_lists[l];
+    List_T* unpack_list = unpack_index_lists[l];
 
     Index_type list_idx = 0;
     for (Index_type kk = extent.k_min; kk < extent.k_max; ++kk) {
@@ -433,8 +503,9 @@ void HALOEXCHANGE_FUSED::create_unpack_lists(
 //
 // Function to destroy unpacking index lists.
 //
+template < typename List_T >
 void HALOEXCHANGE_FUSED::destroy_unpack_lists(
-    std::vector<Int_ptr>& unpack_index_lists,
+    std::vector<List_T*>& unpack_index_lists,
     const Index_type num_neighbors,
     VariantID vid)
 {
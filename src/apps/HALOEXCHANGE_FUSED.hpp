@@ -41,31 +41,48 @@
 ///   }
 /// }
 ///
+/// The default tuning uses Index_type loop indices and Int_type index
+/// lists; the "loop<bits>_list<bits>" tunings of the Seq and OpenMP variants
+/// use other combinations of 32-bit (Int_type) and 64-bit (Index_type)
+/// loop indices and index lists.
+///
+/// The "persistent_plan" tuning of the Seq and OpenMP variants builds the
+/// list of fused pack and unpack loops once in setUp, like an application
+/// that plans its exchange once per mesh, and only executes it every rep.
+/// The Lambda and RAJA variants build their lambdas and workgroups from
+/// that plan once before the timed reps.
+///
 
 #ifndef RAJAPerf_Apps_HALOEXCHANGE_FUSED_HPP
 #define RAJAPerf_Apps_HALOEXCHANGE_FUSED_HPP
 
-#define HALOEXCHANGE_FUSED_DATA_SETUP \
+#define HALOEXCHANGE_FUSED_COMMON_DATA_SETUP \
   std::vector<Real_ptr> vars = m_vars; \
   std::vector<Real_ptr> buffers = m_buffers; \
 \
   Index_type num_neighbors = s_num_neighbors; \
   Index_type num_vars = m_num_vars; \
-  std::vector<Int_ptr> pack_index_lists = m_pack_index_lists; \
   std::vector<Index_type> pack_index_list_lengths = m_pack_index_list_lengths; \
-  std::vector<Int_ptr> unpack_index_lists = m_unpack_index_lists; \
   std::vector<Index_type> unpack_index_list_lengths = m_unpack_index_list_lengths;
 
-#define HALOEXCHANGE_FUSED_MANUAL_FUSER_SETUP \
+#define HALOEXCHANGE_FUSED_DATA_SETUP \
+  HALOEXCHANGE_FUSED_COMMON_DATA_SETUP \
+  std::vector<Int_ptr> pack_index_lists = m_pack_index_lists; \
+  std::vector<Int_ptr> unpack_index_lists = m_unpack_index_lists;
+
+#define HALOEXCHANGE_FUSED_MANUAL_FUSER_SETUP_T(Loop_T, List_T) \
   struct ptr_holder { \
     Real_ptr buffer; \
-    Int_ptr  list; \
+    List_T*  list; \
     Real_ptr var; \
   }; \
   ptr_holder* pack_ptr_holders = new ptr_holder[num_neighbors * num_vars]; \
-  Index_type* pack_lens        = new Index_type[num_neighbors * num_vars]; \
+  Loop_T*     pack_lens        = new Loop_T[num_neighbors * num_vars]; \
   ptr_holder* unpack_ptr_holders = new ptr_holder[num_neighbors * num_vars]; \
-  Index_type* unpack_lens        = new Index_type[num_neighbors * num_vars];
+  Loop_T*     unpack_lens        = new Loop_T[num_neighbors * num_vars];
+
+#define HALOEXCHANGE_FUSED_MANUAL_FUSER_SETUP \
+  HALOEXCHANGE_FUSED_MANUAL_FUSER_SETUP_T(Index_type, Int_type)
 
 #define HALOEXCHANGE_FUSED_MANUAL_FUSER_TEARDOWN \
   delete[] pack_ptr_holders; \
@@ -73,6 +90,12 @@
   delete[] unpack_ptr_holders; \
   delete[] unpack_lens;
 
+#define HALOEXCHANGE_FUSED_PLAN_DATA_SETUP \
+  const plan_item* pack_plan = m_pack_plan.data(); \
+  Index_type num_pack_items = m_pack_plan.size(); \
+  const plan_item* unpack_plan = m_unpack_plan.data(); \
+  Index_type num_unpack_items = m_unpack_plan.size();
+
 #define HALOEXCHANGE_FUSED_PACK_BODY \
   buffer[i] = var[list[i]];
 
@@ -80,25 +103,28 @@
   var[list[i]] = buffer[i];
 
 
-#define HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_SETUP \
-  auto make_pack_lambda = [](Real_ptr buffer, Int_ptr list, Real_ptr var) { \
-    return [=](Index_type i) { \
+#define HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_SETUP_T(Loop_T, List_T) \
+  auto make_pack_lambda = [](Real_ptr buffer, List_T* list, Real_ptr var) { \
+    return [=](Loop_T i) { \
       HALOEXCHANGE_FUSED_PACK_BODY; \
     }; \
   }; \
-  using pack_lambda_type = decltype(make_pack_lambda(Real_ptr(), Int_ptr(), Real_ptr())); \
+  using pack_lambda_type = decltype(make_pack_lambda(Real_ptr(), static_cast<List_T*>(nullptr), Real_ptr())); \
   pack_lambda_type* pack_lambdas = reinterpret_cast<pack_lambda_type*>( \
       malloc(sizeof(pack_lambda_type) * (num_neighbors * num_vars))); \
-  Index_type* pack_lens = new Index_type[num_neighbors * num_vars]; \
-  auto make_unpack_lambda = [](Real_ptr buffer, Int_ptr list, Real_ptr var) { \
-    return [=](Index_type i) { \
+  Loop_T* pack_lens = new Loop_T[num_neighbors * num_vars]; \
+  auto make_unpack_lambda = [](Real_ptr buffer, List_T* list, Real_ptr var) { \
+    return [=](Loop_T i) { \
       HALOEXCHANGE_FUSED_UNPACK_BODY; \
     }; \
   }; \
-  using unpack_lambda_type = decltype(make_unpack_lambda(Real_ptr(), Int_ptr(), Real_ptr())); \
+  using unpack_lambda_type = decltype(make_unpack_lambda(Real_ptr(), static_cast<List_T*>(nullptr), Real_ptr())); \
   unpack_lambda_type* unpack_lambdas = reinterpret_cast<unpack_lambda_type*>( \
       malloc(sizeof(unpack_lambda_type) * (num_neighbors * num_vars))); \
-  Index_type* unpack_lens = new Index_type[num_neighbors * num_vars];
+  Loop_T* unpack_lens = new Loop_T[num_neighbors * num_vars];
+
+#define HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_SETUP \
+  HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_SETUP_T(Index_type, Int_type)
 
 #define HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_TEARDOWN \
   free(pack_lambdas); \
@@ -138,8 +164,22 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename Loop_T, typename List_T >
+  void runSeqVariantImpl(VariantID vid,
+                         std::vector<List_T*> const& pack_index_lists,
+                         std::vector<List_T*> const& unpack_index_lists);
+  template < typename Loop_T, typename List_T >
+  void runOpenMPVariantImpl(VariantID vid,
+                            std::vector<List_T*> const& pack_index_lists,
+                            std::vector<List_T*> const& unpack_index_lists);
+  void runSeqVariantPlan(VariantID vid);
+  void runOpenMPVariantPlan(VariantID vid);
+  void runOpenMPVariantTaskloop(VariantID vid, Index_type grainsize);
+  void runOpenMPVariantTaskgraph(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -171,20 +211,55 @@ private:
   std::vector<Int_ptr> m_unpack_index_lists;
   std::vector<Index_type > m_unpack_index_list_lengths;
 
-  void create_pack_lists(std::vector<Int_ptr>& pack_index_lists,
+  // index lists used by the tunings with Index_type index lists
+  std::vector<Index_ptr> m_pack_index_lists_64;
+  std::vector<Index_ptr> m_unpack_index_lists_64;
+
+  bool usesIndexLists64(VariantID vid, size_t tune_idx) const
+  {
+    return isIndexTuning<Index_type, Index_type>(vid, tune_idx) ||
+           isIndexTuning<Int_type, Index_type>(vid, tune_idx);
+  }
+
+  // one fused pack or unpack loop of the persistent plan
+  struct plan_item
+  {
+    Real_ptr buffer;
+    Int_ptr  list;
+    Real_ptr var;
+    Index_type len;
+  };
+
+  std::vector<plan_item> m_pack_plan;
+  std::vector<plan_item> m_unpack_plan;
+
+  bool usesPersistentPlan(VariantID vid, size_t tune_idx) const
+  {
+    return getVariantTuningName(vid, tune_idx) == "persistent_plan";
+  }
+
+  void create_plan(std::vector<plan_item>& plan,
+                   std::vector<Int_ptr> const& index_lists,
+                   std::vector<Index_type > const& index_list_lengths);
+
+  template < typename List_T >
+  void create_pack_lists(std::vector<List_T*>& pack_index_lists,
                          std::vector<Index_type >& pack_index_list_lengths,
                          const Index_type halo_width, const Index_type* grid_dims,
                          const Index_type num_neighbors,
                          VariantID vid);
-  void destroy_pack_lists(std::vector<Int_ptr>& pack_index_lists,
+  template < typename List_T >
+  void destroy_pack_lists(std::vector<List_T*>& pack_index_lists,
                           const Index_type num_neighbors,
                           VariantID vid);
-  void create_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
+  template < typename List_T >
+  void create_unpack_lists(std::vector<List_T*>& unpack_index_lists,
                            std::vector<Index_type >& unpack_index_list_lengths,
                            const Index_type halo_width, const Index_type* grid_dims,
                            const Index_type num_neighbors,
                            VariantID vid);
-  void destroy_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
+  template < typename List_T >
+  void destroy_unpack_lists(std::vector<List_T*>& unpack_index_lists,
                             const Index_type num_neighbors,
                             VariantID vid);
 };
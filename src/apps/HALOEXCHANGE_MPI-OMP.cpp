@@ -0,0 +1,205 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HALOEXCHANGE_MPI.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/OpenMPUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+template < bool pipelined, bool persistent >
+void HALOEXCHANGE_MPI::runOpenMPVariantImpl(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_MPI_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        postRecvs(persistent);
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = send_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            #pragma omp parallel for
+            for (Index_type i = 0; i < len; i++) {
+              HALOEXCHANGE_MPI_PACK_BODY;
+            }
+            buffer += len;
+          }
+          if (pipelined) {
+            postSend(l, persistent);
+          }
+        }
+
+        if (!pipelined) {
+          postSends(persistent);
+          waitRecvs();
+        }
+
+        for (Index_type n = 0; n < num_neighbors; ++n) {
+          Index_type l = pipelined ? waitRecvAny() : n;
+          Real_ptr buffer = recv_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            #pragma omp parallel for
+            for (Index_type i = 0; i < len; i++) {
+              HALOEXCHANGE_MPI_UNPACK_BODY;
+            }
+            buffer += len;
+          }
+        }
+
+        waitSends();
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL = RAJA::omp_parallel_for_exec;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        postRecvs(persistent);
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = send_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_mpi_pack_base_lam = [=](Index_type i) {
+                  HALOEXCHANGE_MPI_PACK_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                haloexchange_mpi_pack_base_lam );
+            buffer += len;
+          }
+          if (pipelined) {
+            postSend(l, persistent);
+          }
+        }
+
+        if (!pipelined) {
+          postSends(persistent);
+          waitRecvs();
+        }
+
+        for (Index_type n = 0; n < num_neighbors; ++n) {
+          Index_type l = pipelined ? waitRecvAny() : n;
+          Real_ptr buffer = recv_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto haloexchange_mpi_unpack_base_lam = [=](Index_type i) {
+                  HALOEXCHANGE_MPI_UNPACK_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                haloexchange_mpi_unpack_base_lam );
+            buffer += len;
+          }
+        }
+
+        waitSends();
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALOEXCHANGE_MPI : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HALOEXCHANGE_MPI::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<false, false>(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<true, false>(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<false, true>(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<true, true>(vid);
+
+  }
+
+  t += 1;
+}
+
+void HALOEXCHANGE_MPI::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "pack_all");
+  addVariantTuningName(vid, "pipelined");
+  addVariantTuningName(vid, "pack_all_persistent");
+  addVariantTuningName(vid, "pipelined_persistent");
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_PERFSUITE_ENABLE_MPI
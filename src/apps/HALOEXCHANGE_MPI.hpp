@@ -0,0 +1,204 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// HALOEXCHANGE_MPI kernel reference implementation:
+///
+/// // post receive from each neighbor
+/// for (Index_type l = 0; l < num_neighbors; ++l) {
+///   MPI_Irecv(recv_buffers[l], len, ..., neighbor_ranks[l], l, ...);
+/// }
+///
+/// // pack message for each neighbor
+/// for (Index_type l = 0; l < num_neighbors; ++l) {
+///   Real_ptr buffer = send_buffers[l];
+///   Int_ptr list = pack_index_lists[l];
+///   Index_type  len  = pack_index_list_lengths[l];
+///   // pack part of each variable
+///   for (Index_type v = 0; v < num_vars; ++v) {
+///     Real_ptr var = vars[v];
+///     for (Index_type i = 0; i < len; i++) {
+///       HALOEXCHANGE_MPI_PACK_BODY;
+///     }
+///     buffer += len;
+///   }
+/// }
+///
+/// // send message to each neighbor
+/// for (Index_type l = 0; l < num_neighbors; ++l) {
+///   MPI_Isend(send_buffers[l], len, ..., neighbor_ranks[l], opposite(l), ...);
+/// }
+///
+/// // unpack messages for each neighbor
+/// MPI_Waitall(num_neighbors, recv_requests, ...);
+/// for (Index_type l = 0; l < num_neighbors; ++l) {
+///   Real_ptr buffer = recv_buffers[l];
+///   Int_ptr list = unpack_index_lists[l];
+///   Index_type  len  = unpack_index_list_lengths[l];
+///   // unpack part of each variable
+///   for (Index_type v = 0; v < num_vars; ++v) {
+///     Real_ptr var = vars[v];
+///     for (Index_type i = 0; i < len; i++) {
+///       HALOEXCHANGE_MPI_UNPACK_BODY;
+///     }
+///     buffer += len;
+///   }
+/// }
+/// MPI_Waitall(num_neighbors, send_requests, ...);
+///
+/// The ranks are arranged in a periodic 3D Cartesian grid and every rank
+/// owns a full grid of the problem size, so the neighbor in each of the 26
+/// directions always exists; with a single rank every message goes to self.
+///
+/// The "pack_all" tuning is the implementation above. The "pipelined" tuning
+/// sends each message as soon as it is packed and unpacks messages in the
+/// order they arrive. The "_persistent" tunings use persistent requests
+/// created in setUp instead of starting new requests every rep.
+///
+/// This kernel is only available when the suite is built with MPI.
+///
+
+#ifndef RAJAPerf_Apps_HALOEXCHANGE_MPI_HPP
+#define RAJAPerf_Apps_HALOEXCHANGE_MPI_HPP
+
+#define HALOEXCHANGE_MPI_DATA_SETUP \
+  std::vector<Real_ptr> vars = m_vars; \
+  std::vector<Real_ptr> send_buffers = m_send_buffers; \
+  std::vector<Real_ptr> recv_buffers = m_recv_buffers; \
+\
+  Index_type num_neighbors = s_num_neighbors; \
+  Index_type num_vars = m_num_vars; \
+  std::vector<Int_ptr> pack_index_lists = m_pack_index_lists; \
+  std::vector<Index_type> pack_index_list_lengths = m_pack_index_list_lengths; \
+  std::vector<Int_ptr> unpack_index_lists = m_unpack_index_lists; \
+  std::vector<Index_type> unpack_index_list_lengths = m_unpack_index_list_lengths;
+
+#define HALOEXCHANGE_MPI_PACK_BODY \
+  buffer[i] = var[list[i]];
+
+#define HALOEXCHANGE_MPI_UNPACK_BODY \
+  var[list[i]] = buffer[i];
+
+
+#include "common/KernelBase.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include <mpi.h>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class HALOEXCHANGE_MPI : public KernelBase
+{
+public:
+
+  HALOEXCHANGE_MPI(const RunParams& params);
+
+  ~HALOEXCHANGE_MPI();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HALOEXCHANGE_MPI : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HALOEXCHANGE_MPI : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HALOEXCHANGE_MPI : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < bool pipelined, bool persistent >
+  void runSeqVariantImpl(VariantID vid);
+  template < bool pipelined, bool persistent >
+  void runOpenMPVariantImpl(VariantID vid);
+
+private:
+  static const int s_num_neighbors = 26;
+
+  Index_type m_grid_dims[3];
+  Index_type m_halo_width;
+  Index_type m_num_vars;
+
+  Index_type m_grid_dims_default[3];
+  Index_type m_halo_width_default;
+  Index_type m_num_vars_default;
+
+  Index_type m_grid_plus_halo_dims[3];
+  Index_type m_var_size;
+
+  int m_mpi_dims[3];
+  std::vector<int> m_neighbor_ranks;
+
+  std::vector<Real_ptr> m_vars;
+  std::vector<Real_ptr> m_send_buffers;
+  std::vector<Real_ptr> m_recv_buffers;
+
+  std::vector<Int_ptr> m_pack_index_lists;
+  std::vector<Index_type > m_pack_index_list_lengths;
+  std::vector<Int_ptr> m_unpack_index_lists;
+  std::vector<Index_type > m_unpack_index_list_lengths;
+
+  std::vector<MPI_Request> m_send_requests;
+  std::vector<MPI_Request> m_recv_requests;
+
+  bool usesPersistentRequests(VariantID vid, size_t tune_idx) const;
+
+  // start the receive from or send to neighbor l, or all neighbors, using
+  // the persistent requests or new immediate requests
+  void postRecvs(bool persistent);
+  void postSend(Index_type l, bool persistent);
+  void postSends(bool persistent);
+
+  // wait for any receive and return its neighbor, or for all of them
+  Index_type waitRecvAny();
+  void waitRecvs();
+  void waitSends();
+
+  void create_pack_lists(std::vector<Int_ptr>& pack_index_lists,
+                         std::vector<Index_type >& pack_index_list_lengths,
+                         const Index_type halo_width, const Index_type* grid_dims,
+                         const Index_type num_neighbors,
+                         VariantID vid);
+  void destroy_pack_lists(std::vector<Int_ptr>& pack_index_lists,
+                          const Index_type num_neighbors,
+                          VariantID vid);
+  void create_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
+                           std::vector<Index_type >& unpack_index_list_lengths,
+                           const Index_type halo_width, const Index_type* grid_dims,
+                           const Index_type num_neighbors,
+                           VariantID vid);
+  void destroy_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
+                            const Index_type num_neighbors,
+                            VariantID vid);
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_PERFSUITE_ENABLE_MPI
+
+#endif // closing endif for header file include guard
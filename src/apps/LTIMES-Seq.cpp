@@ -18,7 +18,7 @@ namespace apps
 {
 
 
-void LTIMES::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void LTIMES::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
@@ -121,5 +121,249 @@ void LTIMES::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void LTIMES::runSeqVariantGZD(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  LTIMES_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type g = 0; g < num_g; ++g ) {
+          for (Index_type z = 0; z < num_z; ++z ) {
+            for (Index_type m = 0; m < num_m; ++m ) {
+              for (Index_type d = 0; d < num_d; ++d ) {
+                LTIMES_BODY_GZD;
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto ltimes_base_lam = [=](Index_type d, Index_type z,
+                                 Index_type g, Index_type m) {
+                               LTIMES_BODY_GZD;
+                             };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type g = 0; g < num_g; ++g ) {
+          for (Index_type z = 0; z < num_z; ++z ) {
+            for (Index_type m = 0; m < num_m; ++m ) {
+              for (Index_type d = 0; d < num_d; ++d ) {
+                ltimes_base_lam(d, z, g, m);
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      LTIMES_VIEWS_RANGES_RAJA_PERM(ltimes_layout::gzd, 2);
+
+      auto ltimes_lam = [=](ID d, IZ z, IG g, IM m) {
+                          LTIMES_BODY_RAJA;
+                        };
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<2, RAJA::loop_exec,       // g
+            RAJA::statement::For<1, RAJA::loop_exec,     // z
+              RAJA::statement::For<3, RAJA::loop_exec,   // m
+                RAJA::statement::For<0, RAJA::loop_exec, // d
+                  RAJA::statement::Lambda<0>
+                >
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(IDRange(0, num_d),
+                                                 IZRange(0, num_z),
+                                                 IGRange(0, num_g),
+                                                 IMRange(0, num_m)),
+                                ltimes_lam
+                              );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n LTIMES : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void LTIMES::runSeqVariantDGZ(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  LTIMES_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type m = 0; m < num_m; ++m ) {
+          for (Index_type g = 0; g < num_g; ++g ) {
+            for (Index_type d = 0; d < num_d; ++d ) {
+              for (Index_type z = 0; z < num_z; ++z ) {
+                LTIMES_BODY_DGZ;
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto ltimes_base_lam = [=](Index_type d, Index_type z,
+                                 Index_type g, Index_type m) {
+                               LTIMES_BODY_DGZ;
+                             };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type m = 0; m < num_m; ++m ) {
+          for (Index_type g = 0; g < num_g; ++g ) {
+            for (Index_type d = 0; d < num_d; ++d ) {
+              for (Index_type z = 0; z < num_z; ++z ) {
+                ltimes_base_lam(d, z, g, m);
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      LTIMES_VIEWS_RANGES_RAJA_PERM(ltimes_layout::dgz, 0);
+
+      auto ltimes_lam = [=](ID d, IZ z, IG g, IM m) {
+                          LTIMES_BODY_RAJA;
+                        };
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<3, RAJA::loop_exec,       // m
+            RAJA::statement::For<2, RAJA::loop_exec,     // g
+              RAJA::statement::For<0, RAJA::loop_exec,   // d
+                RAJA::statement::For<1, RAJA::loop_exec, // z
+                  RAJA::statement::Lambda<0>
+                >
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(IDRange(0, num_d),
+                                                 IZRange(0, num_z),
+                                                 IGRange(0, num_g),
+                                                 IMRange(0, num_m)),
+                                ltimes_lam
+                              );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n LTIMES : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void LTIMES::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantGZD(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDGZ(vid);
+
+  }
+
+  t += 1;
+}
+
+void LTIMES::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, "gzd", getDefaultTuningName());
+
+  addVariantTuningName(vid, "dgz", getDefaultTuningName());
+}
+
 } // end namespace apps
 } // end namespace rajaperf
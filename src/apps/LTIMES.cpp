@@ -13,6 +13,7 @@
 #include "common/DataUtils.hpp"
 
 #include <algorithm>
+#include <vector>
 
 namespace rajaperf
 {
@@ -31,12 +32,11 @@ LTIMES::LTIMES(const RunParams& params)
   setDefaultProblemSize(m_num_d_default * m_num_g_default * m_num_z_default);
   setDefaultReps(50);
 
-  m_num_z = std::max( getTargetProblemSize() /
-                      (m_num_d_default * m_num_g_default),
+  m_num_d = params.getLTimesNumD();
+  m_num_g = params.getLTimesNumG();
+  m_num_m = params.getLTimesNumM();
+  m_num_z = std::max( getTargetProblemSize() / (m_num_d * m_num_g),
                       Index_type(1) );
-  m_num_g = m_num_g_default;
-  m_num_m = m_num_m_default;
-  m_num_d = m_num_d_default;
 
   m_philen = m_num_m * m_num_g * m_num_z;
   m_elllen = m_num_d * m_num_m;
@@ -83,15 +83,60 @@ LTIMES::~LTIMES()
 {
 }
 
-void LTIMES::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void LTIMES::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_phidat, int(m_philen), Real_type(0.0), vid);
   allocAndInitData(m_elldat, int(m_elllen), vid);
   allocAndInitData(m_psidat, int(m_psilen), vid);
+
+  if ( usesPermutedLayout(vid, tune_idx) ) {
+    permuteData(m_psidat, m_num_d, true, vid, tune_idx);
+  }
+}
+
+void LTIMES::permuteData(Real_ptr data, Index_type num_k, bool to_layout,
+                         VariantID vid, size_t tune_idx)
+{
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  RAJA::Layout<3, Index_type> layout;
+  if (tuning_name == "gzd") {
+    layout = RAJA::make_permuted_layout( {{m_num_z, m_num_g, num_k}},
+                   RAJA::as_array<ltimes_layout::gzd>::get() );
+  } else if (tuning_name == "dgz") {
+    layout = RAJA::make_permuted_layout( {{m_num_z, m_num_g, num_k}},
+                   RAJA::as_array<ltimes_layout::dgz>::get() );
+  } else {
+    layout = RAJA::make_permuted_layout( {{m_num_z, m_num_g, num_k}},
+                   RAJA::as_array<ltimes_layout::zgd>::get() );
+  }
+
+  const Index_type len = m_num_z * m_num_g * num_k;
+
+  auto reset = scopedMoveData(data, len, vid);
+
+  std::vector<Real_type> copy(data, data + len);
+
+  for (Index_type z = 0; z < m_num_z; ++z ) {
+    for (Index_type g = 0; g < m_num_g; ++g ) {
+      for (Index_type k = 0; k < num_k; ++k ) {
+        const Index_type i = k + (g * num_k) + (z * num_k * m_num_g);
+        if (to_layout) {
+          data[layout(z, g, k)] = copy[i];
+        } else {
+          data[i] = copy[layout(z, g, k)];
+        }
+      }
+    }
+  }
 }
 
 void LTIMES::updateChecksum(VariantID vid, size_t tune_idx)
 {
+  if ( usesPermutedLayout(vid, tune_idx) ) {
+    permuteData(m_phidat, m_num_m, false, vid, tune_idx);
+  }
+
   checksum[vid][tune_idx] += calcChecksum(m_phidat, m_philen, checksum_scale_factor , vid);
 }
 
@@ -26,6 +26,22 @@
 /// and views to do the same thing without explicit index calculations (see
 /// the loop body definitions below).
 ///
+/// The "gzd" and "dgz" tunings of the Seq and OpenMP variants store psi and
+/// phi in other orders, named by the order of the psi indices from slowest
+/// to fastest (phi uses the same order with m in place of d), and loop over
+/// the indices in that order so the fastest index is innermost:
+///
+///   zgd (default) : for z, for g, for m, for d
+///   gzd           : for g, for z, for m, for d
+///   dgz           : for m, for g, for d, for z
+///
+/// The RAJA variants use RAJA permuted layouts for these orders. psi is
+/// permuted in setUp and phi is permuted back to the default order before
+/// the checksum is computed.
+///
+/// The number of directions, groups, and moments may be set with the
+/// --ltimes-num-d, --ltimes-num-g, and --ltimes-num-m options.
+///
 
 #ifndef RAJAPerf_Apps_LTIMES_HPP
 #define RAJAPerf_Apps_LTIMES_HPP
@@ -44,32 +60,47 @@
   phidat[m+ (g * num_m) + (z * num_m * num_g)] += \
     elldat[d+ (m * num_d)] * psidat[d+ (g * num_d) + (z * num_d * num_g)];
 
+#define LTIMES_BODY_GZD \
+  phidat[m+ (z * num_m) + (g * num_m * num_z)] += \
+    elldat[d+ (m * num_d)] * psidat[d+ (z * num_d) + (g * num_d * num_z)];
+
+#define LTIMES_BODY_DGZ \
+  phidat[z+ (g * num_z) + (m * num_z * num_g)] += \
+    elldat[d+ (m * num_d)] * psidat[z+ (g * num_z) + (d * num_z * num_g)];
+
 #define LTIMES_BODY_RAJA \
   phi(z, g, m) +=  ell(m, d) * psi(z, g, d);
 
 
 #define LTIMES_VIEWS_RANGES_RAJA \
+  LTIMES_VIEWS_RANGES_RAJA_PERM(ltimes_layout::zgd, 2)
+
+//
+// PERM is one of the ltimes_layout orders, STRIDE_ONE_DIM the position of
+// its fastest index in the (z, g, d) and (z, g, m) view indices.
+//
+#define LTIMES_VIEWS_RANGES_RAJA_PERM(PERM, STRIDE_ONE_DIM) \
   using namespace ltimes_idx; \
 \
   using PSI_VIEW = RAJA::TypedView<Real_type, \
-                                   RAJA::Layout<3, Index_type, 2>, \
+                                   RAJA::Layout<3, Index_type, STRIDE_ONE_DIM>, \
                                    IZ, IG, ID>; \
   using ELL_VIEW = RAJA::TypedView<Real_type, \
                                    RAJA::Layout<2, Index_type, 1>, \
                                    IM, ID>; \
   using PHI_VIEW = RAJA::TypedView<Real_type, \
-                                   RAJA::Layout<3, Index_type, 2>, \
+                                   RAJA::Layout<3, Index_type, STRIDE_ONE_DIM>, \
                                    IZ, IG, IM>; \
 \
   PSI_VIEW psi(psidat, \
                RAJA::make_permuted_layout( {{num_z, num_g, num_d}}, \
-                     RAJA::as_array<RAJA::Perm<0, 1, 2> >::get() ) ); \
+                     RAJA::as_array<PERM>::get() ) ); \
   ELL_VIEW ell(elldat, \
                RAJA::make_permuted_layout( {{num_m, num_d}}, \
                      RAJA::as_array<RAJA::Perm<0, 1> >::get() ) ); \
   PHI_VIEW phi(phidat, \
                RAJA::make_permuted_layout( {{num_z, num_g, num_m}}, \
-                     RAJA::as_array<RAJA::Perm<0, 1, 2> >::get() ) ); \
+                     RAJA::as_array<PERM>::get() ) ); \
 \
       using IDRange = RAJA::TypedRangeSegment<ID>; \
       using IZRange = RAJA::TypedRangeSegment<IZ>; \
@@ -99,6 +130,16 @@ namespace ltimes_idx {
   RAJA_INDEX_VALUE(IM, "IM");
 }
 
+//
+// Orders of the (z, g, d) indices of psi and the (z, g, m) indices of phi
+// in memory from slowest to fastest.
+//
+namespace ltimes_layout {
+  using zgd = RAJA::Perm<0, 1, 2>;
+  using gzd = RAJA::Perm<1, 0, 2>;
+  using dgz = RAJA::Perm<2, 1, 0>;
+}
+
 class LTIMES : public KernelBase
 {
 public:
@@ -117,8 +158,16 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantGZD(VariantID vid);
+  void runSeqVariantDGZ(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantGZD(VariantID vid);
+  void runOpenMPVariantDGZ(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -146,6 +195,17 @@ private:
   Index_type m_philen;
   Index_type m_elllen;
   Index_type m_psilen;
+
+  bool usesPermutedLayout(VariantID vid, size_t tune_idx) const
+  {
+    const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+    return tuning_name == "gzd" || tuning_name == "dgz";
+  }
+
+  // copy data with (z, g, k) indices from the default order to the order of
+  // the layout tuning, or back
+  void permuteData(Real_ptr data, Index_type num_k, bool to_layout,
+                   VariantID vid, size_t tune_idx);
 };
 
 } // end namespace apps
@@ -18,15 +18,16 @@ namespace apps
 {
 
 
-void LTIMES_NOVIEW::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Loop_T >
+void LTIMES_NOVIEW::runSeqVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
-  LTIMES_NOVIEW_DATA_SETUP;
+  LTIMES_NOVIEW_DATA_SETUP_T(Loop_T);
 
 #if defined(RUN_RAJA_SEQ)
-  auto ltimesnoview_lam = [=](Index_type d, Index_type z,
-                              Index_type g, Index_type m) {
+  auto ltimesnoview_lam = [=](Loop_T d, Loop_T z,
+                              Loop_T g, Loop_T m) {
                                 LTIMES_NOVIEW_BODY;
                           };
 #endif
@@ -38,10 +39,10 @@ void LTIMES_NOVIEW::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        for (Index_type z = 0; z < num_z; ++z ) {
-          for (Index_type g = 0; g < num_g; ++g ) {
-            for (Index_type m = 0; m < num_m; ++m ) {
-              for (Index_type d = 0; d < num_d; ++d ) {
+        for (Loop_T z = 0; z < num_z; ++z ) {
+          for (Loop_T g = 0; g < num_g; ++g ) {
+            for (Loop_T m = 0; m < num_m; ++m ) {
+              for (Loop_T d = 0; d < num_d; ++d ) {
                 LTIMES_NOVIEW_BODY;
               }
             }
@@ -60,10 +61,10 @@ void LTIMES_NOVIEW::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        for (Index_type z = 0; z < num_z; ++z ) {
-          for (Index_type g = 0; g < num_g; ++g ) {
-            for (Index_type m = 0; m < num_m; ++m ) {
-              for (Index_type d = 0; d < num_d; ++d ) {
+        for (Loop_T z = 0; z < num_z; ++z ) {
+          for (Loop_T g = 0; g < num_g; ++g ) {
+            for (Loop_T m = 0; m < num_m; ++m ) {
+              for (Loop_T d = 0; d < num_d; ++d ) {
                 ltimesnoview_lam(d, z, g, m);
               }
             }
@@ -94,10 +95,10 @@ void LTIMES_NOVIEW::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(0, num_d),
-                                                 RAJA::RangeSegment(0, num_z),
-                                                 RAJA::RangeSegment(0, num_g),
-                                                 RAJA::RangeSegment(0, num_m)),
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::TypedRangeSegment<Loop_T>(0, num_d),
+                                                 RAJA::TypedRangeSegment<Loop_T>(0, num_z),
+                                                 RAJA::TypedRangeSegment<Loop_T>(0, num_g),
+                                                 RAJA::TypedRangeSegment<Loop_T>(0, num_m)),
                                 ltimesnoview_lam
                               );
 
@@ -116,5 +117,144 @@ void LTIMES_NOVIEW::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
 }
 
+template < bool batched >
+void LTIMES_NOVIEW::runSeqVariantGemm(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  LTIMES_NOVIEW_DATA_SETUP;
+
+  LTIMES_NOVIEW_GEMM_DATA_SETUP;
+
+  // the rows of a zone, or batch_rows rows spanning zones
+  const Index_type rows_per_block =
+      batched ? ltimes_noview_gemm::batch_rows : num_g;
+  const Index_type num_blocks =
+      RAJA_DIVIDE_CEILING_INT(num_rows, rows_per_block);
+
+#if defined(RUN_RAJA_SEQ)
+  auto ltimesnoview_pack_lam = [=](Index_type p) {
+                                 LTIMES_NOVIEW_PACK_BODY;
+                               };
+  auto ltimesnoview_gemm_lam = [=](Index_type b) {
+                                 LTIMES_NOVIEW_GEMM_BODY;
+                               };
+#endif
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type p = 0; p < num_panels; ++p ) {
+          LTIMES_NOVIEW_PACK_BODY;
+        }
+
+        for (Index_type b = 0; b < num_blocks; ++b ) {
+          LTIMES_NOVIEW_GEMM_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type p = 0; p < num_panels; ++p ) {
+          ltimesnoview_pack_lam(p);
+        }
+
+        for (Index_type b = 0; b < num_blocks; ++b ) {
+          ltimesnoview_gemm_lam(b);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, num_panels), ltimesnoview_pack_lam);
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, num_blocks), ltimesnoview_gemm_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n LTIMES_NOVIEW : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void LTIMES_NOVIEW::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<Index_type>(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<Int_type>(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantGemm<false>(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantGemm<true>(vid);
+
+  }
+
+  t += 1;
+}
+
+void LTIMES_NOVIEW::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getLoopIndexTuningName<Int_type>());
+
+  addVariantTuningName(vid, "zone_gemm", getDefaultTuningName());
+
+  addVariantTuningName(vid, "batched_gemm", getDefaultTuningName());
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -31,12 +31,11 @@ LTIMES_NOVIEW::LTIMES_NOVIEW(const RunParams& params)
   setDefaultProblemSize(m_num_d_default * m_num_g_default * m_num_z_default);
   setDefaultReps(50);
 
-  m_num_z = std::max( getTargetProblemSize() /
-                      (m_num_d_default * m_num_g_default),
+  m_num_d = params.getLTimesNumD();
+  m_num_g = params.getLTimesNumG();
+  m_num_m = params.getLTimesNumM();
+  m_num_z = std::max( getTargetProblemSize() / (m_num_d * m_num_g),
                       Index_type(1) );
-  m_num_g = m_num_g_default;
-  m_num_m = m_num_m_default;
-  m_num_d = m_num_d_default;
 
   m_philen = m_num_m * m_num_g * m_num_z;
   m_elllen = m_num_d * m_num_m;
@@ -57,6 +56,7 @@ LTIMES_NOVIEW::LTIMES_NOVIEW(const RunParams& params)
                                            getActualProblemSize() );
 
   setUsesFeature(Kernel);
+  setUsesFeature(Forall);
 
   setVariantDefined( Base_Seq );
   setVariantDefined( Lambda_Seq );
@@ -82,25 +82,39 @@ LTIMES_NOVIEW::~LTIMES_NOVIEW()
 {
 }
 
-void LTIMES_NOVIEW::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void LTIMES_NOVIEW::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_phidat, int(m_philen), Real_type(0.0), vid);
   allocAndInitData(m_elldat, int(m_elllen), vid);
   allocAndInitData(m_psidat, int(m_psilen), vid);
+
+  if ( usesGemm(vid, tune_idx) ) {
+    allocData(m_ellpack,
+              int(ltimes_noview_gemm::getPackedLength(m_num_d, m_num_m)), vid);
+  }
 }
 
 void LTIMES_NOVIEW::updateChecksum(VariantID vid, size_t tune_idx)
 {
   checksum[vid][tune_idx] += calcChecksum(m_phidat, m_philen, checksum_scale_factor , vid);
+
+  if ( usesGemm(vid, tune_idx) ) {
+    // the microkernel sums over directions in registers before adding to phi
+    setChecksumTolerance<Real_type>(vid, tune_idx);
+  }
 }
 
-void LTIMES_NOVIEW::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void LTIMES_NOVIEW::tearDown(VariantID vid, size_t tune_idx)
 {
   (void) vid;
 
   deallocData(m_phidat, vid);
   deallocData(m_elldat, vid);
   deallocData(m_psidat, vid);
+
+  if ( usesGemm(vid, tune_idx) ) {
+    deallocData(m_ellpack, vid);
+  }
 }
 
 } // end namespace apps
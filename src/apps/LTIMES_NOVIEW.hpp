@@ -22,26 +22,62 @@
 ///   }
 /// }
 ///
+/// The default tuning uses Index_type loop indices; the "loop32" tuning of
+/// the Seq and OpenMP variants uses Int_type loop indices and extents.
+///
+/// Each zone is a small matrix product, phi_z(g, m) += psi_z(g, d) * ell(m, d),
+/// and all zones together are one product of the (z, g) rows of psi and phi.
+/// The "zone_gemm" tuning of the Seq and OpenMP variants computes the product
+/// of each zone, and the "batched_gemm" tuning computes the product of all
+/// zones in blocks of rows that do not depend on the zone boundaries. Both
+/// pack ell by panels of moments every rep and compute blocks of phi in
+/// registers with the microkernel below.
+///
+/// The number of directions, groups, and moments may be set with the
+/// --ltimes-num-d, --ltimes-num-g, and --ltimes-num-m options.
+///
 
 #ifndef RAJAPerf_Apps_LTIMES_NOVIEW_HPP
 #define RAJAPerf_Apps_LTIMES_NOVIEW_HPP
 
-#define LTIMES_NOVIEW_DATA_SETUP \
+#define LTIMES_NOVIEW_DATA_SETUP_T(Loop_T) \
   Real_ptr phidat = m_phidat; \
   Real_ptr elldat = m_elldat; \
   Real_ptr psidat = m_psidat; \
 \
-  Index_type num_d = m_num_d; \
-  Index_type num_z = m_num_z; \
-  Index_type num_g = m_num_g; \
-  Index_type num_m = m_num_m;
+  Loop_T num_d = m_num_d; \
+  Loop_T num_z = m_num_z; \
+  Loop_T num_g = m_num_g; \
+  Loop_T num_m = m_num_m;
+
+#define LTIMES_NOVIEW_DATA_SETUP \
+  LTIMES_NOVIEW_DATA_SETUP_T(Index_type)
 
 #define LTIMES_NOVIEW_BODY \
   phidat[m+ (g * num_m) + (z * num_m * num_g)] += \
     elldat[d+ (m * num_d)] * psidat[d+ (g * num_d) + (z * num_d * num_g)];
 
+#define LTIMES_NOVIEW_GEMM_DATA_SETUP \
+  Real_ptr ellpack = m_ellpack; \
+\
+  const Index_type num_panels = ltimes_noview_gemm::getNumPanels(num_m); \
+  const Index_type num_rows = num_z * num_g;
+
+#define LTIMES_NOVIEW_PACK_BODY \
+  ltimes_noview_gemm::packPanel(ellpack, elldat, p, num_d, num_m);
+
+#define LTIMES_NOVIEW_GEMM_BODY \
+  const Index_type i = b * rows_per_block; \
+  ltimes_noview_gemm::gemm(phidat + i * num_m, psidat + i * num_d, ellpack, \
+                           std::min(rows_per_block, num_rows - i), \
+                           num_d, num_m);
+
 #include "common/KernelBase.hpp"
 
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+
 namespace rajaperf
 {
 class RunParams;
@@ -49,6 +85,100 @@ class RunParams;
 namespace apps
 {
 
+namespace ltimes_noview_gemm {
+
+// rows and moments of the block of phi computed by the microkernel; the
+// moments of a row fill one AVX-512 or two AVX2 registers
+constexpr Index_type block_rows = 4;
+constexpr Index_type panel_moments = 8;
+
+// rows of psi and phi computed together by the batched tuning
+constexpr Index_type batch_rows = 64;
+
+inline Index_type getNumPanels(Index_type num_m)
+{
+  return (num_m + panel_moments - 1) / panel_moments;
+}
+
+inline Index_type getPackedLength(Index_type num_d, Index_type num_m)
+{
+  return getNumPanels(num_m) * panel_moments * num_d;
+}
+
+//
+// Copy the moments of ell in panel p so the panel_moments values of each
+// direction are contiguous, padding moments past num_m with zeros.
+//
+inline void packPanel(Real_ptr ellpack, const Real_type* elldat,
+                      Index_type p, Index_type num_d, Index_type num_m)
+{
+  Real_ptr panel = ellpack + p * num_d * panel_moments;
+  for (Index_type d = 0; d < num_d; ++d ) {
+    for (Index_type j = 0; j < panel_moments; ++j ) {
+      const Index_type m = p * panel_moments + j;
+      panel[j + d * panel_moments] =
+          (m < num_m) ? elldat[d + m * num_d] : Real_type(0);
+    }
+  }
+}
+
+//
+// Add the product of rows rows of psi and the num_n moments of a packed
+// panel to the block of phi, accumulating the block in registers.
+//
+template < Index_type rows >
+inline void microKernel(Real_ptr phidat, const Real_type* psidat,
+                        const Real_type* panel,
+                        Index_type num_d, Index_type num_m, Index_type num_n)
+{
+  Real_type c[rows][panel_moments] = {};
+
+  for (Index_type d = 0; d < num_d; ++d ) {
+    for (Index_type r = 0; r < rows; ++r ) {
+      const Real_type a = psidat[d + r * num_d];
+      RAJA_SIMD
+      for (Index_type j = 0; j < panel_moments; ++j ) {
+        c[r][j] += a * panel[j + d * panel_moments];
+      }
+    }
+  }
+
+  for (Index_type r = 0; r < rows; ++r ) {
+    for (Index_type j = 0; j < num_n; ++j ) {
+      phidat[j + r * num_m] += c[r][j];
+    }
+  }
+}
+
+//
+// phi(i, m) += psi(i, d) * ell(m, d) for num_rows rows of psi and phi,
+// reusing the rows from cache for every panel of ell.
+//
+inline void gemm(Real_ptr phidat, const Real_type* psidat,
+                 const Real_type* ellpack, Index_type num_rows,
+                 Index_type num_d, Index_type num_m)
+{
+  const Index_type num_panels = getNumPanels(num_m);
+
+  for (Index_type p = 0; p < num_panels; ++p ) {
+    const Real_type* panel = ellpack + p * num_d * panel_moments;
+    const Index_type m0 = p * panel_moments;
+    const Index_type num_n = std::min(panel_moments, num_m - m0);
+
+    Index_type i = 0;
+    for ( ; i + block_rows <= num_rows; i += block_rows ) {
+      microKernel<block_rows>(phidat + m0 + i * num_m, psidat + i * num_d,
+                              panel, num_d, num_m, num_n);
+    }
+    for ( ; i < num_rows; ++i ) {
+      microKernel<1>(phidat + m0 + i * num_m, psidat + i * num_d,
+                     panel, num_d, num_m, num_n);
+    }
+  }
+}
+
+} // end namespace ltimes_noview_gemm
+
 class LTIMES_NOVIEW : public KernelBase
 {
 public:
@@ -67,8 +197,18 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename Loop_T >
+  void runSeqVariantImpl(VariantID vid);
+  template < typename Loop_T >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < bool batched >
+  void runSeqVariantGemm(VariantID vid);
+  template < bool batched >
+  void runOpenMPVariantGemm(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -82,6 +222,7 @@ private:
   Real_ptr m_phidat;
   Real_ptr m_elldat;
   Real_ptr m_psidat;
+  Real_ptr m_ellpack;
 
   Index_type m_num_d_default;
   Index_type m_num_z_default;
@@ -96,6 +237,12 @@ private:
   Index_type m_philen;
   Index_type m_elllen;
   Index_type m_psilen;
+
+  bool usesGemm(VariantID vid, size_t tune_idx) const
+  {
+    const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+    return tuning_name == "zone_gemm" || tuning_name == "batched_gemm";
+  }
 };
 
 } // end namespace apps
@@ -0,0 +1,133 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MASS2DPA.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+MASS2DPA::MASS2DPA(const RunParams& params)
+  : KernelBase(rajaperf::Apps_MASS2DPA, params)
+{
+  m_NE_default = 40000;
+
+  constexpr Index_type Q1D = fem_order::q1d(default_order);
+
+  setDefaultProblemSize(m_NE_default*Q1D*Q1D);
+  setDefaultReps(50);
+
+  m_NE = getOrderNumElements(default_order);
+
+  setActualProblemSize( m_NE*Q1D*Q1D );
+
+  setItsPerRep(getActualProblemSize());
+  setKernelsPerRep(1);
+
+  setBytesPerRep( getOrderBytesPerRep(default_order) );
+  setFLOPsPerRep( getOrderFLOPsPerRep(default_order) );
+
+  seq_for(orders_type{}, [&](auto order) {
+    const Index_type q1d = fem_order::q1d(order);
+    const Index_type order_size = getOrderNumElements(order)*q1d*q1d;
+    setTuningProblemSize(fem_order::getTuningName(order), order_size);
+    setTuningItsPerRep(fem_order::getTuningName(order), order_size);
+    setTuningBytesPerRep(fem_order::getTuningName(order),
+                         getOrderBytesPerRep(order));
+    setTuningFLOPsPerRep(fem_order::getTuningName(order),
+                         getOrderFLOPsPerRep(order));
+  });
+
+  setUsesFeature(Launch);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+MASS2DPA::~MASS2DPA()
+{
+}
+
+// number of elements of the given order with about the target number of
+// quadrature points
+Index_type MASS2DPA::getOrderNumElements(size_t order) const
+{
+  const Index_type Q1D = fem_order::q1d(order);
+  return std::max(getTargetProblemSize()/(Q1D*Q1D), Index_type(1));
+}
+
+Index_type MASS2DPA::getOrderBytesPerRep(size_t order) const
+{
+  const Index_type D1D = fem_order::d1d(order);
+  const Index_type Q1D = fem_order::q1d(order);
+  const Index_type NE = getOrderNumElements(order);
+
+  return Q1D*D1D*sizeof(Real_type)  +
+         Q1D*D1D*sizeof(Real_type)  +
+         Q1D*Q1D*NE*sizeof(Real_type) +
+         D1D*D1D*NE*sizeof(Real_type) +
+         D1D*D1D*NE*sizeof(Real_type);
+}
+
+Index_type MASS2DPA::getOrderFLOPsPerRep(size_t order) const
+{
+  const Index_type D1D = fem_order::d1d(order);
+  const Index_type Q1D = fem_order::q1d(order);
+  const Index_type NE = getOrderNumElements(order);
+
+  return NE * (2 * D1D * D1D * Q1D +
+               2 * D1D * Q1D * Q1D + Q1D * Q1D +
+               2 * Q1D * Q1D * D1D +
+               2 * Q1D * D1D * D1D + D1D * D1D);
+}
+
+void MASS2DPA::setUp(VariantID vid, size_t tune_idx)
+{
+  const size_t order =
+      fem_order::getOrder(orders_type{}, getVariantTuningProblemName(vid, tune_idx),
+                          default_order);
+  m_D1D = fem_order::d1d(order);
+  m_Q1D = fem_order::q1d(order);
+  m_NE = getOrderNumElements(order);
+
+  allocAndInitDataConst(m_B, int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_Bt,int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_D, int(m_Q1D*m_Q1D*m_NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_X, int(m_D1D*m_D1D*m_NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_Y, int(m_D1D*m_D1D*m_NE), Real_type(0.0), vid);
+}
+
+void MASS2DPA::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_Y, m_D1D*m_D1D*m_NE, vid);
+}
+
+void MASS2DPA::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+
+  deallocData(m_B, vid);
+  deallocData(m_Bt, vid);
+  deallocData(m_D, vid);
+  deallocData(m_X, vid);
+  deallocData(m_Y, vid);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
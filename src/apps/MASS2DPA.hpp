@@ -0,0 +1,240 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Action of 2D mass matrix via partial assembly
+///
+/// Based on MFEM's/CEED algorithms.
+/// Reference implementation
+/// https://github.com/mfem/mfem/blob/master/fem/bilininteg_mass_pa.cpp
+///
+/// for (int e = 0; e < NE; ++e) {
+///
+///   constexpr int MQ1 = Q1D;
+///   constexpr int MD1 = D1D;
+///   constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1;
+///   double sDQ[MQ1 * MD1];
+///   double(*Bsmem)[MD1] = (double(*)[MD1])sDQ;
+///   double(*Btsmem)[MQ1] = (double(*)[MQ1])sDQ;
+///   double sm0[MDQ * MDQ];
+///   double sm1[MDQ * MDQ];
+///   double(*Xsmem)[MD1] = (double(*)[MD1])sm0;
+///   double(*DQ)[MQ1] = (double(*)[MQ1])sm1;
+///   double(*QQ)[MQ1] = (double(*)[MQ1])sm0;
+///   double(*QD)[MD1] = (double(*)[MD1])sm1;
+///
+///   for(int dy=0; dy<D1D; ++dy) {
+///     for(int dx=0; dx<D1D; ++dx) {
+///       Xsmem[dy][dx] = X_(dx, dy, e);
+///     }
+///     for(int dx=0; dx<Q1D; ++dx) {
+///       Bsmem[dx][dy] = B_(dx, dy);
+///     }
+///   }
+///
+///   for(int dy=0; dy<D1D; ++dy) {
+///     for(int qx=0; qx<Q1D; ++qx) {
+///       double u = 0.0;
+///       for (int dx = 0; dx < D1D; ++dx) {
+///         u += Xsmem[dy][dx] * Bsmem[qx][dx];
+///       }
+///       DQ[dy][qx] = u;
+///     }
+///   }
+///
+///   for(int qy=0; qy<Q1D; ++qy) {
+///     for(int qx=0; qx<Q1D; ++qx) {
+///       double u = 0.0;
+///       for (int dy = 0; dy < D1D; ++dy) {
+///         u += DQ[dy][qx] * Bsmem[qy][dy];
+///       }
+///       QQ[qy][qx] = u * D_(qx, qy, e);
+///     }
+///   }
+///
+///   for(int d=0; d<D1D; ++d) {
+///     for(int q=0; q<Q1D; ++q) {
+///       Btsmem[d][q] = Bt_(q, d);
+///     }
+///   }
+///
+///   for(int qy=0; qy<Q1D; ++qy) {
+///     for(int dx=0; dx<D1D; ++dx) {
+///       double u = 0.0;
+///       for (int qx = 0; qx < Q1D; ++qx) {
+///         u += QQ[qy][qx] * Btsmem[dx][qx];
+///       }
+///       QD[qy][dx] = u;
+///     }
+///   }
+///
+///   for(int dy=0; dy<D1D; ++dy) {
+///     for(int dx=0; dx<D1D; ++dx) {
+///       double u = 0.0;
+///       for (int qy = 0; qy < Q1D; ++qy) {
+///         u += QD[qy][dx] * Btsmem[dy][qy];
+///       }
+///       Y_(dx, dy, e) += u;
+///     }
+///   }
+///
+/// } // element loop
+///
+
+#ifndef RAJAPerf_Apps_MASS2DPA_HPP
+#define RAJAPerf_Apps_MASS2DPA_HPP
+
+#define MASS2DPA_DATA_SETUP \
+Real_ptr B = m_B; \
+Real_ptr Bt = m_Bt; \
+Real_ptr D = m_D; \
+Real_ptr X = m_X; \
+Real_ptr Y = m_Y; \
+Index_type NE = m_NE;
+
+#include "common/KernelBase.hpp"
+#include "FEM_MACROS.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+// Number of Dofs/Qpts in 1D, D1D and Q1D, are template parameters of the
+// variant implementations set by the polynomial order of the tuning
+#define m2pa_B(x, y) B[x + Q1D * y]
+#define m2pa_Bt(x, y) Bt[x + D1D * y]
+#define m2paX_(dx, dy, e) X[dx + D1D * dy + D1D * D1D * e]
+#define m2paY_(dx, dy, e) Y[dx + D1D * dy + D1D * D1D * e]
+#define m2pa_D(qx, qy, e) D[qx + Q1D * qy + Q1D * Q1D * e]
+
+#define MASS2DPA_0_CPU \
+        constexpr int MQ1 = Q1D; \
+        constexpr int MD1 = D1D; \
+        constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
+        double sDQ[MQ1 * MD1]; \
+        double(*Bsmem)[MD1] = (double(*)[MD1])sDQ; \
+        double(*Btsmem)[MQ1] = (double(*)[MQ1])sDQ; \
+        double sm0[MDQ * MDQ]; \
+        double sm1[MDQ * MDQ]; \
+        double(*Xsmem)[MD1] = (double(*)[MD1])sm0; \
+        double(*DQ)[MQ1] = (double(*)[MQ1])sm1; \
+        double(*QQ)[MQ1] = (double(*)[MQ1])sm0; \
+        double(*QD)[MD1] = (double(*)[MD1])sm1;
+
+#define MASS2DPA_1 \
+  Xsmem[dy][dx] = m2paX_(dx, dy, e);
+
+#define MASS2DPA_2 \
+  Bsmem[dx][dy] = m2pa_B(dx, dy);
+
+// 2 * D1D * D1D * Q1D
+#define MASS2DPA_3 \
+  double u = 0.0; \
+  RAJAPERF_UNROLL(MD1) \
+  for (int dx = 0; dx < D1D; ++dx) { \
+    u += Xsmem[dy][dx] * Bsmem[qx][dx]; \
+  } \
+  DQ[dy][qx] = u;
+
+// 2 * D1D * Q1D * Q1D + Q1D * Q1D
+#define MASS2DPA_4 \
+  double u = 0.0; \
+  RAJAPERF_UNROLL(MD1) \
+  for (int dy = 0; dy < D1D; ++dy) { \
+    u += DQ[dy][qx] * Bsmem[qy][dy]; \
+  } \
+  QQ[qy][qx] = u * m2pa_D(qx, qy, e);
+
+#define MASS2DPA_5 \
+  Btsmem[d][q] = m2pa_Bt(q, d);
+
+// 2 * Q1D * Q1D * D1D
+#define MASS2DPA_6 \
+  double u = 0.0; \
+  RAJAPERF_UNROLL(MQ1) \
+  for (int qx = 0; qx < Q1D; ++qx) { \
+    u += QQ[qy][qx] * Btsmem[dx][qx]; \
+  } \
+  QD[qy][dx] = u;
+
+// 2 * Q1D * D1D * D1D + D1D * D1D
+#define MASS2DPA_7 \
+  double u = 0.0; \
+  RAJAPERF_UNROLL(MQ1) \
+  for (int qy = 0; qy < Q1D; ++qy) { \
+    u += QD[qy][dx] * Btsmem[dy][qy]; \
+  } \
+  m2paY_(dx, dy, e) += u;
+
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class MASS2DPA : public KernelBase
+{
+public:
+
+  MASS2DPA(const RunParams& params);
+
+  ~MASS2DPA();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  MASS2DPA : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  MASS2DPA : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  MASS2DPA : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < int D1D, int Q1D >
+  void runSeqVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_order = 3;
+  static const size_t max_order = 8;
+  using orders_type = fem_order::make_list_type<default_order,
+                                                fem_order::MaxOrder<max_order>>;
+
+  // element count, bytes, and FLOPs per rep of the given order
+  Index_type getOrderNumElements(size_t order) const;
+  Index_type getOrderBytesPerRep(size_t order) const;
+  Index_type getOrderFLOPsPerRep(size_t order) const;
+
+  Real_ptr m_B;
+  Real_ptr m_Bt;
+  Real_ptr m_D;
+  Real_ptr m_X;
+  Real_ptr m_Y;
+
+  Index_type m_NE;
+  int m_D1D;
+  int m_Q1D;
+  Index_type m_NE_default;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
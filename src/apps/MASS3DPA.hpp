@@ -15,8 +15,8 @@
 ///
 /// for (int e = 0; e < NE; ++e) {
 ///
-///   constexpr int MQ1 = MPA_Q1D;
-///   constexpr int MD1 = MPA_D1D;
+///   constexpr int MQ1 = Q1D;
+///   constexpr int MD1 = D1D;
 ///   constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1;
 ///   double sDQ[MQ1 * MD1];
 ///   double(*Bsmem)[MD1] = (double(*)[MD1])sDQ;
@@ -30,120 +30,120 @@
 ///   double(*QQD)[MQ1][MD1] = (double(*)[MQ1][MD1])sm0;
 ///   double(*QDD)[MD1][MD1] = (double(*)[MD1][MD1])sm1;
 ///
-///   for(int dy=0; dy<MPA_D1D; ++dy) {
-///     for(int dx=0; dx<MPA_D1D; ++dx) {
-///       for (int dz = 0; dz< MPA_D1D; ++dz) {
+///   for(int dy=0; dy<D1D; ++dy) {
+///     for(int dx=0; dx<D1D; ++dx) {
+///       for (int dz = 0; dz< D1D; ++dz) {
 ///         Xsmem[dz][dy][dx] = X_(dx, dy, dz, e);
 ///       }
 ///     }
-///     for(int dx=0; dx<MPA_Q1D; ++dx) {
+///     for(int dx=0; dx<Q1D; ++dx) {
 ///      Bsmem[dx][dy] = B_(dx, dy);
 ///     }
 ///   }
 ///
-///   for(int dy=0; dy<MPA_D1D; ++dy) {
-///     for(int dx=0; dx<MPA_Q1D; ++dx) {
-///       double u[MPA_D1D];
-///       for (int dz = 0; dz < MPA_D1D; dz++) {
+///   for(int dy=0; dy<D1D; ++dy) {
+///     for(int dx=0; dx<Q1D; ++dx) {
+///       double u[D1D];
+///       for (int dz = 0; dz < D1D; dz++) {
 ///           u[dz] = 0;
 ///       }
-///       for (int dx = 0; dx < MPA_D1D; ++dx) {
-///         for (int dz = 0; dz < MPA_D1D; ++dz) {
+///       for (int dx = 0; dx < D1D; ++dx) {
+///         for (int dz = 0; dz < D1D; ++dz) {
 ///           u[dz] += Xsmem[dz][dy][dx] * Bsmem[qx][dx];
 ///          }
 ///       }
-///       for (int dz = 0; dz < MPA_D1D; ++dz) {
+///       for (int dz = 0; dz < D1D; ++dz) {
 ///         DDQ[dz][dy][qx] = u[dz];
 ///       }
 ///     }
 ///   }
 ///
-///   for(int qy=0; qy<MPA_Q1D; ++qy) {
-///     for(int qx=0; qx<MPA_Q1D; ++qx) {
-///       double u[MPA_D1D];
-///       for (int dz = 0; dz < MPA_D1D; dz++) {
+///   for(int qy=0; qy<Q1D; ++qy) {
+///     for(int qx=0; qx<Q1D; ++qx) {
+///       double u[D1D];
+///       for (int dz = 0; dz < D1D; dz++) {
 ///         u[dz] = 0;
 ///       }
-///       for (int dy = 0; dy < MPA_D1D; ++dy) {
-///         for (int dz = 0; dz < MPA_D1D; dz++) {
+///       for (int dy = 0; dy < D1D; ++dy) {
+///         for (int dz = 0; dz < D1D; dz++) {
 ///           u[dz] += DDQ[dz][dy][qx] * Bsmem[qy][dy];
 ///         }
 ///       }
-///       for (int dz = 0; dz < MPA_D1D; dz++) {
+///       for (int dz = 0; dz < D1D; dz++) {
 ///         DQQ[dz][qy][qx] = u[dz];
 ///       }
 ///     }
 ///   }
 ///
-///   for(int qy=0; qy<MPA_Q1D; ++qy) {
-///     for(int qx=0; qx<MPA_Q1D; ++qx) {
-///       double u[MPA_Q1D];
-///       for (int qz = 0; qz < MPA_Q1D; qz++) {
+///   for(int qy=0; qy<Q1D; ++qy) {
+///     for(int qx=0; qx<Q1D; ++qx) {
+///       double u[Q1D];
+///       for (int qz = 0; qz < Q1D; qz++) {
 ///         u[qz] = 0;
 ///       }
-///       for (int dz = 0; dz < MPA_D1D; ++dz) {
-///         for (int qz = 0; qz < MPA_Q1D; qz++) {
+///       for (int dz = 0; dz < D1D; ++dz) {
+///         for (int qz = 0; qz < Q1D; qz++) {
 ///            u[qz] += DQQ[dz][qy][qx] * Bsmem[qz][dz];
 ///          }
 ///       }
-///       for (int qz = 0; qz < MPA_Q1D; qz++) {
+///       for (int qz = 0; qz < Q1D; qz++) {
 ///         QQQ[qz][qy][qx] = u[qz] * D_(qx, qy, qz, e);
 ///       }
 ///     }
 ///   }
 ///
-///   for(int d=0; d<MPA_D1D; ++d) {
-///     for(int q=0; q<MPA_Q1D; ++q) {
+///   for(int d=0; d<D1D; ++d) {
+///     for(int q=0; q<Q1D; ++q) {
 ///       Btsmem[d][q] = Bt_(q, d);
 ///     }
 ///   }
 ///
-///   for(int qy=0; qy<MPA_Q1D; ++qy) {
-///     for(int dx=0; dx<MPA_D1D; ++dx) {
-///       double u[MPA_Q1D];
-///       for (int qz = 0; qz < MPA_Q1D; ++qz) {
+///   for(int qy=0; qy<Q1D; ++qy) {
+///     for(int dx=0; dx<D1D; ++dx) {
+///       double u[Q1D];
+///       for (int qz = 0; qz < Q1D; ++qz) {
 ///         u[qz] = 0;
 ///       }
-///       for (int qx = 0; qx < MPA_Q1D; ++qx) {
-///         for (int qz = 0; qz < MPA_Q1D; ++qz) {
+///       for (int qx = 0; qx < Q1D; ++qx) {
+///         for (int qz = 0; qz < Q1D; ++qz) {
 ///           u[qz] += QQQ[qz][qy][qx] * Btsmem[dx][qx];
 ///         }
 ///       }
-///       for (int qz = 0; qz < MPA_Q1D; ++qz) {
+///       for (int qz = 0; qz < Q1D; ++qz) {
 ///          QQD[qz][qy][dx] = u[qz];
 ///       }
 ///     }
 ///   }
 ///
-///   for(int dy=0; dy<MPA_D1D; ++dy) {
-///     for(int dx=0; dx<MPA_D1D; ++dx) {
-///       double u[MPA_Q1D];
-///       for (int qz = 0; qz < MPA_Q1D; ++qz) {
+///   for(int dy=0; dy<D1D; ++dy) {
+///     for(int dx=0; dx<D1D; ++dx) {
+///       double u[Q1D];
+///       for (int qz = 0; qz < Q1D; ++qz) {
 ///          u[qz] = 0;
 ///       }
-///       for (int qy = 0; qy < MPA_Q1D; ++qy) {
-///         for (int qz = 0; qz < MPA_Q1D; ++qz) {
+///       for (int qy = 0; qy < Q1D; ++qy) {
+///         for (int qz = 0; qz < Q1D; ++qz) {
 ///           u[qz] += QQD[qz][qy][dx] * Btsmem[dy][qy];
 ///          }
 ///       }
-///       for (int qz = 0; qz < MPA_Q1D; ++qz) {
+///       for (int qz = 0; qz < Q1D; ++qz) {
 ///         QDD[qz][dy][dx] = u[qz];
 ///       }
 ///     }
 ///   }
 ///
-///   for(int dy=0; dy<MPA_D1D; ++dy) {
-///     for(int dx=0; dx<MPA_D1D; ++dx) {
-///       double u[MPA_D1D];
-///       for (int dz = 0; dz < MPA_D1D; ++dz) {
+///   for(int dy=0; dy<D1D; ++dy) {
+///     for(int dx=0; dx<D1D; ++dx) {
+///       double u[D1D];
+///       for (int dz = 0; dz < D1D; ++dz) {
 ///        u[dz] = 0;
 ///       }
-///       for (int qz = 0; qz < MPA_Q1D; ++qz) {
-///         for (int dz = 0; dz < MPA_D1D; ++dz) {
+///       for (int qz = 0; qz < Q1D; ++qz) {
+///         for (int dz = 0; dz < D1D; ++dz) {
 ///            u[dz] += QDD[qz][dy][dx] * Btsmem[dz][qz];
 ///          }
 ///       }
-///       for (int dz = 0; dz < MPA_D1D; ++dz) {
+///       for (int dz = 0; dz < D1D; ++dz) {
 ///         Y_(dx, dy, dz, e) += u[dz];
 ///       }
 ///     }
@@ -168,21 +168,20 @@ Index_type NE = m_NE;
 
 #include "RAJA/RAJA.hpp"
 
-//Number of Dofs/Qpts in 1D
-#define MPA_D1D 4
-#define MPA_Q1D 5
-#define B_(x, y) B[x + MPA_Q1D * y]
-#define Bt_(x, y) Bt[x + MPA_D1D * y]
+// Number of Dofs/Qpts in 1D, D1D and Q1D, are template parameters of the
+// variant implementations set by the polynomial order of the tuning
+#define B_(x, y) B[x + Q1D * y]
+#define Bt_(x, y) Bt[x + D1D * y]
 #define X_(dx, dy, dz, e)                                                      \
-  X[dx + MPA_D1D * dy + MPA_D1D * MPA_D1D * dz + MPA_D1D * MPA_D1D * MPA_D1D * e]
+  X[dx + D1D * dy + D1D * D1D * dz + D1D * D1D * D1D * e]
 #define Y_(dx, dy, dz, e)                                                      \
-  Y[dx + MPA_D1D * dy + MPA_D1D * MPA_D1D * dz + MPA_D1D * MPA_D1D * MPA_D1D * e]
+  Y[dx + D1D * dy + D1D * D1D * dz + D1D * D1D * D1D * e]
 #define D_(qx, qy, qz, e)                                                      \
-  D[qx + MPA_Q1D * qy + MPA_Q1D * MPA_Q1D * qz + MPA_Q1D * MPA_Q1D * MPA_Q1D * e]
+  D[qx + Q1D * qy + Q1D * Q1D * qz + Q1D * Q1D * Q1D * e]
 
 #define MASS3DPA_0_CPU           \
-        constexpr int MQ1 = MPA_Q1D; \
-        constexpr int MD1 = MPA_D1D; \
+        constexpr int MQ1 = Q1D; \
+        constexpr int MD1 = D1D; \
         constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
         double sDQ[MQ1 * MD1]; \
         double(*Bsmem)[MD1] = (double(*)[MD1])sDQ; \
@@ -197,8 +196,8 @@ Index_type NE = m_NE;
         double(*QDD)[MD1][MD1] = (double(*)[MD1][MD1])sm1;
 
 #define MASS3DPA_0_GPU \
-        constexpr int MQ1 = MPA_Q1D; \
-        constexpr int MD1 = MPA_D1D; \
+        constexpr int MQ1 = Q1D; \
+        constexpr int MD1 = D1D; \
         constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
         RAJA_TEAM_SHARED  double sDQ[MQ1 * MD1];     \
         double(*Bsmem)[MD1] = (double(*)[MD1])sDQ; \
@@ -214,130 +213,265 @@ Index_type NE = m_NE;
 
 #define MASS3DPA_1 \
   RAJAPERF_UNROLL(MD1) \
-for (int dz = 0; dz< MPA_D1D; ++dz) { \
+for (int dz = 0; dz< D1D; ++dz) { \
 Xsmem[dz][dy][dx] = X_(dx, dy, dz, e); \
 }
 
 #define MASS3DPA_2 \
   Bsmem[dx][dy] = B_(dx, dy);
 
-// 2 * MPA_D1D * MPA_D1D * MPA_D1D * MPA_Q1D
+// 2 * D1D * D1D * D1D * Q1D
 #define MASS3DPA_3 \
-  double u[MPA_D1D]; \
+  double u[D1D]; \
 RAJAPERF_UNROLL(MD1) \
-for (int dz = 0; dz < MPA_D1D; dz++) { \
+for (int dz = 0; dz < D1D; dz++) { \
 u[dz] = 0; \
 } \
 RAJAPERF_UNROLL(MD1) \
-for (int dx = 0; dx < MPA_D1D; ++dx) { \
+for (int dx = 0; dx < D1D; ++dx) { \
 RAJAPERF_UNROLL(MD1) \
-for (int dz = 0; dz < MPA_D1D; ++dz) { \
+for (int dz = 0; dz < D1D; ++dz) { \
 u[dz] += Xsmem[dz][dy][dx] * Bsmem[qx][dx]; \
 } \
 } \
 RAJAPERF_UNROLL(MD1) \
-for (int dz = 0; dz < MPA_D1D; ++dz) { \
+for (int dz = 0; dz < D1D; ++dz) { \
 DDQ[dz][dy][qx] = u[dz]; \
 }
 
-//2 * MPA_D1D * MPA_D1D * MPA_Q1D * MPA_Q1D
+//2 * D1D * D1D * Q1D * Q1D
 #define MASS3DPA_4 \
-            double u[MPA_D1D]; \
+            double u[D1D]; \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; dz++) { \
+            for (int dz = 0; dz < D1D; dz++) { \
               u[dz] = 0; \
             } \
             RAJAPERF_UNROLL(MD1) \
-            for (int dy = 0; dy < MPA_D1D; ++dy) { \
+            for (int dy = 0; dy < D1D; ++dy) { \
               RAJAPERF_UNROLL(MD1) \
-              for (int dz = 0; dz < MPA_D1D; dz++) { \
+              for (int dz = 0; dz < D1D; dz++) { \
                 u[dz] += DDQ[dz][dy][qx] * Bsmem[qy][dy]; \
               } \
             } \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; dz++) { \
+            for (int dz = 0; dz < D1D; dz++) { \
               DQQ[dz][qy][qx] = u[dz]; \
             }
 
-//2 * MPA_D1D * MPA_Q1D * MPA_Q1D * MPA_Q1D + MPA_Q1D * MPA_Q1D * MPA_Q1D
+//2 * D1D * Q1D * Q1D * Q1D + Q1D * Q1D * Q1D
 #define MASS3DPA_5 \
-            double u[MPA_Q1D]; \
+            double u[Q1D]; \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; qz++) { \
+            for (int qz = 0; qz < Q1D; qz++) { \
               u[qz] = 0; \
             } \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; ++dz) { \
+            for (int dz = 0; dz < D1D; ++dz) { \
               RAJAPERF_UNROLL(MQ1) \
-              for (int qz = 0; qz < MPA_Q1D; qz++) { \
+              for (int qz = 0; qz < Q1D; qz++) { \
                 u[qz] += DQQ[dz][qy][qx] * Bsmem[qz][dz]; \
               } \
             } \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; qz++) { \
+            for (int qz = 0; qz < Q1D; qz++) { \
               QQQ[qz][qy][qx] = u[qz] * D_(qx, qy, qz, e); \
             }
 
 #define MASS3DPA_6 \
   Btsmem[d][q] = Bt_(q, d);
 
-//2 * MPA_Q1D * MPA_Q1D * MPA_Q1D * MPA_D1D
+//2 * Q1D * Q1D * Q1D * D1D
 #define MASS3DPA_7 \
-  double u[MPA_Q1D]; \
+  double u[Q1D]; \
 RAJAPERF_UNROLL(MQ1) \
-for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+for (int qz = 0; qz < Q1D; ++qz) { \
   u[qz] = 0; \
  } \
 RAJAPERF_UNROLL(MQ1) \
-for (int qx = 0; qx < MPA_Q1D; ++qx) { \
+for (int qx = 0; qx < Q1D; ++qx) { \
   RAJAPERF_UNROLL(MQ1) \
-    for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+    for (int qz = 0; qz < Q1D; ++qz) { \
       u[qz] += QQQ[qz][qy][qx] * Btsmem[dx][qx]; \
     } \
  } \
 RAJAPERF_UNROLL(MQ1) \
-for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+for (int qz = 0; qz < Q1D; ++qz) { \
   QQD[qz][qy][dx] = u[qz]; \
  }
 
-// 2 * MPA_Q1D * MPA_Q1D * MPA_D1D * MPA_D1D
+// 2 * Q1D * Q1D * D1D * D1D
 #define MASS3DPA_8 \
-            double u[MPA_Q1D]; \
+            double u[Q1D]; \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+            for (int qz = 0; qz < Q1D; ++qz) { \
               u[qz] = 0; \
             } \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qy = 0; qy < MPA_Q1D; ++qy) { \
+            for (int qy = 0; qy < Q1D; ++qy) { \
               RAJAPERF_UNROLL(MQ1) \
-              for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+              for (int qz = 0; qz < Q1D; ++qz) { \
                 u[qz] += QQD[qz][qy][dx] * Btsmem[dy][qy]; \
               } \
             } \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+            for (int qz = 0; qz < Q1D; ++qz) { \
               QDD[qz][dy][dx] = u[qz]; \
             }
 
-//2 * MPA_Q1D * MPA_D1D * MPA_D1D * MPA_D1D + MPA_D1D * MPA_D1D * MPA_D1D
+//2 * Q1D * D1D * D1D * D1D + D1D * D1D * D1D
 #define MASS3DPA_9 \
-            double u[MPA_D1D]; \
+            double u[D1D]; \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; ++dz) { \
+            for (int dz = 0; dz < D1D; ++dz) { \
               u[dz] = 0; \
             } \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+            for (int qz = 0; qz < Q1D; ++qz) { \
               RAJAPERF_UNROLL(MD1) \
-              for (int dz = 0; dz < MPA_D1D; ++dz) { \
+              for (int dz = 0; dz < D1D; ++dz) { \
                 u[dz] += QDD[qz][dy][dx] * Btsmem[dz][qz]; \
               } \
             } \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; ++dz) { \
+            for (int dz = 0; dz < D1D; ++dz) { \
               Y_(dx, dy, dz, e) += u[dz]; \
             }
 
+//
+// Batched CPU version: the elements e0 to e0+W-1 are processed together
+// with their data interleaved, element fastest, so each contraction below
+// is a loop over the W elements of the batch that vectorizes. Lanes past
+// the last element repeat it and are not written back.
+//
+#define MASS3DPA_BATCH_0_CPU \
+        constexpr int MQ1 = Q1D; \
+        constexpr int MD1 = D1D; \
+        constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
+        constexpr int W = RAJAPERF_FEM_BATCH_WIDTH; \
+        const int nw = (NE - e0 < W) ? static_cast<int>(NE - e0) : W; \
+        Index_type ew[W]; \
+        for (int iw = 0; iw < W; ++iw) { \
+          ew[iw] = e0 + ((iw < nw) ? iw : nw - 1); \
+        } \
+        double sDQ[MQ1 * MD1]; \
+        double(*Bsmem)[MD1] = (double(*)[MD1])sDQ; \
+        double(*Btsmem)[MQ1] = (double(*)[MQ1])sDQ; \
+        double sm0[MDQ * MDQ * MDQ][W]; \
+        double sm1[MDQ * MDQ * MDQ][W]; \
+        double(*Xsmem)[MD1][MD1][W] = (double(*)[MD1][MD1][W])sm0; \
+        double(*DDQ)[MD1][MQ1][W] = (double(*)[MD1][MQ1][W])sm1; \
+        double(*DQQ)[MQ1][MQ1][W] = (double(*)[MQ1][MQ1][W])sm0; \
+        double(*QQQ)[MQ1][MQ1][W] = (double(*)[MQ1][MQ1][W])sm1; \
+        double(*QQD)[MQ1][MD1][W] = (double(*)[MQ1][MD1][W])sm0; \
+        double(*QDD)[MD1][MD1][W] = (double(*)[MD1][MD1][W])sm1;
+
+#define MASS3DPA_BATCH_1 \
+  for (int dz = 0; dz < D1D; ++dz) { \
+    BATCH_FOREACH(iw) { \
+      Xsmem[dz][dy][dx][iw] = X_(dx, dy, dz, ew[iw]); \
+    } \
+  }
+
+#define MASS3DPA_BATCH_3 \
+  double u[D1D][W]; \
+  for (int dz = 0; dz < D1D; dz++) { \
+    BATCH_FOREACH(iw) { u[dz][iw] = 0; } \
+  } \
+  for (int dx = 0; dx < D1D; ++dx) { \
+    for (int dz = 0; dz < D1D; ++dz) { \
+      BATCH_FOREACH(iw) { \
+        u[dz][iw] += Xsmem[dz][dy][dx][iw] * Bsmem[qx][dx]; \
+      } \
+    } \
+  } \
+  for (int dz = 0; dz < D1D; ++dz) { \
+    BATCH_FOREACH(iw) { DDQ[dz][dy][qx][iw] = u[dz][iw]; } \
+  }
+
+#define MASS3DPA_BATCH_4 \
+  double u[D1D][W]; \
+  for (int dz = 0; dz < D1D; dz++) { \
+    BATCH_FOREACH(iw) { u[dz][iw] = 0; } \
+  } \
+  for (int dy = 0; dy < D1D; ++dy) { \
+    for (int dz = 0; dz < D1D; dz++) { \
+      BATCH_FOREACH(iw) { \
+        u[dz][iw] += DDQ[dz][dy][qx][iw] * Bsmem[qy][dy]; \
+      } \
+    } \
+  } \
+  for (int dz = 0; dz < D1D; dz++) { \
+    BATCH_FOREACH(iw) { DQQ[dz][qy][qx][iw] = u[dz][iw]; } \
+  }
+
+#define MASS3DPA_BATCH_5 \
+  double u[Q1D][W]; \
+  for (int qz = 0; qz < Q1D; qz++) { \
+    BATCH_FOREACH(iw) { u[qz][iw] = 0; } \
+  } \
+  for (int dz = 0; dz < D1D; ++dz) { \
+    for (int qz = 0; qz < Q1D; qz++) { \
+      BATCH_FOREACH(iw) { \
+        u[qz][iw] += DQQ[dz][qy][qx][iw] * Bsmem[qz][dz]; \
+      } \
+    } \
+  } \
+  for (int qz = 0; qz < Q1D; qz++) { \
+    BATCH_FOREACH(iw) { \
+      QQQ[qz][qy][qx][iw] = u[qz][iw] * D_(qx, qy, qz, ew[iw]); \
+    } \
+  }
+
+#define MASS3DPA_BATCH_7 \
+  double u[Q1D][W]; \
+  for (int qz = 0; qz < Q1D; ++qz) { \
+    BATCH_FOREACH(iw) { u[qz][iw] = 0; } \
+  } \
+  for (int qx = 0; qx < Q1D; ++qx) { \
+    for (int qz = 0; qz < Q1D; ++qz) { \
+      BATCH_FOREACH(iw) { \
+        u[qz][iw] += QQQ[qz][qy][qx][iw] * Btsmem[dx][qx]; \
+      } \
+    } \
+  } \
+  for (int qz = 0; qz < Q1D; ++qz) { \
+    BATCH_FOREACH(iw) { QQD[qz][qy][dx][iw] = u[qz][iw]; } \
+  }
+
+#define MASS3DPA_BATCH_8 \
+  double u[Q1D][W]; \
+  for (int qz = 0; qz < Q1D; ++qz) { \
+    BATCH_FOREACH(iw) { u[qz][iw] = 0; } \
+  } \
+  for (int qy = 0; qy < Q1D; ++qy) { \
+    for (int qz = 0; qz < Q1D; ++qz) { \
+      BATCH_FOREACH(iw) { \
+        u[qz][iw] += QQD[qz][qy][dx][iw] * Btsmem[dy][qy]; \
+      } \
+    } \
+  } \
+  for (int qz = 0; qz < Q1D; ++qz) { \
+    BATCH_FOREACH(iw) { QDD[qz][dy][dx][iw] = u[qz][iw]; } \
+  }
+
+#define MASS3DPA_BATCH_9 \
+  double u[D1D][W]; \
+  for (int dz = 0; dz < D1D; ++dz) { \
+    BATCH_FOREACH(iw) { u[dz][iw] = 0; } \
+  } \
+  for (int qz = 0; qz < Q1D; ++qz) { \
+    for (int dz = 0; dz < D1D; ++dz) { \
+      BATCH_FOREACH(iw) { \
+        u[dz][iw] += QDD[qz][dy][dx][iw] * Btsmem[dz][qz]; \
+      } \
+    } \
+  } \
+  for (int dz = 0; dz < D1D; ++dz) { \
+    for (int iw = 0; iw < nw; ++iw) { \
+      Y_(dx, dy, dz, ew[iw]) += u[dz][iw]; \
+    } \
+  }
+
 
 namespace rajaperf
 {
@@ -364,16 +498,33 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
-  template < size_t block_size >
+  template < int D1D, int Q1D >
+  void runSeqVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
   void runCudaVariantImpl(VariantID vid);
-  template < size_t block_size >
+  template < int D1D, int Q1D >
   void runHipVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runSeqVariantBatch(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantBatch(VariantID vid);
 
 private:
-  static const size_t default_gpu_block_size = MPA_Q1D * MPA_Q1D;
-  using gpu_block_sizes_type = gpu_block_size::list_type<default_gpu_block_size>;
+  static const size_t default_order = 3;
+  static const size_t max_order = 8;
+  using orders_type = fem_order::make_list_type<default_order,
+                                                fem_order::MaxOrder<max_order>>;
+
+  // element count, bytes, and FLOPs per rep of the given order
+  Index_type getOrderNumElements(size_t order) const;
+  Index_type getOrderBytesPerRep(size_t order) const;
+  Index_type getOrderFLOPsPerRep(size_t order) const;
 
   Real_ptr m_B;
   Real_ptr m_Bt;
@@ -382,6 +533,8 @@ private:
   Real_ptr m_Y;
 
   Index_type m_NE;
+  int m_D1D;
+  int m_Q1D;
   Index_type m_NE_default;
 };
 
@@ -13,6 +13,11 @@
 #include "AppsData.hpp"
 
 #include <iostream>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include <omp.h>
+#endif
 
 namespace rajaperf
 {
@@ -20,7 +25,367 @@ namespace apps
 {
 
 
-void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Loop_T, typename List_T >
+void NODAL_ACCUMULATION_3D::runOpenMPVariantImpl(VariantID vid, List_T* real_zones)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Loop_T ibegin = 0;
+  const Loop_T iend = m_domain->n_real_zones;
+
+  NODAL_ACCUMULATION_3D_COMMON_DATA_SETUP;
+
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Loop_T ii = ibegin ; ii < iend ; ++ii ) {
+          NODAL_ACCUMULATION_3D_BODY_INDEX;
+
+          Real_type val = 0.125 * vol[i];
+
+          #pragma omp atomic
+          x0[i] += val;
+          #pragma omp atomic
+          x1[i] += val;
+          #pragma omp atomic
+          x2[i] += val;
+          #pragma omp atomic
+          x3[i] += val;
+          #pragma omp atomic
+          x4[i] += val;
+          #pragma omp atomic
+          x5[i] += val;
+          #pragma omp atomic
+          x6[i] += val;
+          #pragma omp atomic
+          x7[i] += val;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto nodal_accumulation_3d_lam = [=](Loop_T ii) {
+            NODAL_ACCUMULATION_3D_BODY_INDEX;
+
+            Real_type val = 0.125 * vol[i];
+
+            #pragma omp atomic
+            x0[i] += val;
+            #pragma omp atomic
+            x1[i] += val;
+            #pragma omp atomic
+            x2[i] += val;
+            #pragma omp atomic
+            x3[i] += val;
+            #pragma omp atomic
+            x4[i] += val;
+            #pragma omp atomic
+            x5[i] += val;
+            #pragma omp atomic
+            x6[i] += val;
+            #pragma omp atomic
+            x7[i] += val;
+          };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Loop_T ii = ibegin ; ii < iend ; ++ii ) {
+          nodal_accumulation_3d_lam(ii);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      camp::resources::Resource working_res{camp::resources::Host()};
+      RAJA::TypedListSegment<List_T> zones(real_zones, iend,
+                                           working_res, RAJA::Unowned);
+
+      auto nodal_accumulation_3d_lam = [=](List_T i) {
+                                         NODAL_ACCUMULATION_3D_RAJA_ATOMIC_BODY(RAJA::omp_atomic);
+                                       };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          zones, nodal_accumulation_3d_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(real_zones);
+#endif
+}
+
+void NODAL_ACCUMULATION_3D::runOpenMPVariantColor(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  NODAL_ACCUMULATION_3D_COLOR_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < s_num_colors; ++c) {
+          #pragma omp parallel for
+          for (Index_type ii = color_offsets[c] ; ii < color_offsets[c+1] ; ++ii ) {
+            NODAL_ACCUMULATION_3D_COLOR_BODY_INDEX;
+            NODAL_ACCUMULATION_3D_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto nodal_accumulation_3d_color_lam = [=](Index_type ii) {
+            NODAL_ACCUMULATION_3D_COLOR_BODY_INDEX;
+            NODAL_ACCUMULATION_3D_BODY;
+          };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < s_num_colors; ++c) {
+          #pragma omp parallel for
+          for (Index_type ii = color_offsets[c] ; ii < color_offsets[c+1] ; ++ii ) {
+            nodal_accumulation_3d_color_lam(ii);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      camp::resources::Resource working_res{camp::resources::Host()};
+      std::vector<RAJA::TypedListSegment<Index_type>> color_segments;
+      for (Index_type c = 0; c < s_num_colors; ++c) {
+        color_segments.emplace_back(color_zones + color_offsets[c],
+                                    color_offsets[c+1] - color_offsets[c],
+                                    working_res, RAJA::Unowned);
+      }
+
+      auto nodal_accumulation_3d_lam = [=](Index_type i) {
+                                         NODAL_ACCUMULATION_3D_BODY;
+                                       };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < s_num_colors; ++c) {
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            color_segments[c], nodal_accumulation_3d_lam);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void NODAL_ACCUMULATION_3D::runOpenMPVariantNodeGather(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type nbegin = 0;
+  const Index_type nend = m_domain->n_real_nodes;
+
+  NODAL_ACCUMULATION_3D_GATHER_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type nn = nbegin ; nn < nend ; ++nn ) {
+          NODAL_ACCUMULATION_3D_GATHER_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto nodal_accumulation_3d_gather_lam = [=](Index_type nn) {
+            NODAL_ACCUMULATION_3D_GATHER_BODY;
+          };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type nn = nbegin ; nn < nend ; ++nn ) {
+          nodal_accumulation_3d_gather_lam(nn);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      auto nodal_accumulation_3d_gather_lam = [=](Index_type nn) {
+            NODAL_ACCUMULATION_3D_GATHER_BODY;
+          };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(nbegin, nend), nodal_accumulation_3d_gather_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void NODAL_ACCUMULATION_3D::runOpenMPVariantThreadPrivate(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+  const Index_type nodal_array_length = m_nodal_array_length;
+
+  Real_ptr x = m_x;
+  Real_ptr vol = m_vol;
+  Index_ptr real_zones = m_real_zones;
+
+  if ( vid == Base_OpenMP ) {
+
+    //
+    // Every thread accumulates into its own part of thread_x.
+    //
+    const int max_threads = omp_get_max_threads();
+    Real_ptr thread_x;
+    allocData(thread_x, max_threads*nodal_array_length, vid);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel
+      {
+        const int nthreads = omp_get_num_threads();
+        const int tid = omp_get_thread_num();
+
+        Real_ptr my_x = thread_x + tid*nodal_array_length;
+        for (Index_type n = 0; n < nodal_array_length; ++n) {
+          my_x[n] = 0.0;
+        }
+
+        Real_ptr x0,x1,x2,x3,x4,x5,x6,x7;
+        NDPTRSET(m_domain->jp, m_domain->kp, my_x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+
+        #pragma omp for
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          NODAL_ACCUMULATION_3D_BODY_INDEX;
+          NODAL_ACCUMULATION_3D_BODY;
+        }
+
+        #pragma omp for
+        for (Index_type n = 0; n < nodal_array_length; ++n) {
+          Real_type sum = 0.0;
+          for (int t = 0; t < nthreads; ++t) {
+            sum += thread_x[t*nodal_array_length + n];
+          }
+          x[n] += sum;
+        }
+      }
+
+    }
+    stopTimer();
+
+    deallocData(thread_x, vid);
+
+  } else {
+
+    getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown OpenMP thread private variant id = " << vid << std::endl;
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void NODAL_ACCUMULATION_3D::runOpenMPVariantLayout(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -28,7 +393,7 @@ void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
 
-  NODAL_ACCUMULATION_3D_DATA_SETUP;
+  NODAL_ACCUMULATION_3D_LAYOUT_DATA_SETUP;
 
 
   switch ( vid ) {
@@ -111,7 +476,7 @@ void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
 
       camp::resources::Resource working_res{camp::resources::Host()};
       RAJA::TypedListSegment<Index_type> zones(real_zones, iend,
-                                               working_res, RAJA::Unowned);
+                                           working_res, RAJA::Unowned);
 
       auto nodal_accumulation_3d_lam = [=](Index_type i) {
                                          NODAL_ACCUMULATION_3D_RAJA_ATOMIC_BODY(RAJA::omp_atomic);
@@ -140,5 +505,107 @@ void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
 #endif
 }
 
+void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<Index_type, Index_type>(vid, m_real_zones);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<Int_type, Int_type>(vid, m_real_zones_32);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<Index_type, Int_type>(vid, m_real_zones_32);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<Int_type, Index_type>(vid, m_real_zones);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantColor(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantNodeGather(vid);
+
+  }
+
+  t += 1;
+
+  for (int l = 0; l < data_layout::NumLayouts; ++l) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantLayout(vid);
+
+    }
+
+    t += 1;
+
+  }
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantThreadPrivate(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void NODAL_ACCUMULATION_3D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getIndexTuningName<Int_type, Int_type>(),
+                       getDefaultTuningName());
+  addVariantTuningName(vid, getIndexTuningName<Index_type, Int_type>(),
+                       getDefaultTuningName());
+  addVariantTuningName(vid, getIndexTuningName<Int_type, Index_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, "color8");
+  addVariantTuningName(vid, "node_gather", getDefaultTuningName());
+
+  for (int l = 0; l < data_layout::NumLayouts; ++l) {
+    addVariantTuningName(vid,
+        data_layout::getLayoutName(static_cast<data_layout::Layout>(l)),
+        getDefaultTuningName());
+  }
+
+  if (vid == Base_OpenMP) {
+    addVariantTuningName(vid, "thread_private");
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -13,6 +13,7 @@
 #include "AppsData.hpp"
 
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -20,13 +21,249 @@ namespace apps
 {
 
 
-void NODAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Loop_T, typename List_T >
+void NODAL_ACCUMULATION_3D::runSeqVariantImpl(VariantID vid, List_T* real_zones)
+{
+  const Index_type run_reps = getRunReps();
+  const Loop_T ibegin = 0;
+  const Loop_T iend = m_domain->n_real_zones;
+
+  NODAL_ACCUMULATION_3D_COMMON_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Loop_T ii = ibegin ; ii < iend ; ++ii ) {
+          NODAL_ACCUMULATION_3D_BODY_INDEX;
+          NODAL_ACCUMULATION_3D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto nodal_accumulation_3d_lam = [=](Loop_T ii) {
+                         NODAL_ACCUMULATION_3D_BODY_INDEX;
+                         NODAL_ACCUMULATION_3D_BODY;
+                       };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Loop_T ii = ibegin ; ii < iend ; ++ii ) {
+          nodal_accumulation_3d_lam(ii);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      camp::resources::Resource working_res{camp::resources::Host()};
+      RAJA::TypedListSegment<List_T> zones(real_zones, iend,
+                                           working_res, RAJA::Unowned);
+
+      auto nodal_accumulation_3d_lam = [=](List_T i) {
+                         NODAL_ACCUMULATION_3D_RAJA_ATOMIC_BODY(RAJA::seq_atomic);
+                       };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(zones, nodal_accumulation_3d_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void NODAL_ACCUMULATION_3D::runSeqVariantColor(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  NODAL_ACCUMULATION_3D_COLOR_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < s_num_colors; ++c) {
+          for (Index_type ii = color_offsets[c] ; ii < color_offsets[c+1] ; ++ii ) {
+            NODAL_ACCUMULATION_3D_COLOR_BODY_INDEX;
+            NODAL_ACCUMULATION_3D_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto nodal_accumulation_3d_color_lam = [=](Index_type ii) {
+            NODAL_ACCUMULATION_3D_COLOR_BODY_INDEX;
+            NODAL_ACCUMULATION_3D_BODY;
+          };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < s_num_colors; ++c) {
+          for (Index_type ii = color_offsets[c] ; ii < color_offsets[c+1] ; ++ii ) {
+            nodal_accumulation_3d_color_lam(ii);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      camp::resources::Resource working_res{camp::resources::Host()};
+      std::vector<RAJA::TypedListSegment<Index_type>> color_segments;
+      for (Index_type c = 0; c < s_num_colors; ++c) {
+        color_segments.emplace_back(color_zones + color_offsets[c],
+                                    color_offsets[c+1] - color_offsets[c],
+                                    working_res, RAJA::Unowned);
+      }
+
+      auto nodal_accumulation_3d_lam = [=](Index_type i) {
+                                         NODAL_ACCUMULATION_3D_BODY;
+                                       };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < s_num_colors; ++c) {
+          RAJA::forall<RAJA::loop_exec>(
+            color_segments[c], nodal_accumulation_3d_lam);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void NODAL_ACCUMULATION_3D::runSeqVariantNodeGather(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type nbegin = 0;
+  const Index_type nend = m_domain->n_real_nodes;
+
+  NODAL_ACCUMULATION_3D_GATHER_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type nn = nbegin ; nn < nend ; ++nn ) {
+          NODAL_ACCUMULATION_3D_GATHER_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto nodal_accumulation_3d_gather_lam = [=](Index_type nn) {
+            NODAL_ACCUMULATION_3D_GATHER_BODY;
+          };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type nn = nbegin ; nn < nend ; ++nn ) {
+          nodal_accumulation_3d_gather_lam(nn);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      auto nodal_accumulation_3d_gather_lam = [=](Index_type nn) {
+            NODAL_ACCUMULATION_3D_GATHER_BODY;
+          };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(nbegin, nend), nodal_accumulation_3d_gather_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void NODAL_ACCUMULATION_3D::runSeqVariantLayout(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = m_domain->n_real_zones;
 
-  NODAL_ACCUMULATION_3D_DATA_SETUP;
+  NODAL_ACCUMULATION_3D_LAYOUT_DATA_SETUP;
 
   switch ( vid ) {
 
@@ -71,7 +308,7 @@ void NODAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 
       camp::resources::Resource working_res{camp::resources::Host()};
       RAJA::TypedListSegment<Index_type> zones(real_zones, iend,
-                                               working_res, RAJA::Unowned);
+                                           working_res, RAJA::Unowned);
 
       auto nodal_accumulation_3d_lam = [=](Index_type i) {
                          NODAL_ACCUMULATION_3D_RAJA_ATOMIC_BODY(RAJA::seq_atomic);
@@ -97,5 +334,91 @@ void NODAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 
 }
 
+void NODAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<Index_type, Index_type>(vid, m_real_zones);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<Int_type, Int_type>(vid, m_real_zones_32);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<Index_type, Int_type>(vid, m_real_zones_32);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<Int_type, Index_type>(vid, m_real_zones);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantColor(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantNodeGather(vid);
+
+  }
+
+  t += 1;
+
+  for (int l = 0; l < data_layout::NumLayouts; ++l) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantLayout(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void NODAL_ACCUMULATION_3D::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getIndexTuningName<Int_type, Int_type>(),
+                       getDefaultTuningName());
+  addVariantTuningName(vid, getIndexTuningName<Index_type, Int_type>(),
+                       getDefaultTuningName());
+  addVariantTuningName(vid, getIndexTuningName<Int_type, Index_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, "color8");
+  addVariantTuningName(vid, "node_gather", getDefaultTuningName());
+
+  for (int l = 0; l < data_layout::NumLayouts; ++l) {
+    addVariantTuningName(vid,
+        data_layout::getLayoutName(static_cast<data_layout::Layout>(l)),
+        getDefaultTuningName());
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -13,7 +13,9 @@
 #include "AppsData.hpp"
 #include "common/DataUtils.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 
 namespace rajaperf
@@ -38,11 +40,32 @@ NODAL_ACCUMULATION_3D::NODAL_ACCUMULATION_3D(const RunParams& params)
 
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
-  // touched data size, not actual number of stores and loads
-  setBytesPerRep( (0*sizeof(Index_type) + 1*sizeof(Index_type)) * getItsPerRep() +
+  // touched data size, not actual number of stores and loads, with a
+  // real_zones list of entries of list_size bytes; the default tuning uses
+  // an Index_type list
+  auto list_bytes_per_rep = [&](size_t list_size) {
+    return (0*list_size         + 1*list_size        ) * getItsPerRep() +
+           (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +
+           (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_domain->n_real_nodes;
+  };
+  setBytesPerRep( list_bytes_per_rep(sizeof(Index_type)) );
+  setTuningBytesPerRep( getIndexTuningName<Int_type, Int_type>(),
+                        list_bytes_per_rep(sizeof(Int_type)) );
+  setTuningBytesPerRep( getIndexTuningName<Index_type, Int_type>(),
+                        list_bytes_per_rep(sizeof(Int_type)) );
+  setTuningBytesPerRep( getIndexTuningName<Int_type, Index_type>(),
+                        list_bytes_per_rep(sizeof(Index_type)) );
+  setFLOPsPerRep(9 * getItsPerRep());
+
+  // the node_gather tunings read the node list, the adjacency offsets, and
+  // the 8 adjacent zones of each real zone instead of the real_zones list
+  const Index_type num_node_zones = 8 * m_domain->n_real_zones;
+  setTuningBytesPerRep("node_gather",
+                  (0*sizeof(Index_type) + 2*sizeof(Index_type)) * m_domain->n_real_nodes +
+                  (0*sizeof(Index_type) + 1*sizeof(Index_type)) * num_node_zones +
                   (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +
                   (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_domain->n_real_nodes);
-  setFLOPsPerRep(9 * getItsPerRep());
+  setTuningFLOPsPerRep("node_gather", num_node_zones + 2 * m_domain->n_real_nodes);
 
   checksum_scale_factor = 0.001 *
               ( static_cast<Checksum_type>(getDefaultProblemSize()) /
@@ -74,7 +97,7 @@ NODAL_ACCUMULATION_3D::~NODAL_ACCUMULATION_3D()
   delete m_domain;
 }
 
-void NODAL_ACCUMULATION_3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void NODAL_ACCUMULATION_3D::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_x, m_nodal_array_length, 0.0, vid);
   allocAndInitDataConst(m_vol, m_zonal_array_length, 1.0, vid);
@@ -86,20 +109,173 @@ void NODAL_ACCUMULATION_3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
     setRealZones_3d(m_real_zones, *m_domain);
   }
+
+  if ( usesIndexList32(vid, tune_idx) ) {
+
+    allocData(m_real_zones_32, m_domain->n_real_zones, vid);
+
+    auto reset_rz = scopedMoveData(m_real_zones, m_domain->n_real_zones, vid);
+    auto reset_rz_32 = scopedMoveData(m_real_zones_32, m_domain->n_real_zones, vid);
+
+    for (Index_type ii = 0; ii < m_domain->n_real_zones; ++ii) {
+      m_real_zones_32[ii] = static_cast<Int_type>(m_real_zones[ii]);
+    }
+  }
+
+  if ( usesColoring(vid, tune_idx) ) {
+    setColorZones(vid);
+  }
+
+  if ( usesNodeGather(vid, tune_idx) ) {
+    setNodeZones(vid);
+  }
+
+  if ( usesLayout(vid, tune_idx) ) {
+    m_layout = data_layout::getLayout(getVariantTuningName(vid, tune_idx));
+
+    const Index_type layout_len =
+        data_layout::getDataLength(2, m_nodal_array_length);
+    allocAndInitDataConst(m_layout_data, layout_len, 0.0, vid);
+
+    auto reset_layout = scopedMoveData(m_layout_data, layout_len, vid);
+    auto reset_x = scopedMoveData(m_x, m_nodal_array_length, vid);
+    auto reset_vol = scopedMoveData(m_vol, m_zonal_array_length, vid);
+
+    data_layout::FieldView fields =
+        data_layout::makeView(m_layout_data, m_layout, 2, m_nodal_array_length);
+    data_layout::setField(fields, 0, m_x, m_nodal_array_length);
+    data_layout::setField(fields, 1, m_vol, m_zonal_array_length);
+  }
 }
 
 void NODAL_ACCUMULATION_3D::updateChecksum(VariantID vid, size_t tune_idx)
 {
+  if ( usesLayout(vid, tune_idx) ) {
+    const Index_type layout_len =
+        data_layout::getDataLength(2, m_nodal_array_length);
+
+    auto reset_layout = scopedMoveData(m_layout_data, layout_len, vid);
+    auto reset_x = scopedMoveData(m_x, m_nodal_array_length, vid);
+
+    data_layout::FieldView fields =
+        data_layout::makeView(m_layout_data, m_layout, 2, m_nodal_array_length);
+    data_layout::getField(fields, 0, m_x, m_nodal_array_length);
+  }
+
   checksum[vid].at(tune_idx) += calcChecksum(m_x, m_nodal_array_length, checksum_scale_factor , vid);
 }
 
-void NODAL_ACCUMULATION_3D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void NODAL_ACCUMULATION_3D::tearDown(VariantID vid, size_t tune_idx)
 {
   (void) vid;
 
   deallocData(m_x, vid);
   deallocData(m_vol, vid);
   deallocData(m_real_zones, vid);
+  if ( usesIndexList32(vid, tune_idx) ) {
+    deallocData(m_real_zones_32, vid);
+  }
+  if ( usesColoring(vid, tune_idx) ) {
+    deallocData(m_color_zones, vid);
+    m_color_offsets.clear();
+  }
+  if ( usesNodeGather(vid, tune_idx) ) {
+    deallocData(m_nodes, vid);
+    deallocData(m_node_zone_offsets, vid);
+    deallocData(m_node_zones, vid);
+  }
+  if ( usesLayout(vid, tune_idx) ) {
+    deallocData(m_layout_data, vid);
+  }
+}
+
+//
+// Order the real zones by color, the parity of their i, j, and k indices.
+//
+void NODAL_ACCUMULATION_3D::setColorZones(VariantID vid)
+{
+  const Index_type jp = m_domain->jp;
+  const Index_type kp = m_domain->kp;
+  const Index_type n_real_zones = m_domain->n_real_zones;
+
+  std::vector<Index_type> real_zones(n_real_zones);
+  setRealZones_3d(real_zones.data(), *m_domain);
+
+  std::vector<std::vector<Index_type>> zones_of_color(s_num_colors);
+  for (Index_type zone : real_zones) {
+    const Index_type i = zone % jp;
+    const Index_type j = (zone % kp) / jp;
+    const Index_type k = zone / kp;
+    const Index_type color = (i % 2) + 2*(j % 2) + 4*(k % 2);
+    zones_of_color[color].push_back(zone);
+  }
+
+  allocAndInitDataConst(m_color_zones, n_real_zones,
+                        static_cast<Index_type>(-1), vid);
+  auto reset_cz = scopedMoveData(m_color_zones, n_real_zones, vid);
+
+  m_color_offsets.assign(1, 0);
+  for (Index_type c = 0; c < s_num_colors; ++c) {
+    std::copy(zones_of_color[c].begin(), zones_of_color[c].end(),
+              m_color_zones + m_color_offsets.back());
+    m_color_offsets.push_back(m_color_offsets.back() + zones_of_color[c].size());
+  }
+}
+
+//
+// Find the real zones adjacent to each real node, the zones whose
+// NDPTRSET corners include the node.
+//
+void NODAL_ACCUMULATION_3D::setNodeZones(VariantID vid)
+{
+  const Index_type jp = m_domain->jp;
+  const Index_type kp = m_domain->kp;
+  const Index_type n_real_zones = m_domain->n_real_zones;
+  const Index_type corner_offsets[8] = {0, 1, jp, 1+jp, kp, 1+kp, jp+kp, 1+jp+kp};
+
+  std::vector<Index_type> real_zones(n_real_zones);
+  setRealZones_3d(real_zones.data(), *m_domain);
+
+  std::vector<char> is_real_zone(m_zonal_array_length, 0);
+  std::vector<char> is_real_node(m_nodal_array_length, 0);
+  for (Index_type zone : real_zones) {
+    is_real_zone[zone] = 1;
+    for (Index_type corner : corner_offsets) {
+      is_real_node[zone + corner] = 1;
+    }
+  }
+
+  std::vector<Index_type> nodes;
+  std::vector<Index_type> node_zone_offsets(1, 0);
+  std::vector<Index_type> node_zones;
+  for (Index_type n = 0; n < m_nodal_array_length; ++n) {
+    if (!is_real_node[n]) continue;
+    nodes.push_back(n);
+    for (Index_type corner : corner_offsets) {
+      const Index_type zone = n - corner;
+      if (zone >= 0 && zone < m_zonal_array_length && is_real_zone[zone]) {
+        node_zones.push_back(zone);
+      }
+    }
+    node_zone_offsets.push_back(node_zones.size());
+  }
+
+  const Index_type num_nodes = nodes.size();
+  const Index_type num_node_zones = node_zones.size();
+
+  allocAndInitDataConst(m_nodes, num_nodes, static_cast<Index_type>(-1), vid);
+  allocAndInitDataConst(m_node_zone_offsets, num_nodes+1,
+                        static_cast<Index_type>(-1), vid);
+  allocAndInitDataConst(m_node_zones, num_node_zones,
+                        static_cast<Index_type>(-1), vid);
+
+  auto reset_n = scopedMoveData(m_nodes, num_nodes, vid);
+  auto reset_nzo = scopedMoveData(m_node_zone_offsets, num_nodes+1, vid);
+  auto reset_nz = scopedMoveData(m_node_zones, num_node_zones, vid);
+
+  std::copy(nodes.begin(), nodes.end(), m_nodes);
+  std::copy(node_zone_offsets.begin(), node_zone_offsets.end(), m_node_zone_offsets);
+  std::copy(node_zones.begin(), node_zones.end(), m_node_zones);
 }
 
 } // end namespace apps
@@ -27,17 +27,48 @@
 ///
 /// }
 ///
+/// The default tuning uses Index_type loop indices and an Index_type
+/// real_zones list; the "loop<bits>_list<bits>" tunings of the Seq and
+/// OpenMP variants use other combinations of 32-bit (Int_type) and 64-bit
+/// (Index_type) loop indices and index lists.
+///
+/// Tunings that avoid atomics in the parallel variants:
+///   color8         - zones are split into 8 colors by the parity of their
+///                    i, j, k indices, so zones of one color share no nodes,
+///                    and each color is a separate loop without atomics
+///   node_gather    - each real node sums the volumes of its adjacent real
+///                    zones, using a node-to-zone adjacency built in setUp
+///   thread_private - (Base_OpenMP only) each thread accumulates into its
+///                    own copy of the nodal array, then the copies are
+///                    summed into x
+///
+/// The "soa", "aos", and "aosoa" tunings store x and vol as two fields
+/// indexed by the same mesh index in one of the layouts in DataLayout.hpp;
+/// x is the only nodal field, so vol is stored with it.
+///
 
 #ifndef RAJAPerf_Apps_NODAL_ACCUMULATION_3D_HPP
 #define RAJAPerf_Apps_NODAL_ACCUMULATION_3D_HPP
 
-#define NODAL_ACCUMULATION_3D_DATA_SETUP \
+#define NODAL_ACCUMULATION_3D_COMMON_DATA_SETUP \
   Real_ptr x = m_x; \
   Real_ptr vol = m_vol; \
   \
   Real_ptr x0,x1,x2,x3,x4,x5,x6,x7; \
   \
-  NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ; \
+  NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+
+#define NODAL_ACCUMULATION_3D_DATA_SETUP \
+  NODAL_ACCUMULATION_3D_COMMON_DATA_SETUP \
+  \
+  Index_ptr real_zones = m_real_zones;
+
+#define NODAL_ACCUMULATION_3D_LAYOUT_DATA_SETUP \
+  data_layout::FieldView fields = \
+      data_layout::makeView(m_layout_data, m_layout, 2, m_nodal_array_length); \
+  data_layout::FieldPtr vol{fields, 1, 0}; \
+  \
+  NDFIELDSET(m_domain->jp, m_domain->kp, fields, 0, x0,x1,x2,x3,x4,x5,x6,x7) ; \
   \
   Index_ptr real_zones = m_real_zones;
 
@@ -56,6 +87,31 @@
   x6[i] += val; \
   x7[i] += val;
 
+#define NODAL_ACCUMULATION_3D_COLOR_DATA_SETUP \
+  NODAL_ACCUMULATION_3D_COMMON_DATA_SETUP \
+  \
+  Index_ptr color_zones = m_color_zones; \
+  std::vector<Index_type> color_offsets = m_color_offsets;
+
+#define NODAL_ACCUMULATION_3D_COLOR_BODY_INDEX \
+  Index_type i = color_zones[ii];
+
+#define NODAL_ACCUMULATION_3D_GATHER_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr vol = m_vol; \
+  \
+  Index_ptr nodes = m_nodes; \
+  Index_ptr node_zone_offsets = m_node_zone_offsets; \
+  Index_ptr node_zones = m_node_zones;
+
+#define NODAL_ACCUMULATION_3D_GATHER_BODY \
+  Index_type n = nodes[nn]; \
+  Real_type sum = 0.0; \
+  for (Index_type z = node_zone_offsets[nn]; z < node_zone_offsets[nn+1]; ++z) { \
+    sum += vol[node_zones[z]]; \
+  } \
+  x[n] += 0.125 * sum;
+
 #define NODAL_ACCUMULATION_3D_RAJA_ATOMIC_BODY(policy) \
   Real_type val = 0.125 * vol[i]; \
   \
@@ -71,6 +127,9 @@
 
 
 #include "common/KernelBase.hpp"
+#include "DataLayout.hpp"
+
+#include <vector>
 
 namespace rajaperf
 {
@@ -98,8 +157,21 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename Loop_T, typename List_T >
+  void runSeqVariantImpl(VariantID vid, List_T* real_zones);
+  template < typename Loop_T, typename List_T >
+  void runOpenMPVariantImpl(VariantID vid, List_T* real_zones);
+  void runSeqVariantColor(VariantID vid);
+  void runOpenMPVariantColor(VariantID vid);
+  void runSeqVariantNodeGather(VariantID vid);
+  void runOpenMPVariantNodeGather(VariantID vid);
+  void runOpenMPVariantThreadPrivate(VariantID vid);
+  void runSeqVariantLayout(VariantID vid);
+  void runOpenMPVariantLayout(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -114,8 +186,51 @@ private:
 
   ADomain* m_domain;
   Index_type* m_real_zones;
+  Int_ptr m_real_zones_32; // used by the tunings with Int_type index lists
   Index_type m_nodal_array_length;
   Index_type m_zonal_array_length;
+
+  bool usesIndexList32(VariantID vid, size_t tune_idx) const
+  {
+    return isIndexTuning<Int_type, Int_type>(vid, tune_idx) ||
+           isIndexTuning<Index_type, Int_type>(vid, tune_idx);
+  }
+
+  static const Index_type s_num_colors = 8;
+
+  // real zones ordered by color, color c is
+  // [m_color_offsets[c], m_color_offsets[c+1]) of m_color_zones
+  Index_ptr m_color_zones;
+  std::vector<Index_type> m_color_offsets;
+
+  // real nodes and the real zones adjacent to each of them, the zones of
+  // node m_nodes[nn] are [m_node_zone_offsets[nn], m_node_zone_offsets[nn+1])
+  // of m_node_zones
+  Index_ptr m_nodes;
+  Index_ptr m_node_zone_offsets;
+  Index_ptr m_node_zones;
+
+  bool usesColoring(VariantID vid, size_t tune_idx) const
+  {
+    return getVariantTuningName(vid, tune_idx) == "color8";
+  }
+  bool usesNodeGather(VariantID vid, size_t tune_idx) const
+  {
+    return getVariantTuningName(vid, tune_idx) == "node_gather";
+  }
+
+  bool usesLayout(VariantID vid, size_t tune_idx) const
+  {
+    return data_layout::getLayout(getVariantTuningName(vid, tune_idx)) !=
+           data_layout::NumLayouts;
+  }
+
+  // x and vol stored in a layout of two fields of the nodal array length
+  data_layout::Layout m_layout;
+  Real_ptr m_layout_data;
+
+  void setColorZones(VariantID vid);
+  void setNodeZones(VariantID vid);
 };
 
 } // end namespace apps
@@ -12,6 +12,9 @@
 
 #include "AppsData.hpp"
 
+#include "camp/resource.hpp"
+
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf
@@ -20,7 +23,7 @@ namespace apps
 {
 
 
-void VOL3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void VOL3D::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -93,5 +96,437 @@ void VOL3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 #endif
 }
 
+void VOL3D::runOpenMPVariantRealZones(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_domain->n_real_zones;
+
+  VOL3D_DATA_SETUP;
+  VOL3D_ZONES_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          VOL3D_BODY_INDEX;
+          VOL3D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto vol3d_base_lam = [=](Index_type ii) {
+                              VOL3D_BODY_INDEX;
+                              VOL3D_BODY;
+                            };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          vol3d_base_lam(ii);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      camp::resources::Resource working_res{camp::resources::Host::get_default()};
+      RAJA::TypedListSegment<Index_type> zones(real_zones, iend,
+                                               working_res, RAJA::Unowned);
+
+      auto vol3d_lam = [=](Index_type i) {
+                         VOL3D_BODY;
+                       };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(zones, vol3d_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  VOL3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void VOL3D::runOpenMPVariantLoopNest(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  VOL3D_DATA_SETUP;
+  VOL3D_NEST_DATA_SETUP;
+
+  auto vol3d_nest_lam = [=](Index_type ii, Index_type jj, Index_type kk) {
+                          VOL3D_BODY_NEST_INDEX;
+                          VOL3D_BODY;
+                        };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type kk = kmin ; kk < kmax ; ++kk ) {
+          for (Index_type jj = jmin ; jj < jmax ; ++jj ) {
+            for (Index_type ii = imin ; ii < imax ; ++ii ) {
+              VOL3D_BODY_NEST_INDEX;
+              VOL3D_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type kk = kmin ; kk < kmax ; ++kk ) {
+          for (Index_type jj = jmin ; jj < jmax ; ++jj ) {
+            for (Index_type ii = imin ; ii < imax ; ++ii ) {
+              vol3d_nest_lam(ii, jj, kk);
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                    RAJA::ArgList<2, 1>,
+            RAJA::statement::For<0, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(imin, imax),
+                                                 RAJA::RangeSegment(jmin, jmax),
+                                                 RAJA::RangeSegment(kmin, kmax)),
+                                vol3d_nest_lam );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  VOL3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void VOL3D::runOpenMPVariantTiled(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  VOL3D_DATA_SETUP;
+  VOL3D_NEST_DATA_SETUP;
+
+  const Index_type tile_j = s_tile_j;
+  const Index_type tile_k = s_tile_k;
+
+  auto vol3d_nest_lam = [=](Index_type ii, Index_type jj, Index_type kk) {
+                          VOL3D_BODY_NEST_INDEX;
+                          VOL3D_BODY;
+                        };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type kt = kmin ; kt < kmax ; kt += tile_k ) {
+          for (Index_type jt = jmin ; jt < jmax ; jt += tile_j ) {
+            const Index_type kend = std::min(kt + tile_k, kmax);
+            const Index_type jend = std::min(jt + tile_j, jmax);
+
+            for (Index_type kk = kt ; kk < kend ; ++kk ) {
+              for (Index_type jj = jt ; jj < jend ; ++jj ) {
+                for (Index_type ii = imin ; ii < imax ; ++ii ) {
+                  VOL3D_BODY_NEST_INDEX;
+                  VOL3D_BODY;
+                }
+              }
+            }
+
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type kt = kmin ; kt < kmax ; kt += tile_k ) {
+          for (Index_type jt = jmin ; jt < jmax ; jt += tile_j ) {
+            const Index_type kend = std::min(kt + tile_k, kmax);
+            const Index_type jend = std::min(jt + tile_j, jmax);
+
+            for (Index_type kk = kt ; kk < kend ; ++kk ) {
+              for (Index_type jj = jt ; jj < jend ; ++jj ) {
+                for (Index_type ii = imin ; ii < imax ; ++ii ) {
+                  vol3d_nest_lam(ii, jj, kk);
+                }
+              }
+            }
+
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::Tile<2, RAJA::tile_fixed<s_tile_k>, RAJA::omp_parallel_for_exec,
+            RAJA::statement::Tile<1, RAJA::tile_fixed<s_tile_j>, RAJA::loop_exec,
+              RAJA::statement::For<2, RAJA::loop_exec,
+                RAJA::statement::For<1, RAJA::loop_exec,
+                  RAJA::statement::For<0, RAJA::loop_exec,
+                    RAJA::statement::Lambda<0>
+                  >
+                >
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(imin, imax),
+                                                 RAJA::RangeSegment(jmin, jmax),
+                                                 RAJA::RangeSegment(kmin, kmax)),
+                                vol3d_nest_lam );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  VOL3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void VOL3D::runOpenMPVariantLayout(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = m_domain->fpz;
+  const Index_type iend = m_domain->lpz+1;
+
+  VOL3D_LAYOUT_DATA_SETUP;
+
+  auto vol3d_lam = [=](Index_type i) {
+                     VOL3D_BODY;
+                   };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin ; i < iend ; ++i ) {
+          VOL3D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin ; i < iend ; ++i ) {
+          vol3d_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), vol3d_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  VOL3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void VOL3D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantRealZones(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantLoopNest(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantTiled(vid);
+
+  }
+
+  t += 1;
+
+  for (int l = 0; l < data_layout::NumLayouts; ++l) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantLayout(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void VOL3D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, "real_zones");
+  addVariantTuningName(vid, "loop_nest", "real_zones");
+  addVariantTuningName(vid, "tiled", "real_zones");
+
+  for (int l = 0; l < data_layout::NumLayouts; ++l) {
+    addVariantTuningName(vid,
+        data_layout::getLayoutName(static_cast<data_layout::Layout>(l)),
+        getDefaultTuningName());
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
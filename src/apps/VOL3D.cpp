@@ -42,6 +42,25 @@ VOL3D::VOL3D(const RunParams& params)
                   (0*sizeof(Real_type) + 3*sizeof(Real_type)) * (getItsPerRep() + 1+m_domain->jp+m_domain->kp) );
   setFLOPsPerRep(72 * (m_domain->lpz+1 - m_domain->fpz));
 
+  // the real zone tunings compute fewer zones, the loop nests also do not
+  // read the zone index list
+  for (const char* tuning_name : {"real_zones", "loop_nest", "tiled"}) {
+    setTuningProblemSize(tuning_name, m_domain->n_real_zones);
+    setTuningItsPerRep(tuning_name, m_domain->n_real_zones);
+  }
+  setTuningBytesPerRep("real_zones",
+                  (0*sizeof(Index_type) + 1*sizeof(Index_type)) * m_domain->n_real_zones +
+                  (1*sizeof(Real_type)  + 0*sizeof(Real_type) ) * m_domain->n_real_zones +
+                  (0*sizeof(Real_type)  + 3*sizeof(Real_type) ) * m_domain->n_real_nodes );
+  setTuningFLOPsPerRep("real_zones", 72 * m_domain->n_real_zones);
+  const Index_type nest_bytes =
+                  (1*sizeof(Real_type)  + 0*sizeof(Real_type) ) * m_domain->n_real_zones +
+                  (0*sizeof(Real_type)  + 3*sizeof(Real_type) ) * m_domain->n_real_nodes ;
+  setTuningBytesPerRep("loop_nest", nest_bytes);
+  setTuningFLOPsPerRep("loop_nest", 72 * m_domain->n_real_zones);
+  setTuningBytesPerRep("tiled", nest_bytes);
+  setTuningFLOPsPerRep("tiled", 72 * m_domain->n_real_zones);
+
   checksum_scale_factor = 0.001 *
               ( static_cast<Checksum_type>(getDefaultProblemSize()) /
                                            getActualProblemSize() );
@@ -71,7 +90,7 @@ VOL3D::~VOL3D()
   delete m_domain;
 }
 
-void VOL3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void VOL3D::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_x, m_array_length, 0.0, vid);
   allocAndInitDataConst(m_y, m_array_length, 0.0, vid);
@@ -86,10 +105,34 @@ void VOL3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
     Real_type dy = 0.2;
     Real_type dz = 0.1;
     setMeshPositions_3d(m_x, dx, m_y, dy, m_z, dz, *m_domain);
+
+    if ( usesLayout(vid, tune_idx) ) {
+      m_layout = data_layout::getLayout(getVariantTuningName(vid, tune_idx));
+
+      const Index_type layout_len = data_layout::getDataLength(3, m_array_length);
+      allocAndInitDataConst(m_layout_data, layout_len, 0.0, vid);
+
+      auto reset_layout = scopedMoveData(m_layout_data, layout_len, vid);
+
+      data_layout::FieldView xyz =
+          data_layout::makeView(m_layout_data, m_layout, 3, m_array_length);
+      data_layout::setField(xyz, 0, m_x, m_array_length);
+      data_layout::setField(xyz, 1, m_y, m_array_length);
+      data_layout::setField(xyz, 2, m_z, m_array_length);
+    }
   }
 
   allocAndInitDataConst(m_vol, m_array_length, 0.0, vid);
 
+  if ( usesRealZones(vid, tune_idx) ) {
+    allocAndInitDataConst(m_real_zones, m_domain->n_real_zones,
+                          static_cast<Index_type>(-1), vid);
+
+    auto reset_rz = scopedMoveData(m_real_zones, m_domain->n_real_zones, vid);
+
+    setRealZones_3d(m_real_zones, *m_domain);
+  }
+
   m_vnormq = 0.083333333333333333; /* vnormq = 1/12 */
 }
 
@@ -98,7 +141,7 @@ void VOL3D::updateChecksum(VariantID vid, size_t tune_idx)
   checksum[vid][tune_idx] += calcChecksum(m_vol, m_array_length, checksum_scale_factor , vid);
 }
 
-void VOL3D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void VOL3D::tearDown(VariantID vid, size_t tune_idx)
 {
   (void) vid;
 
@@ -106,6 +149,12 @@ void VOL3D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   deallocData(m_y, vid);
   deallocData(m_z, vid);
   deallocData(m_vol, vid);
+  if ( usesRealZones(vid, tune_idx) ) {
+    deallocData(m_real_zones, vid);
+  }
+  if ( usesLayout(vid, tune_idx) ) {
+    deallocData(m_layout_data, vid);
+  }
 }
 
 } // end namespace apps
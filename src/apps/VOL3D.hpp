@@ -65,6 +65,18 @@
 ///   vol[i] *= vnormq ;
 /// }
 ///
+/// The "real_zones", "loop_nest", and "tiled" tunings compute the volume of
+/// the real zones only, so their checksums are compared with each other and
+/// not with the default tuning that streams through all zones from fpz to lpz.
+/// The "real_zones" tuning gathers the zones through an index list, the
+/// "loop_nest" tuning computes the zone index from a k, j, i loop nest, and
+/// the "tiled" tuning runs the loop nest in tiles of s_tile_k x s_tile_j
+/// rows so the corner nodes shared with the next row and plane of zones are
+/// still in cache when they are loaded again.
+///
+/// The "soa", "aos", and "aosoa" tunings store the x, y, and z coordinates
+/// in one of the layouts in DataLayout.hpp.
+///
 
 #ifndef RAJAPerf_Apps_VOL3D_HPP
 #define RAJAPerf_Apps_VOL3D_HPP
@@ -85,6 +97,37 @@
   NDPTRSET(m_domain->jp, m_domain->kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ; \
   NDPTRSET(m_domain->jp, m_domain->kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
 
+#define VOL3D_LAYOUT_DATA_SETUP \
+  data_layout::FieldView xyz = \
+      data_layout::makeView(m_layout_data, m_layout, 3, m_array_length); \
+  Real_ptr vol = m_vol; \
+\
+  const Real_type vnormq = m_vnormq; \
+\
+  NDFIELDSET(m_domain->jp, m_domain->kp, xyz, 0, x0,x1,x2,x3,x4,x5,x6,x7) ; \
+  NDFIELDSET(m_domain->jp, m_domain->kp, xyz, 1, y0,y1,y2,y3,y4,y5,y6,y7) ; \
+  NDFIELDSET(m_domain->jp, m_domain->kp, xyz, 2, z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+#define VOL3D_ZONES_DATA_SETUP \
+  Index_ptr real_zones = m_real_zones;
+
+#define VOL3D_NEST_DATA_SETUP \
+  const Index_type imin = m_domain->imin; \
+  const Index_type imax = m_domain->imax; \
+  const Index_type jmin = m_domain->jmin; \
+  const Index_type jmax = m_domain->jmax; \
+  const Index_type kmin = m_domain->kmin; \
+  const Index_type kmax = m_domain->kmax; \
+\
+  const Index_type jp = m_domain->jp; \
+  const Index_type kp = m_domain->kp;
+
+#define VOL3D_BODY_INDEX \
+  Index_type i = real_zones[ii];
+
+#define VOL3D_BODY_NEST_INDEX \
+  Index_type i = ii + jj * jp + kk * kp;
+
 #define VOL3D_BODY \
   Real_type x71 = x7[i] - x1[i] ; \
   Real_type x72 = x7[i] - x2[i] ; \
@@ -147,6 +190,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "DataLayout.hpp"
 
 namespace rajaperf
 {
@@ -174,8 +218,20 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantRealZones(VariantID vid);
+  void runSeqVariantLoopNest(VariantID vid);
+  void runSeqVariantTiled(VariantID vid);
+  void runSeqVariantLayout(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantRealZones(VariantID vid);
+  void runOpenMPVariantLoopNest(VariantID vid);
+  void runOpenMPVariantTiled(VariantID vid);
+  void runOpenMPVariantLayout(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -185,6 +241,20 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  // rows of zones in j and planes of zones in k in a tile
+  static const Index_type s_tile_j = 16;
+  static const Index_type s_tile_k = 8;
+
+  bool usesRealZones(VariantID vid, size_t tune_idx) const
+  {
+    return getVariantTuningName(vid, tune_idx) == "real_zones";
+  }
+  bool usesLayout(VariantID vid, size_t tune_idx) const
+  {
+    return data_layout::getLayout(getVariantTuningName(vid, tune_idx)) !=
+           data_layout::NumLayouts;
+  }
+
   Real_ptr m_x;
   Real_ptr m_y;
   Real_ptr m_z;
@@ -193,7 +263,11 @@ private:
   Real_type m_vnormq;
 
   ADomain* m_domain;
+  Index_type* m_real_zones;
   Index_type m_array_length;
+
+  data_layout::Layout m_layout;
+  Real_ptr m_layout_data;
 };
 
 } // end namespace apps
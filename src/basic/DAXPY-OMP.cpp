@@ -18,7 +18,8 @@ namespace basic
 {
 
 
-void DAXPY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void DAXPY::runOpenMPVariantImpl(VariantID vid, Real_T* x, Real_T* y, Real_T a)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -26,8 +27,6 @@ void DAXPY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  DAXPY_DATA_SETUP;
-
   auto daxpy_lam = [=](Index_type i) {
                      DAXPY_BODY;
                    };
@@ -91,5 +90,60 @@ void DAXPY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 #endif
 }
 
+void DAXPY::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    DAXPY_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, x, y, a);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    DAXPY_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, x, y, a);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    DAXPY_ALT_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, x, y, a);
+
+  }
+
+  t += 1;
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+void DAXPY::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+#endif
+
 } // end namespace basic
 } // end namespace rajaperf
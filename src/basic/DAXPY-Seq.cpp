@@ -18,14 +18,13 @@ namespace basic
 {
 
 
-void DAXPY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void DAXPY::runSeqVariantImpl(VariantID vid, Real_T* x, Real_T* y, Real_T a)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  DAXPY_DATA_SETUP;
-
 #if defined(RUN_RAJA_SEQ)
   auto daxpy_lam = [=](Index_type i) {
                      DAXPY_BODY;
@@ -88,5 +87,51 @@ void DAXPY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void DAXPY::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    DAXPY_DATA_SETUP;
+
+    runSeqVariantImpl(vid, x, y, a);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    DAXPY_DATA_SETUP;
+
+    runSeqVariantImpl(vid, x, y, a);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    DAXPY_ALT_DATA_SETUP;
+
+    runSeqVariantImpl(vid, x, y, a);
+
+  }
+
+  t += 1;
+}
+
+void DAXPY::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -29,6 +29,8 @@ DAXPY::DAXPY(const RunParams& params)
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Real_type) + 2*sizeof(Real_type)) * getActualProblemSize() );
+  setTuningBytesPerRep( getPrecisionTuningName<AltReal_type>(),
+                        (1*sizeof(AltReal_type) + 2*sizeof(AltReal_type)) * getActualProblemSize() );
   setFLOPsPerRep(2 * getActualProblemSize());
 
   setUsesFeature(Forall);
@@ -59,23 +61,38 @@ DAXPY::~DAXPY()
 {
 }
 
-void DAXPY::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DAXPY::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitDataConst(m_y, getActualProblemSize(), 0.0, vid);
-  allocAndInitData(m_x, getActualProblemSize(), vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    allocAndInitDataConst(m_alt_y, getActualProblemSize(), AltReal_type(0.0), vid);
+    allocAndInitData(m_alt_x, getActualProblemSize(), vid);
+  } else {
+    allocAndInitDataConst(m_y, getActualProblemSize(), 0.0, vid);
+    allocAndInitData(m_x, getActualProblemSize(), vid);
+  }
   initData(m_a, vid);
 }
 
 void DAXPY::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid].at(tune_idx) += calcChecksum(m_y, getActualProblemSize(), vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    checksum[vid].at(tune_idx) += calcChecksum(m_alt_y, getActualProblemSize(), vid);
+    // y accumulates a*x on every rep
+    setChecksumTolerance<AltReal_type>(vid, tune_idx, getRunReps());
+  } else {
+    checksum[vid].at(tune_idx) += calcChecksum(m_y, getActualProblemSize(), vid);
+  }
 }
 
-void DAXPY::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DAXPY::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
-  deallocData(m_x, vid);
-  deallocData(m_y, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    deallocData(m_alt_x, vid);
+    deallocData(m_alt_y, vid);
+  } else {
+    deallocData(m_x, vid);
+    deallocData(m_y, vid);
+  }
 }
 
 } // end namespace basic
@@ -22,6 +22,11 @@
   Real_ptr y = m_y; \
   Real_type a = m_a;
 
+#define DAXPY_ALT_DATA_SETUP \
+  AltReal_ptr x = m_alt_x; \
+  AltReal_ptr y = m_alt_y; \
+  AltReal_type a = static_cast<AltReal_type>(m_a);
+
 #define DAXPY_BODY  \
   y[i] += a * x[i] ;
 
@@ -54,8 +59,14 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename Real_T >
+  void runSeqVariantImpl(VariantID vid, Real_T* x, Real_T* y, Real_T a);
+  template < typename Real_T >
+  void runOpenMPVariantImpl(VariantID vid, Real_T* x, Real_T* y, Real_T a);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -67,6 +78,8 @@ private:
 
   Real_ptr m_x;
   Real_ptr m_y;
+  AltReal_ptr m_alt_x;
+  AltReal_ptr m_alt_y;
   Real_type m_a;
 };
 
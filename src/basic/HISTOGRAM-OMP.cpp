@@ -0,0 +1,293 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HISTOGRAM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "algorithm/OpenMPSort.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include <omp.h>
+#endif
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+void HISTOGRAM::runOpenMPVariantDefault(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  HISTOGRAM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    // Base_OpenMP runs the omp_histogram algorithms, see runOpenMPVariant
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, num_bins), [=](Index_type b) {
+          HISTOGRAM_INIT_BODY;
+        });
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          HISTOGRAM_RAJA_ATOMIC_BODY(RAJA::omp_atomic);
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HISTOGRAM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HISTOGRAM::runOpenMPVariantAlgorithm(VariantID vid, omp_histogram::Algorithm alg)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  HISTOGRAM_DATA_SETUP;
+
+  if ( vid != Base_OpenMP ) {
+    getCout() << "\n  HISTOGRAM : Unknown variant id = " << vid << std::endl;
+    return;
+  }
+
+  switch ( alg ) {
+
+    case omp_histogram::Atomic : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type b = 0; b < num_bins; ++b ) {
+          HISTOGRAM_INIT_BODY;
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          #pragma omp atomic
+          HISTOGRAM_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case omp_histogram::Privatized : {
+
+      //
+      // Thread 0 counts into counts; every other thread into its own part
+      // of thread_counts.
+      //
+      const int max_threads = omp_get_max_threads();
+      Int_ptr thread_counts;
+      allocData(thread_counts, (max_threads-1)*num_bins, vid);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          const int nthreads = omp_get_num_threads();
+          const int tid = omp_get_thread_num();
+          auto bins_of = [=](int t) {
+            return (t == 0) ? counts : thread_counts + (t-1)*num_bins;
+          };
+          Int_ptr my_counts = bins_of(tid);
+
+          for (Index_type b = 0; b < num_bins; ++b ) {
+            my_counts[b] = 0;
+          }
+
+          #pragma omp for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            my_counts[keys[i]] += 1;
+          }
+
+          // pairwise tree merge of the thread bins into those of thread 0
+          for (int stride = 1; stride < nthreads; stride *= 2) {
+            if (tid % (2*stride) == 0 && tid + stride < nthreads) {
+              Int_ptr other_counts = bins_of(tid + stride);
+              for (Index_type b = 0; b < num_bins; ++b ) {
+                my_counts[b] += other_counts[b];
+              }
+            }
+            #pragma omp barrier
+          }
+        }
+
+      }
+      stopTimer();
+
+      deallocData(thread_counts, vid);
+
+      break;
+    }
+
+    case omp_histogram::Sort : {
+
+      Int_ptr sorted_keys;
+      Int_ptr tmp_keys;
+      allocData(sorted_keys, iend - ibegin, vid);
+      allocData(tmp_keys, iend - ibegin, vid);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          sorted_keys[i - ibegin] = keys[i];
+        }
+
+        algorithm::omp_sort::merge_sort(sorted_keys, tmp_keys, iend - ibegin,
+                                        [](Int_type key) { return key; });
+
+        // the count of each bin is the length of its run of sorted keys
+        #pragma omp parallel for
+        for (Index_type b = 0; b < num_bins; ++b ) {
+          const auto range = std::equal_range(sorted_keys,
+                                              sorted_keys + (iend - ibegin),
+                                              static_cast<Int_type>(b));
+          counts[b] = static_cast<Int_type>(range.second - range.first);
+        }
+
+      }
+      stopTimer();
+
+      deallocData(sorted_keys, vid);
+      deallocData(tmp_keys, vid);
+
+      break;
+    }
+
+    case omp_histogram::Sharded : {
+
+      // bin b is guarded by lock b % num_locks
+      const Index_type num_locks = std::min(num_bins, num_shards);
+      std::vector<omp_lock_t> locks(num_locks);
+      for (Index_type s = 0; s < num_locks; ++s) {
+        omp_init_lock(&locks[s]);
+      }
+      omp_lock_t* lock = locks.data();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type b = 0; b < num_bins; ++b ) {
+          HISTOGRAM_INIT_BODY;
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          omp_lock_t* shard_lock = &lock[keys[i] % num_locks];
+          omp_set_lock(shard_lock);
+          HISTOGRAM_BODY;
+          omp_unset_lock(shard_lock);
+        }
+
+      }
+      stopTimer();
+
+      for (Index_type s = 0; s < num_locks; ++s) {
+        omp_destroy_lock(&locks[s]);
+      }
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HISTOGRAM : Unknown algorithm = " << alg << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(alg);
+#endif
+}
+
+void HISTOGRAM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (vid == Base_OpenMP) {
+
+    for (int ialg = 0; ialg < omp_histogram::NumAlgorithms; ++ialg) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantAlgorithm(vid, static_cast<omp_histogram::Algorithm>(ialg));
+
+      }
+
+      t += 1;
+
+    }
+
+  } else {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantDefault(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void HISTOGRAM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  if (vid == Base_OpenMP) {
+    for (int ialg = 0; ialg < omp_histogram::NumAlgorithms; ++ialg) {
+      addVariantTuningName(vid,
+          omp_histogram::getAlgorithmName(static_cast<omp_histogram::Algorithm>(ialg)));
+    }
+  } else {
+    addVariantTuningName(vid, getDefaultTuningName());
+  }
+}
+
+} // end namespace basic
+} // end namespace rajaperf
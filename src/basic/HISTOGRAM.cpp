@@ -0,0 +1,83 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HISTOGRAM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+HISTOGRAM::HISTOGRAM(const RunParams& params)
+  : KernelBase(rajaperf::Basic_HISTOGRAM, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_num_bins = params.getHistogramBins();
+  m_skew = params.getHistogramSkew();
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(2);
+  setBytesPerRep( (1*sizeof(Int_type) + 1*sizeof(Int_type)) * m_num_bins +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type)) * getActualProblemSize() );
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+HISTOGRAM::~HISTOGRAM()
+{
+}
+
+void HISTOGRAM::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  std::vector<Int_type> keys =
+      getZipfKeys(getActualProblemSize(), m_num_bins, m_skew);
+
+  allocAndInitData(m_keys, getActualProblemSize(), vid);
+  {
+    auto reset_keys = scopedMoveData(m_keys, getActualProblemSize(), vid);
+    for (Index_type i = 0; i < getActualProblemSize(); ++i) {
+      m_keys[i] = keys[i];
+    }
+  }
+
+  allocAndInitData(m_counts, m_num_bins, vid);
+}
+
+void HISTOGRAM::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_counts, m_num_bins, vid);
+}
+
+void HISTOGRAM::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_keys, vid);
+  deallocData(m_counts, vid);
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,135 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// HISTOGRAM kernel reference implementation:
+///
+/// for (Index_type b = 0; b < num_bins; ++b ) {
+///   counts[b] = 0;
+/// }
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   counts[keys[i]] += 1;
+/// }
+///
+/// The number of bins is set with --histogram-bins, and the keys follow a
+/// Zipf distribution whose exponent is set with --histogram-skew, so the
+/// contention on the most frequent bins can be varied.
+///
+/// The Base_OpenMP tunings are
+///   atomic     - an atomic add to the shared bins for every key
+///   privatized - each thread counts into its own bins, then the thread
+///                bins are added pairwise in a tree
+///   sort       - the keys are sorted, then the count of each bin is the
+///                length of its run of keys
+///   sharded    - the bins are split into shards of bins, each with a
+///                lock held while one of its bins is updated
+///
+
+#ifndef RAJAPerf_Basic_HISTOGRAM_HPP
+#define RAJAPerf_Basic_HISTOGRAM_HPP
+
+#define HISTOGRAM_DATA_SETUP \
+  Int_ptr keys = m_keys; \
+  Int_ptr counts = m_counts; \
+  const Index_type num_bins = m_num_bins;
+
+#define HISTOGRAM_INIT_BODY \
+  counts[b] = 0;
+
+#define HISTOGRAM_BODY \
+  counts[keys[i]] += 1;
+
+#define HISTOGRAM_RAJA_ATOMIC_BODY(policy) \
+  RAJA::atomicAdd<policy>(&counts[keys[i]], 1);
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+namespace omp_histogram
+{
+
+enum Algorithm {
+  Atomic = 0,
+  Privatized,
+  Sort,
+  Sharded,
+
+  NumAlgorithms // Keep this one last and NEVER comment out (!!)
+};
+
+// tuning name for the given algorithm
+inline std::string getAlgorithmName(Algorithm alg)
+{
+  switch (alg) {
+    case Atomic:     return "atomic";
+    case Privatized: return "privatized";
+    case Sort:       return "sort";
+    case Sharded:    return "sharded";
+    default:         return "unknown";
+  }
+}
+
+} // end namespace omp_histogram
+
+class HISTOGRAM : public KernelBase
+{
+public:
+
+  HISTOGRAM(const RunParams& params);
+
+  ~HISTOGRAM();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HISTOGRAM : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HISTOGRAM : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HISTOGRAM : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantAlgorithm(VariantID vid, omp_histogram::Algorithm alg);
+
+private:
+  static const size_t default_gpu_block_size = 0;
+
+  // shards of bins, each guarded by one lock, in the sharded tuning
+  static const Index_type num_shards = 64;
+
+  Index_type m_num_bins;
+  Real_type m_skew;
+
+  Int_ptr m_keys;
+  Int_ptr m_counts;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
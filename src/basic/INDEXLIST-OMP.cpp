@@ -17,15 +17,16 @@ namespace rajaperf
 namespace basic
 {
 
-void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Loop_T, typename List_T >
+void INDEXLIST::runOpenMPVariantImpl(VariantID vid, List_T* list)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
   const Index_type run_reps = getRunReps();
-  const Index_type ibegin = 0;
-  const Index_type iend = getActualProblemSize();
+  const Loop_T ibegin = 0;
+  const Loop_T iend = getActualProblemSize();
 
-  INDEXLIST_DATA_SETUP;
+  INDEXLIST_COMMON_DATA_SETUP;
 
   switch ( vid ) {
 
@@ -33,21 +34,21 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 #if _OPENMP >= 201811 && defined(RAJA_PERFSUITE_ENABLE_OPENMP5_SCAN)
 #else
-      const Index_type n = iend - ibegin;
-      ::std::vector<Index_type> tmp_scan(n);
-      const int p0 = static_cast<int>(std::min(n, static_cast<Index_type>(omp_get_max_threads())));
-      ::std::vector<Index_type> thread_sums(p0);
+      const Loop_T n = iend - ibegin;
+      ::std::vector<Loop_T> tmp_scan(n);
+      const int p0 = static_cast<int>(std::min(n, static_cast<Loop_T>(omp_get_max_threads())));
+      ::std::vector<Loop_T> thread_sums(p0);
 #endif
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Index_type count = 0;
+        Loop_T count = 0;
 
 #if _OPENMP >= 201811 && defined(RAJA_PERFSUITE_ENABLE_OPENMP5_SCAN)
         #pragma omp parallel for reduction(inscan, +:count)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          Index_type inc = 0;
+        for (Loop_T i = ibegin; i < iend; ++i ) {
+          Loop_T inc = 0;
           if (INDEXLIST_CONDITIONAL) {
             list[count] = i ;
             inc = 1;
@@ -60,14 +61,14 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
         {
           const int p = omp_get_num_threads();
           const int pid = omp_get_thread_num();
-          const Index_type step = n / p;
-          const Index_type local_begin = pid * step + ibegin;
-          const Index_type local_end = (pid == p-1) ? iend : (pid+1) * step + ibegin;
+          const Loop_T step = n / p;
+          const Loop_T local_begin = pid * step + ibegin;
+          const Loop_T local_end = (pid == p-1) ? iend : (pid+1) * step + ibegin;
 
-          Index_type local_sum_var = 0;
-          for (Index_type i = local_begin; i < local_end; ++i ) {
+          Loop_T local_sum_var = 0;
+          for (Loop_T i = local_begin; i < local_end; ++i ) {
 
-            Index_type inc = 0;
+            Loop_T inc = 0;
             if (INDEXLIST_CONDITIONAL) {
               inc = 1;
             }
@@ -78,13 +79,13 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
           #pragma omp barrier
 
-          Index_type local_count_var = 0;
+          Loop_T local_count_var = 0;
           for (int ip = 0; ip < pid; ++ip) {
             local_count_var += thread_sums[ip];
           }
 
-          for (Index_type i = local_begin; i < local_end; ++i ) {
-            Index_type inc = tmp_scan[i];
+          for (Loop_T i = local_begin; i < local_end; ++i ) {
+            Loop_T inc = tmp_scan[i];
             if (inc) {
               list[local_count_var] = i ;
             }
@@ -108,8 +109,8 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
     case Lambda_OpenMP : {
 
 #if _OPENMP >= 201811 && defined(RAJA_PERFSUITE_ENABLE_OPENMP5_SCAN)
-      auto indexlist_lam = [=](Index_type i, Index_type count) {
-                                  Index_type inc = 0;
+      auto indexlist_lam = [=](Loop_T i, Loop_T count) {
+                                  Loop_T inc = 0;
                                   if (INDEXLIST_CONDITIONAL) {
                                     list[count] = i ;
                                     inc = 1;
@@ -117,30 +118,30 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
                                   return inc;
                                 };
 #else
-      auto indexlist_lam_input = [=](Index_type i) {
-                                  Index_type inc = 0;
+      auto indexlist_lam_input = [=](Loop_T i) {
+                                  Loop_T inc = 0;
                                   if (INDEXLIST_CONDITIONAL) {
                                     inc = 1;
                                   }
                                   return inc;
                                 };
-      auto indexlist_lam_output = [=](Index_type i, Index_type count) {
+      auto indexlist_lam_output = [=](Loop_T i, Loop_T count) {
                                   list[count] = i ;
                                 };
-      const Index_type n = iend - ibegin;
-      ::std::vector<Index_type> tmp_scan(n);
-      const int p0 = static_cast<int>(std::min(n, static_cast<Index_type>(omp_get_max_threads())));
-      ::std::vector<Index_type> thread_sums(p0);
+      const Loop_T n = iend - ibegin;
+      ::std::vector<Loop_T> tmp_scan(n);
+      const int p0 = static_cast<int>(std::min(n, static_cast<Loop_T>(omp_get_max_threads())));
+      ::std::vector<Loop_T> thread_sums(p0);
 #endif
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Index_type count = 0;
+        Loop_T count = 0;
 
 #if _OPENMP >= 201811 && defined(RAJA_PERFSUITE_ENABLE_OPENMP5_SCAN)
         #pragma omp parallel for reduction(inscan, +:count)
-        for (Index_type i = ibegin; i < iend; ++i ) {
+        for (Loop_T i = ibegin; i < iend; ++i ) {
           #pragma omp scan exclusive(count)
           count += indexlist_lam(i, count);
         }
@@ -149,14 +150,14 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
         {
           const int p = omp_get_num_threads();
           const int pid = omp_get_thread_num();
-          const Index_type step = n / p;
-          const Index_type local_begin = pid * step + ibegin;
-          const Index_type local_end = (pid == p-1) ? iend : (pid+1) * step + ibegin;
+          const Loop_T step = n / p;
+          const Loop_T local_begin = pid * step + ibegin;
+          const Loop_T local_end = (pid == p-1) ? iend : (pid+1) * step + ibegin;
 
-          Index_type local_sum_var = 0;
-          for (Index_type i = local_begin; i < local_end; ++i ) {
+          Loop_T local_sum_var = 0;
+          for (Loop_T i = local_begin; i < local_end; ++i ) {
 
-            Index_type inc = indexlist_lam_input(i);
+            Loop_T inc = indexlist_lam_input(i);
             tmp_scan[i] = inc;
             local_sum_var += inc;
           }
@@ -164,13 +165,13 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
           #pragma omp barrier
 
-          Index_type local_count_var = 0;
+          Loop_T local_count_var = 0;
           for (int ip = 0; ip < pid; ++ip) {
             local_count_var += thread_sums[ip];
           }
 
-          for (Index_type i = local_begin; i < local_end; ++i ) {
-            Index_type inc = tmp_scan[i];
+          for (Loop_T i = local_begin; i < local_end; ++i ) {
+            Loop_T inc = tmp_scan[i];
             if (inc) {
               indexlist_lam_output(i, local_count_var);
             }
@@ -200,8 +201,124 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 #else
   RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(list);
+#endif
+}
+
+void INDEXLIST::runOpenMPVariantCompact(VariantID vid, omp_compress::Algorithm alg)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INDEXLIST_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      Int_ptr scratch;
+      allocData(scratch, iend - ibegin, vid);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        m_len = omp_compress::compact(alg, x, list, scratch, ibegin, iend);
+
+      }
+      stopTimer();
+
+      deallocData(scratch, vid);
+
+      break;
+    }
+
+    default : {
+      ignore_unused(run_reps, ibegin, iend, x, list);
+      getCout() << "\n  INDEXLIST : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(alg);
 #endif
 }
 
+void INDEXLIST::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<Index_type, Int_type>(vid, m_list);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<Int_type, Int_type>(vid, m_list);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<Index_type, Index_type>(vid, m_list_64);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantImpl<Int_type, Index_type>(vid, m_list_64);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    for (int ialg = 0; ialg < omp_compress::NumAlgorithms; ++ialg) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantCompact(vid, static_cast<omp_compress::Algorithm>(ialg));
+
+      }
+
+      t += 1;
+
+    }
+
+  }
+}
+
+void INDEXLIST::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getIndexTuningName<Int_type, Int_type>(),
+                       getDefaultTuningName());
+  addVariantTuningName(vid, getIndexTuningName<Index_type, Index_type>(),
+                       getDefaultTuningName());
+  addVariantTuningName(vid, getIndexTuningName<Int_type, Index_type>(),
+                       getDefaultTuningName());
+
+  if (vid == Base_OpenMP) {
+    for (int ialg = 0; ialg < omp_compress::NumAlgorithms; ++ialg) {
+      addVariantTuningName(vid,
+          omp_compress::getAlgorithmName(static_cast<omp_compress::Algorithm>(ialg)));
+    }
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
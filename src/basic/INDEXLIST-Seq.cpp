@@ -18,13 +18,14 @@ namespace basic
 {
 
 
-void INDEXLIST::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Loop_T, typename List_T >
+void INDEXLIST::runSeqVariantImpl(VariantID vid, List_T* list)
 {
   const Index_type run_reps = getRunReps();
-  const Index_type ibegin = 0;
-  const Index_type iend = getActualProblemSize();
+  const Loop_T ibegin = 0;
+  const Loop_T iend = getActualProblemSize();
 
-  INDEXLIST_DATA_SETUP;
+  INDEXLIST_COMMON_DATA_SETUP;
 
   switch ( vid ) {
 
@@ -33,9 +34,9 @@ void INDEXLIST::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Index_type count = 0;
+        Loop_T count = 0;
 
-        for (Index_type i = ibegin; i < iend; ++i ) {
+        for (Loop_T i = ibegin; i < iend; ++i ) {
           INDEXLIST_BODY;
         }
 
@@ -50,16 +51,16 @@ void INDEXLIST::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 #if defined(RUN_RAJA_SEQ)
     case Lambda_Seq : {
 
-      auto indexlist_base_lam = [=](Index_type i, Index_type& count) {
+      auto indexlist_base_lam = [=](Loop_T i, Loop_T& count) {
                                  INDEXLIST_BODY
                                };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Index_type count = 0;
+        Loop_T count = 0;
 
-        for (Index_type i = ibegin; i < iend; ++i ) {
+        for (Loop_T i = ibegin; i < iend; ++i ) {
           indexlist_base_lam(i, count);
         }
 
@@ -80,5 +81,54 @@ void INDEXLIST::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 }
 
+void INDEXLIST::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<Index_type, Int_type>(vid, m_list);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<Int_type, Int_type>(vid, m_list);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<Index_type, Index_type>(vid, m_list_64);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantImpl<Int_type, Index_type>(vid, m_list_64);
+
+  }
+
+  t += 1;
+}
+
+void INDEXLIST::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getIndexTuningName<Int_type, Int_type>(),
+                       getDefaultTuningName());
+  addVariantTuningName(vid, getIndexTuningName<Index_type, Index_type>(),
+                       getDefaultTuningName());
+  addVariantTuningName(vid, getIndexTuningName<Int_type, Index_type>(),
+                       getDefaultTuningName());
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -28,9 +28,23 @@ INDEXLIST::INDEXLIST(const RunParams& params)
 
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
-  setBytesPerRep( (1*sizeof(Index_type) + 1*sizeof(Index_type)) +
-                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * getActualProblemSize() / 2 + // about 50% output
-                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() );
+  // expected list length given the fraction of negative x values
+  const Index_type list_len =
+      static_cast<Index_type>(getActualProblemSize() * params.getSelectivity());
+  // bytes with a list of entries of list_size bytes, the default tuning
+  // uses an Int_type list
+  auto list_bytes_per_rep = [&](size_t list_size) {
+    return (1*sizeof(Index_type) + 1*sizeof(Index_type)) +
+           (1*list_size         + 0*list_size        ) * list_len +
+           (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize();
+  };
+  setBytesPerRep( list_bytes_per_rep(sizeof(Int_type)) );
+  setTuningBytesPerRep( getIndexTuningName<Int_type, Int_type>(),
+                        list_bytes_per_rep(sizeof(Int_type)) );
+  setTuningBytesPerRep( getIndexTuningName<Index_type, Index_type>(),
+                        list_bytes_per_rep(sizeof(Index_type)) );
+  setTuningBytesPerRep( getIndexTuningName<Int_type, Index_type>(),
+                        list_bytes_per_rep(sizeof(Index_type)) );
   setFLOPsPerRep(0);
 
   setUsesFeature(Forall);
@@ -55,24 +69,36 @@ INDEXLIST::~INDEXLIST()
 {
 }
 
-void INDEXLIST::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void INDEXLIST::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitDataRandSign(m_x, getActualProblemSize(), vid);
-  allocAndInitData(m_list, getActualProblemSize(), vid);
+  allocAndInitDataSelectivity(m_x, getActualProblemSize(), vid);
+  if ( usesIndexList64(vid, tune_idx) ) {
+    allocAndInitData(m_list_64, getActualProblemSize(), vid);
+  } else {
+    allocAndInitData(m_list, getActualProblemSize(), vid);
+  }
   m_len = -1;
 }
 
 void INDEXLIST::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_list, getActualProblemSize(), vid);
+  if ( usesIndexList64(vid, tune_idx) ) {
+    checksum[vid][tune_idx] += calcChecksum(m_list_64, getActualProblemSize(), vid);
+  } else {
+    checksum[vid][tune_idx] += calcChecksum(m_list, getActualProblemSize(), vid);
+  }
   checksum[vid][tune_idx] += Checksum_type(m_len);
 }
 
-void INDEXLIST::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void INDEXLIST::tearDown(VariantID vid, size_t tune_idx)
 {
   (void) vid;
   deallocData(m_x, vid);
-  deallocData(m_list, vid);
+  if ( usesIndexList64(vid, tune_idx) ) {
+    deallocData(m_list_64, vid);
+  } else {
+    deallocData(m_list, vid);
+  }
 }
 
 } // end namespace basic
@@ -17,12 +17,23 @@
 /// }
 /// Index_type len = count;
 ///
+/// The default tuning uses Index_type loop indices and an Int_type list;
+/// the "loop<bits>_list<bits>" tunings of the Seq and OpenMP variants use
+/// other combinations of 32-bit (Int_type) and 64-bit (Index_type) loop
+/// indices and lists. The Base_OpenMP "compress" and "buffer" tunings use
+/// the algorithms in OpenMPCompress.hpp.
+///
+/// The fraction of x values that are negative is set with --selectivity.
+///
 
 #ifndef RAJAPerf_Basic_INDEXLIST_HPP
 #define RAJAPerf_Basic_INDEXLIST_HPP
 
+#define INDEXLIST_COMMON_DATA_SETUP \
+  Real_ptr x = m_x;
+
 #define INDEXLIST_DATA_SETUP \
-  Real_ptr x = m_x; \
+  INDEXLIST_COMMON_DATA_SETUP \
   Int_ptr list = m_list;
 
 #define INDEXLIST_CONDITIONAL  \
@@ -35,6 +46,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "OpenMPCompress.hpp"
 
 namespace rajaperf
 {
@@ -61,8 +73,15 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename Loop_T, typename List_T >
+  void runSeqVariantImpl(VariantID vid, List_T* list);
+  template < typename Loop_T, typename List_T >
+  void runOpenMPVariantImpl(VariantID vid, List_T* list);
+  void runOpenMPVariantCompact(VariantID vid, omp_compress::Algorithm alg);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -74,7 +93,14 @@ private:
 
   Real_ptr m_x;
   Int_ptr m_list;
+  Index_ptr m_list_64; // used by the tunings with an Index_type list
   Index_type m_len;
+
+  bool usesIndexList64(VariantID vid, size_t tune_idx) const
+  {
+    return isIndexTuning<Index_type, Index_type>(vid, tune_idx) ||
+           isIndexTuning<Int_type, Index_type>(vid, tune_idx);
+  }
 };
 
 } // end namespace basic
@@ -24,7 +24,7 @@ namespace basic
   delete[] counts; counts = nullptr;
 
 
-void INDEXLIST_3LOOP::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void INDEXLIST_3LOOP::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -244,5 +244,88 @@ void INDEXLIST_3LOOP::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG
 #endif
 }
 
+void INDEXLIST_3LOOP::runOpenMPVariantCompact(VariantID vid, omp_compress::Algorithm alg)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INDEXLIST_3LOOP_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      Int_ptr scratch;
+      allocData(scratch, iend - ibegin, vid);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        m_len = omp_compress::compact(alg, x, list, scratch, ibegin, iend);
+
+      }
+      stopTimer();
+
+      deallocData(scratch, vid);
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  INDEXLIST_3LOOP : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(alg);
+#endif
+}
+
+void INDEXLIST_3LOOP::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    for (int ialg = 0; ialg < omp_compress::NumAlgorithms; ++ialg) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantCompact(vid, static_cast<omp_compress::Algorithm>(ialg));
+
+      }
+
+      t += 1;
+
+    }
+
+  }
+}
+
+void INDEXLIST_3LOOP::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if (vid == Base_OpenMP) {
+    for (int ialg = 0; ialg < omp_compress::NumAlgorithms; ++ialg) {
+      addVariantTuningName(vid,
+          omp_compress::getAlgorithmName(static_cast<omp_compress::Algorithm>(ialg)));
+    }
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
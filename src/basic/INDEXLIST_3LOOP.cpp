@@ -28,6 +28,9 @@ INDEXLIST_3LOOP::INDEXLIST_3LOOP(const RunParams& params)
 
   setItsPerRep( 3 * getActualProblemSize() + 1 );
   setKernelsPerRep(3);
+  // expected list length given the fraction of negative x values
+  const Index_type list_len =
+      static_cast<Index_type>(getActualProblemSize() * params.getSelectivity());
   setBytesPerRep( (1*sizeof(Int_type) + 0*sizeof(Int_type)) * getActualProblemSize() +
                   (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() +
 
@@ -35,7 +38,7 @@ INDEXLIST_3LOOP::INDEXLIST_3LOOP(const RunParams& params)
                   (1*sizeof(Int_type) + 1*sizeof(Int_type)) * (getActualProblemSize()+1) +
 
                   (0*sizeof(Int_type) + 1*sizeof(Int_type)) * (getActualProblemSize()+1) +
-                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * getActualProblemSize() / 2 ); // about 50% output
+                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * list_len );
   setFLOPsPerRep(0);
 
   setUsesFeature(Forall);
@@ -66,7 +69,7 @@ INDEXLIST_3LOOP::~INDEXLIST_3LOOP()
 
 void INDEXLIST_3LOOP::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  allocAndInitDataRandSign(m_x, getActualProblemSize(), vid);
+  allocAndInitDataSelectivity(m_x, getActualProblemSize(), vid);
   allocAndInitData(m_list, getActualProblemSize(), vid);
   m_len = -1;
 }
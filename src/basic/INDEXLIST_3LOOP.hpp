@@ -28,6 +28,11 @@
 ///
 /// Index_type len = counts[iend];
 ///
+/// The Base_OpenMP "compress" and "buffer" tunings replace the three loops
+/// with the algorithms in OpenMPCompress.hpp.
+///
+/// The fraction of x values that are negative is set with --selectivity.
+///
 
 #ifndef RAJAPerf_Basic_INDEXLIST_3LOOP_HPP
 #define RAJAPerf_Basic_INDEXLIST_3LOOP_HPP
@@ -46,6 +51,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "OpenMPCompress.hpp"
 
 namespace rajaperf
 {
@@ -72,8 +78,11 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantCompact(VariantID vid, omp_compress::Algorithm alg);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
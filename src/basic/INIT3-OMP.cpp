@@ -18,7 +18,9 @@ namespace basic
 {
 
 
-void INIT3::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void INIT3::runOpenMPVariantImpl(VariantID vid, Real_T* out1, Real_T* out2,
+                                 Real_T* out3, Real_T* in1, Real_T* in2)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -26,8 +28,6 @@ void INIT3::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  INIT3_DATA_SETUP;
-
   auto init3_lam = [=](Index_type i) {
                      INIT3_BODY;
                    };
@@ -91,5 +91,60 @@ void INIT3::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 #endif
 }
 
+void INIT3::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    INIT3_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, out1, out2, out3, in1, in2);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    INIT3_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, out1, out2, out3, in1, in2);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    INIT3_ALT_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, out1, out2, out3, in1, in2);
+
+  }
+
+  t += 1;
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+void INIT3::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+#endif
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -18,14 +18,14 @@ namespace basic
 {
 
 
-void INIT3::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void INIT3::runSeqVariantImpl(VariantID vid, Real_T* out1, Real_T* out2,
+                              Real_T* out3, Real_T* in1, Real_T* in2)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  INIT3_DATA_SETUP;
-
 #if defined(RUN_RAJA_SEQ)
   auto init3_lam = [=](Index_type i) {
                      INIT3_BODY;
@@ -88,5 +88,51 @@ void INIT3::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void INIT3::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    INIT3_DATA_SETUP;
+
+    runSeqVariantImpl(vid, out1, out2, out3, in1, in2);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    INIT3_DATA_SETUP;
+
+    runSeqVariantImpl(vid, out1, out2, out3, in1, in2);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    INIT3_ALT_DATA_SETUP;
+
+    runSeqVariantImpl(vid, out1, out2, out3, in1, in2);
+
+  }
+
+  t += 1;
+}
+
+void INIT3::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -25,6 +25,13 @@
   Real_ptr in1 = m_in1; \
   Real_ptr in2 = m_in2;
 
+#define INIT3_ALT_DATA_SETUP \
+  AltReal_ptr out1 = m_alt_out1; \
+  AltReal_ptr out2 = m_alt_out2; \
+  AltReal_ptr out3 = m_alt_out3; \
+  AltReal_ptr in1 = m_alt_in1; \
+  AltReal_ptr in2 = m_alt_in2;
+
 #define INIT3_BODY  \
   out1[i] = out2[i] = out3[i] = - in1[i] - in2[i] ;
 
@@ -57,8 +64,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename Real_T >
+  void runSeqVariantImpl(VariantID vid, Real_T* out1, Real_T* out2,
+                         Real_T* out3, Real_T* in1, Real_T* in2);
+  template < typename Real_T >
+  void runOpenMPVariantImpl(VariantID vid, Real_T* out1, Real_T* out2,
+                            Real_T* out3, Real_T* in1, Real_T* in2);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -73,6 +88,11 @@ private:
   Real_ptr m_out3;
   Real_ptr m_in1;
   Real_ptr m_in2;
+  AltReal_ptr m_alt_out1;
+  AltReal_ptr m_alt_out2;
+  AltReal_ptr m_alt_out3;
+  AltReal_ptr m_alt_in1;
+  AltReal_ptr m_alt_in2;
 };
 
 } // end namespace basic
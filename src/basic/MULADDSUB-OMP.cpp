@@ -18,7 +18,9 @@ namespace basic
 {
 
 
-void MULADDSUB::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void MULADDSUB::runOpenMPVariantImpl(VariantID vid, Real_T* out1, Real_T* out2,
+                                     Real_T* out3, Real_T* in1, Real_T* in2)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -26,8 +28,6 @@ void MULADDSUB::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  MULADDSUB_DATA_SETUP;
-
   auto mas_lam = [=](Index_type i) {
                    MULADDSUB_BODY;
                  };
@@ -91,5 +91,60 @@ void MULADDSUB::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+void MULADDSUB::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    MULADDSUB_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, out1, out2, out3, in1, in2);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    MULADDSUB_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, out1, out2, out3, in1, in2);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    MULADDSUB_ALT_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, out1, out2, out3, in1, in2);
+
+  }
+
+  t += 1;
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+void MULADDSUB::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+#endif
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -29,6 +29,8 @@ MULADDSUB::MULADDSUB(const RunParams& params)
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (3*sizeof(Real_type) + 2*sizeof(Real_type)) * getActualProblemSize() );
+  setTuningBytesPerRep( getPrecisionTuningName<AltReal_type>(),
+                        (3*sizeof(AltReal_type) + 2*sizeof(AltReal_type)) * getActualProblemSize() );
   setFLOPsPerRep(3 * getActualProblemSize());
 
   setUsesFeature(Forall);
@@ -59,30 +61,52 @@ MULADDSUB::~MULADDSUB()
 {
 }
 
-void MULADDSUB::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void MULADDSUB::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitDataConst(m_out1, getActualProblemSize(), 0.0, vid);
-  allocAndInitDataConst(m_out2, getActualProblemSize(), 0.0, vid);
-  allocAndInitDataConst(m_out3, getActualProblemSize(), 0.0, vid);
-  allocAndInitData(m_in1, getActualProblemSize(), vid);
-  allocAndInitData(m_in2, getActualProblemSize(), vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    allocAndInitDataConst(m_alt_out1, getActualProblemSize(), AltReal_type(0.0), vid);
+    allocAndInitDataConst(m_alt_out2, getActualProblemSize(), AltReal_type(0.0), vid);
+    allocAndInitDataConst(m_alt_out3, getActualProblemSize(), AltReal_type(0.0), vid);
+    allocAndInitData(m_alt_in1, getActualProblemSize(), vid);
+    allocAndInitData(m_alt_in2, getActualProblemSize(), vid);
+  } else {
+    allocAndInitDataConst(m_out1, getActualProblemSize(), 0.0, vid);
+    allocAndInitDataConst(m_out2, getActualProblemSize(), 0.0, vid);
+    allocAndInitDataConst(m_out3, getActualProblemSize(), 0.0, vid);
+    allocAndInitData(m_in1, getActualProblemSize(), vid);
+    allocAndInitData(m_in2, getActualProblemSize(), vid);
+  }
 }
 
 void MULADDSUB::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_out1, getActualProblemSize(), vid);
-  checksum[vid][tune_idx] += calcChecksum(m_out2, getActualProblemSize(), vid);
-  checksum[vid][tune_idx] += calcChecksum(m_out3, getActualProblemSize(), vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    checksum[vid][tune_idx] += calcChecksum(m_alt_out1, getActualProblemSize(), vid);
+    checksum[vid][tune_idx] += calcChecksum(m_alt_out2, getActualProblemSize(), vid);
+    checksum[vid][tune_idx] += calcChecksum(m_alt_out3, getActualProblemSize(), vid);
+    setChecksumTolerance<AltReal_type>(vid, tune_idx);
+  } else {
+    checksum[vid][tune_idx] += calcChecksum(m_out1, getActualProblemSize(), vid);
+    checksum[vid][tune_idx] += calcChecksum(m_out2, getActualProblemSize(), vid);
+    checksum[vid][tune_idx] += calcChecksum(m_out3, getActualProblemSize(), vid);
+  }
 }
 
-void MULADDSUB::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void MULADDSUB::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
-  deallocData(m_out1, vid);
-  deallocData(m_out2, vid);
-  deallocData(m_out3, vid);
-  deallocData(m_in1, vid);
-  deallocData(m_in2, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    deallocData(m_alt_out1, vid);
+    deallocData(m_alt_out2, vid);
+    deallocData(m_alt_out3, vid);
+    deallocData(m_alt_in1, vid);
+    deallocData(m_alt_in2, vid);
+  } else {
+    deallocData(m_out1, vid);
+    deallocData(m_out2, vid);
+    deallocData(m_out3, vid);
+    deallocData(m_in1, vid);
+    deallocData(m_in2, vid);
+  }
 }
 
 } // end namespace basic
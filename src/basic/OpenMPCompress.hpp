@@ -0,0 +1,290 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Hand-written OpenMP stream compaction algorithms used by the Base_OpenMP
+/// tunings of the INDEXLIST and INDEXLIST_3LOOP kernels.
+///
+/// Each algorithm writes the indices i in [ibegin, iend) with x[i] < 0.0 to
+/// list in increasing order and returns their number.
+///
+///   compress - each thread counts the matches in its block, the counts are
+///              scanned, then each thread compresses its block into its part
+///              of list simd_width indices at a time; with AVX-512 compress
+///              stores, with AVX2 a lookup table permutation, else a loop
+///   buffer   - single pass over x; each thread appends its matches to its
+///              part of a scratch buffer, then copies them to list once the
+///              thread counts are scanned
+///
+/// Use the --selectivity option to vary the fraction of matches.
+///
+
+#ifndef RAJAPerf_Basic_OpenMPCompress_HPP
+#define RAJAPerf_Basic_OpenMPCompress_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace rajaperf
+{
+namespace basic
+{
+namespace omp_compress
+{
+
+enum Algorithm {
+  Compress = 0,
+  Buffer,
+
+  NumAlgorithms // Keep this one last and NEVER comment out (!!)
+};
+
+// tuning name for the given algorithm
+inline std::string getAlgorithmName(Algorithm alg)
+{
+  switch (alg) {
+    case Compress: return "compress";
+    case Buffer:   return "buffer";
+    default:       return "unknown";
+  }
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+// indices compressed at once by the compress algorithm
+#if defined(__AVX512F__)
+constexpr Index_type simd_width = 16;
+#else
+constexpr Index_type simd_width = 8;
+#endif
+
+inline int popcount(unsigned mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_popcount(mask);
+#else
+  return static_cast<int>(std::bitset<32>(mask).count());
+#endif
+}
+
+#if defined(__AVX2__) && !defined(__AVX512F__)
+//
+// Lane permutation for each 8-bit match mask that moves the lanes whose
+// bits are set to the front, in order.
+//
+struct CompressTable
+{
+  alignas(32) std::int32_t perm[256][8];
+
+  CompressTable()
+  {
+    for (int mask = 0; mask < 256; ++mask) {
+      int k = 0;
+      for (int lane = 0; lane < 8; ++lane) {
+        if (mask & (1 << lane)) {
+          perm[mask][k++] = lane;
+        }
+      }
+      for ( ; k < 8; ++k) {
+        perm[mask][k] = 0;
+      }
+    }
+  }
+};
+
+inline const CompressTable& compress_table()
+{
+  static const CompressTable table;
+  return table;
+}
+#endif
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+//
+// Bit mask of x[0], ..., x[simd_width-1] less than zero, with overloads
+// for each floating point type Real_type may be.
+//
+#if defined(__AVX512F__)
+inline unsigned match_mask(const double* x)
+{
+  const __m512d zero = _mm512_setzero_pd();
+  const __mmask8 lo = _mm512_cmp_pd_mask(_mm512_loadu_pd(x), zero, _CMP_LT_OQ);
+  const __mmask8 hi = _mm512_cmp_pd_mask(_mm512_loadu_pd(x + 8), zero, _CMP_LT_OQ);
+  return static_cast<unsigned>(lo) | (static_cast<unsigned>(hi) << 8);
+}
+
+inline unsigned match_mask(const float* x)
+{
+  return _mm512_cmp_ps_mask(_mm512_loadu_ps(x), _mm512_setzero_ps(), _CMP_LT_OQ);
+}
+#else
+inline unsigned match_mask(const double* x)
+{
+  const __m256d zero = _mm256_setzero_pd();
+  const int lo = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(x), zero, _CMP_LT_OQ));
+  const int hi = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(x + 4), zero, _CMP_LT_OQ));
+  return static_cast<unsigned>(lo | (hi << 4));
+}
+
+inline unsigned match_mask(const float* x)
+{
+  return static_cast<unsigned>(_mm256_movemask_ps(
+      _mm256_cmp_ps(_mm256_loadu_ps(x), _mm256_setzero_ps(), _CMP_LT_OQ)));
+}
+#endif
+#endif
+
+//
+// Compress the matches in [ibegin, iend) into out, which has exactly room
+// for them up to out_end; vector stores that may write past the last match
+// are only used while a full vector fits before out_end.
+//
+inline void compress_block(const Real_type* x, Int_type* out, Int_type* out_end,
+                           Index_type ibegin, Index_type iend)
+{
+  Index_type i = ibegin;
+
+#if defined(__AVX512F__)
+  const __m512i lanes = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7,
+                                          8, 9, 10, 11, 12, 13, 14, 15);
+  for ( ; i + simd_width <= iend; i += simd_width) {
+    const __mmask16 mask = static_cast<__mmask16>(match_mask(x + i));
+    const __m512i idx = _mm512_add_epi32(_mm512_set1_epi32(static_cast<int>(i)), lanes);
+    _mm512_mask_compressstoreu_epi32(out, mask, idx);
+    out += popcount(mask);
+  }
+#elif defined(__AVX2__)
+  const CompressTable& table = compress_table();
+  const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  for ( ; i + simd_width <= iend && out + simd_width <= out_end; i += simd_width) {
+    const unsigned mask = match_mask(x + i);
+    const __m256i idx = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(i)), lanes);
+    const __m256i perm = _mm256_load_si256(reinterpret_cast<const __m256i*>(table.perm[mask]));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+                        _mm256_permutevar8x32_epi32(idx, perm));
+    out += popcount(mask);
+  }
+#endif
+
+  (void) out_end;
+  for ( ; i < iend; ++i) {
+    if (x[i] < 0.0) {
+      *out++ = static_cast<Int_type>(i);
+    }
+  }
+}
+
+inline Index_type compress(const Real_type* x, Int_type* list,
+                           Index_type ibegin, Index_type iend)
+{
+  std::vector<Index_type> thread_counts(omp_get_max_threads()+1, 0);
+  Index_type len = 0;
+
+  #pragma omp parallel
+  {
+    const int nthreads = omp_get_num_threads();
+    const int tid = omp_get_thread_num();
+    const Index_type local_begin = ibegin + (iend - ibegin) * tid / nthreads;
+    const Index_type local_end = ibegin + (iend - ibegin) * (tid+1) / nthreads;
+
+    Index_type count = 0;
+    #pragma omp simd reduction(+:count)
+    for (Index_type i = local_begin; i < local_end; ++i) {
+      count += (x[i] < 0.0) ? 1 : 0;
+    }
+    thread_counts[tid+1] = count;
+
+    #pragma omp barrier
+
+    #pragma omp single
+    {
+      for (int t = 0; t < nthreads; ++t) {
+        thread_counts[t+1] += thread_counts[t];
+      }
+      len = thread_counts[nthreads];
+    }
+
+    compress_block(x, list + thread_counts[tid], list + thread_counts[tid+1],
+                   local_begin, local_end);
+  }
+
+  return len;
+}
+
+//
+// scratch holds iend - ibegin values; each thread uses the part of it that
+// matches its block of x.
+//
+inline Index_type buffer(const Real_type* x, Int_type* list, Int_type* scratch,
+                         Index_type ibegin, Index_type iend)
+{
+  std::vector<Index_type> thread_counts(omp_get_max_threads()+1, 0);
+  Index_type len = 0;
+
+  #pragma omp parallel
+  {
+    const int nthreads = omp_get_num_threads();
+    const int tid = omp_get_thread_num();
+    const Index_type local_begin = ibegin + (iend - ibegin) * tid / nthreads;
+    const Index_type local_end = ibegin + (iend - ibegin) * (tid+1) / nthreads;
+    Int_type* local_buffer = scratch + (local_begin - ibegin);
+
+    // branch free append; the write past the last match stays in the block
+    Index_type count = 0;
+    for (Index_type i = local_begin; i < local_end; ++i) {
+      local_buffer[count] = static_cast<Int_type>(i);
+      count += (x[i] < 0.0) ? 1 : 0;
+    }
+    thread_counts[tid+1] = count;
+
+    #pragma omp barrier
+
+    #pragma omp single
+    {
+      for (int t = 0; t < nthreads; ++t) {
+        thread_counts[t+1] += thread_counts[t];
+      }
+      len = thread_counts[nthreads];
+    }
+
+    std::copy(local_buffer, local_buffer + count, list + thread_counts[tid]);
+  }
+
+  return len;
+}
+
+inline Index_type compact(Algorithm alg, const Real_type* x, Int_type* list,
+                          Int_type* scratch, Index_type ibegin, Index_type iend)
+{
+  switch (alg) {
+    case Compress: return compress(x, list, ibegin, iend);
+    case Buffer:   return buffer(x, list, scratch, ibegin, iend);
+    default:       return 0;
+  }
+}
+
+#endif
+
+} // end namespace omp_compress
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -31,6 +31,7 @@
   pi += dx / (1.0 + x * x);
 
 #include "common/KernelBase.hpp"
+#include "common/ReproducibleReduce.hpp"
 
 namespace rajaperf
 {
@@ -57,6 +58,10 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantRepro(VariantID vid, repro_reduce::Algorithm alg);
+
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
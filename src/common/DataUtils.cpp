@@ -14,9 +14,14 @@
 
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <random>
 #include <stdexcept>
+#include <vector>
 #include <unistd.h>
 
 namespace rajaperf
@@ -366,10 +371,12 @@ void deallocData(DataSpace dataSpace, void* ptr)
 
 
 /*
- * \brief Initialize Int_type data array to
- * randomly signed positive and negative values.
+ * Initialize integer data array to randomly signed positive and
+ * negative values, shared by the Int_type and Index_type versions
+ * so both produce the same values.
  */
-void initData(Int_ptr& ptr, int len)
+template < typename IntT >
+static void initSignedIntData(IntT* ptr, int len)
 {
   srand(4793);
 
@@ -391,6 +398,24 @@ void initData(Int_ptr& ptr, int len)
   incDataInitCount();
 }
 
+/*
+ * \brief Initialize Int_type data array to
+ * randomly signed positive and negative values.
+ */
+void initData(Int_ptr& ptr, int len)
+{
+  initSignedIntData(ptr, len);
+}
+
+/*
+ * Initialize Index_type data array to the same values as the
+ * Int_type version above.
+ */
+void initData(Index_ptr& ptr, int len)
+{
+  initSignedIntData(ptr, len);
+}
+
 /*
  * Initialize Real_type data array to non-random
  * positive values (0.0, 1.0) based on their array position
@@ -419,6 +444,32 @@ void initDataConst(Real_ptr& ptr, int len, Real_type val)
   incDataInitCount();
 }
 
+/*
+ * Initialize AltReal_type data array.
+ */
+void initData(AltReal_ptr& ptr, int len)
+{
+  Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
+
+  for (int i = 0; i < len; ++i) {
+    ptr[i] = static_cast<AltReal_type>(factor*(i + 1.1)/(i + 1.12345));
+  }
+
+  incDataInitCount();
+}
+
+/*
+ * Initialize AltReal_type data array to constant values.
+ */
+void initDataConst(AltReal_ptr& ptr, int len, AltReal_type val)
+{
+  for (int i = 0; i < len; ++i) {
+    ptr[i] = val;
+  };
+
+  incDataInitCount();
+}
+
 /*
  * Initialize Index_type data array to constant values.
  */
@@ -435,14 +486,24 @@ void initDataConst(Index_type*& ptr, int len, Index_type val)
  * Initialize Real_type data array with random sign.
  */
 void initDataRandSign(Real_ptr& ptr, int len)
+{
+  initDataRandSign(ptr, len, 0.5);
+}
+
+/*
+ * Initialize Real_type data array with random sign, negative with
+ * probability neg_fraction.
+ */
+void initDataRandSign(Real_ptr& ptr, int len, Real_type neg_fraction)
 {
   Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
 
+  const Real_type neg_limit = neg_fraction * (Real_type(RAND_MAX) + 1.0);
+
   srand(4793);
 
   for (int i = 0; i < len; ++i) {
-    Real_type signfact = Real_type(rand())/RAND_MAX;
-    signfact = ( signfact < 0.5 ? -1.0 : 1.0 );
+    Real_type signfact = ( Real_type(rand()) < neg_limit ? -1.0 : 1.0 );
     ptr[i] = signfact*factor*(i + 1.1)/(i + 1.12345);
   };
 
@@ -463,6 +524,92 @@ void initDataRandValue(Real_ptr& ptr, int len)
   incDataInitCount();
 }
 
+/*
+ * Initialize Real_type data array with values from a sort input distribution.
+ */
+void initDataSortInput(Real_ptr& ptr, int len, SortInput input)
+{
+  if (input == SortInput::Uniform) {
+    initDataRandValue(ptr, len);
+    return;
+  }
+
+  // mt19937_64 output is fully specified by the standard, unlike the
+  // standard distributions, so convert its output to [0, 1) directly
+  std::mt19937_64 gen(4793);
+  auto rand_value = [&]() {
+    return Real_type(gen() >> 11) * (Real_type(1.0) / (std::uint64_t(1) << 53));
+  };
+
+  switch (input) {
+
+    case SortInput::Sorted : {
+      for (int i = 0; i < len; ++i) {
+        ptr[i] = (i + 0.5) / len;
+      }
+      break;
+    }
+
+    case SortInput::Reverse : {
+      for (int i = 0; i < len; ++i) {
+        ptr[i] = (len - i - 0.5) / len;
+      }
+      break;
+    }
+
+    case SortInput::Nearly : {
+      // sorted with 1% of the values swapped with a nearby value
+      const int max_dist = 64;
+      for (int i = 0; i < len; ++i) {
+        ptr[i] = (i + 0.5) / len;
+      }
+      for (int s = 0; s < len / 100; ++s) {
+        const int i = static_cast<int>(gen() % len);
+        const int j = std::min(len - 1, i + 1 + static_cast<int>(gen() % max_dist));
+        std::swap(ptr[i], ptr[j]);
+      }
+      break;
+    }
+
+    case SortInput::FewUnique : {
+      const int num_keys = 16;
+      for (int i = 0; i < len; ++i) {
+        ptr[i] = Real_type(gen() % num_keys) / num_keys;
+      }
+      break;
+    }
+
+    case SortInput::Zipf : {
+      // key ranks drawn with probability proportional to 1/rank, ranks
+      // mapped to values with an odd multiplier so frequent keys are spread
+      // over the interval
+      const std::uint64_t num_keys = 1 << 20;
+      std::vector<Real_type> cdf(num_keys);
+      Real_type sum = 0.0;
+      for (std::uint64_t r = 0; r < num_keys; ++r) {
+        sum += 1.0 / (r + 1);
+        cdf[r] = sum;
+      }
+      for (int i = 0; i < len; ++i) {
+        const Real_type u = rand_value() * sum;
+        const std::uint64_t r = std::min<std::uint64_t>(num_keys - 1,
+            std::upper_bound(cdf.begin(), cdf.end(), u) - cdf.begin());
+        ptr[i] = ((r * 2654435761u) % num_keys + 0.5) / num_keys;
+      }
+      break;
+    }
+
+    default : {
+      for (int i = 0; i < len; ++i) {
+        ptr[i] = rand_value();
+      }
+    }
+
+  }
+
+  incDataInitCount();
+}
+
 /*
  * Initialize Complex_type data array.
  */
@@ -514,6 +661,23 @@ long double calcChecksum(Int_ptr ptr, int len,
   return tchk;
 }
 
+long double calcChecksum(Index_ptr ptr, int len,
+                         Real_type scale_factor)
+{
+  long double tchk = 0.0;
+  long double ckahan = 0.0;
+  for (Index_type j = 0; j < len; ++j) {
+    long double x = (std::abs(std::sin(j+1.0))+0.5) * ptr[j];
+    long double y = x - ckahan;
+    volatile long double t = tchk + y;
+    volatile long double z = t - tchk;
+    ckahan = z - y;
+    tchk = t;
+  }
+  tchk *= scale_factor;
+  return tchk;
+}
+
 long double calcChecksum(Real_ptr ptr, int len,
                          Real_type scale_factor)
 {
@@ -536,6 +700,23 @@ long double calcChecksum(Real_ptr ptr, int len,
   return tchk;
 }
 
+long double calcChecksum(AltReal_ptr ptr, int len,
+                         Real_type scale_factor)
+{
+  long double tchk = 0.0;
+  long double ckahan = 0.0;
+  for (Index_type j = 0; j < len; ++j) {
+    long double x = (std::abs(std::sin(j+1.0))+0.5) * ptr[j];
+    long double y = x - ckahan;
+    volatile long double t = tchk + y;
+    volatile long double z = t - tchk;
+    ckahan = z - y;
+    tchk = t;
+  }
+  tchk *= scale_factor;
+  return tchk;
+}
+
 long double calcChecksum(Complex_ptr ptr, int len,
                          Real_type scale_factor)
 {
@@ -600,4 +781,92 @@ DataSpace hostAccessibleDataSpace(DataSpace dataSpace)
   }
 }
 
+/*
+ * Get offsets of segments with lengths from a segment length distribution.
+ */
+std::vector<Index_type> getSegmentOffsets(Index_type len,
+                                          Index_type mean_length,
+                                          SegmentLengths lengths)
+{
+  std::mt19937_64 gen(4793);
+  auto rand_value = [&]() {
+    return Real_type(gen() >> 11) * (Real_type(1.0) / (std::uint64_t(1) << 53));
+  };
+
+  mean_length = std::max(mean_length, Index_type(1));
+
+  std::vector<Index_type> offsets;
+  offsets.reserve(len / mean_length + 2);
+
+  Index_type begin = 0;
+  while (begin < len) {
+    offsets.push_back(begin);
+
+    Index_type seg_len = 1;
+    switch (lengths) {
+
+      case SegmentLengths::Uniform : {
+        // lengths uniform in [1, 2*mean_length-1]
+        seg_len = 1 + static_cast<Index_type>(gen() % (2*mean_length - 1));
+        break;
+      }
+
+      case SegmentLengths::PowerLaw : {
+        // Pareto distributed lengths with shape 1.5, whose mean is three
+        // times the minimum length; the variance is unbounded so a few
+        // segments are far longer than the rest
+        const Real_type shape = 1.5;
+        const Real_type min_length = mean_length * (shape - 1.0) / shape;
+        const Real_type u = 1.0 - rand_value();
+        seg_len = static_cast<Index_type>(
+            std::min(Real_type(len), std::ceil(min_length * std::pow(u, -1.0 / shape))));
+        break;
+      }
+
+      default : {
+        seg_len = mean_length;
+      }
+    }
+
+    begin += std::max(Index_type(1), std::min(seg_len, len - begin));
+  }
+  offsets.push_back(len);
+
+  return offsets;
+}
+
+/*
+ * Get keys following a Zipf distribution.
+ */
+std::vector<Int_type> getZipfKeys(Index_type len,
+                                  Index_type num_keys,
+                                  Real_type exponent)
+{
+  std::mt19937_64 gen(4793);
+  auto rand_value = [&]() {
+    return Real_type(gen() >> 11) * (Real_type(1.0) / (std::uint64_t(1) << 53));
+  };
+
+  num_keys = std::max(num_keys, Index_type(1));
+
+  std::vector<Real_type> cdf(num_keys);
+  Real_type sum = 0.0;
+  for (Index_type r = 0; r < num_keys; ++r) {
+    sum += std::pow(Real_type(r + 1), -exponent);
+    cdf[r] = sum;
+  }
+
+  // 2654435761 is prime, so this maps ranks to keys one to one
+  std::vector<Int_type> keys(len);
+  for (Index_type i = 0; i < len; ++i) {
+    const Real_type u = rand_value() * sum;
+    const Index_type r = std::min(num_keys - 1, static_cast<Index_type>(
+        std::upper_bound(cdf.begin(), cdf.end(), u) - cdf.begin()));
+    keys[i] = static_cast<Int_type>(
+        (static_cast<std::uint64_t>(r) * 2654435761u) % num_keys);
+  }
+
+  return keys;
+}
+
 }  // closing brace for rajaperf namespace
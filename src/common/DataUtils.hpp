@@ -20,6 +20,7 @@
 #include <limits>
 #include <new>
 #include <type_traits>
+#include <vector>
 
 #if defined(RAJA_ENABLE_CUDA)
 #include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
@@ -84,6 +85,14 @@ void deallocData(DataSpace dataSpace, void* ptr);
  */
 void initData(Int_ptr& ptr, int len);
 
+/*!
+ * \brief Initialize Index_type data array.
+ *
+ * Array entries are set in the same way as the method
+ * initData(Int_ptr& ptr...) above.
+ */
+void initData(Index_ptr& ptr, int len);
+
 /*!
  * \brief Initialize Real_type data array.
  *
@@ -100,6 +109,21 @@ void initData(Real_ptr& ptr, int len);
  */
 void initDataConst(Real_ptr& ptr, int len, Real_type val);
 
+/*!
+ * \brief Initialize AltReal_type data array.
+ *
+ * Array entries are set in the same way as the method
+ * initData(Real_ptr& ptr...) above, rounded to AltReal_type.
+ */
+void initData(AltReal_ptr& ptr, int len);
+
+/*!
+ * \brief Initialize AltReal_type data array.
+ *
+ * Array entries are set to given constant value.
+ */
+void initDataConst(AltReal_ptr& ptr, int len, AltReal_type val);
+
 /*!
  * \brief Initialize Index_type data array.
  *
@@ -115,6 +139,13 @@ void initDataConst(Index_type*& ptr, int len, Index_type val);
  */
 void initDataRandSign(Real_ptr& ptr, int len);
 
+/*!
+ * \brief Initialize Real_type data array with random sign.
+ *
+ * As above, but entries are negative with probability neg_fraction.
+ */
+void initDataRandSign(Real_ptr& ptr, int len, Real_type neg_fraction);
+
 /*!
  * \brief Initialize Real_type data array with random values.
  *
@@ -122,6 +153,15 @@ void initDataRandSign(Real_ptr& ptr, int len);
  */
 void initDataRandValue(Real_ptr& ptr, int len);
 
+/*!
+ * \brief Initialize Real_type data array with values in the interval
+ *        [0.0, 1.0] following the given input distribution.
+ *
+ * The uniform distribution matches initDataRandValue. The others are
+ * generated with a fixed seed so data is reproducible across platforms.
+ */
+void initDataSortInput(Real_ptr& ptr, int len, SortInput input);
+
 /*!
  * \brief Initialize Complex_type data array.
  *
@@ -150,9 +190,15 @@ void initData(Real_type& d);
 long double calcChecksum(Int_ptr d, int len,
                          Real_type scale_factor);
 ///
+long double calcChecksum(Index_ptr d, int len,
+                         Real_type scale_factor);
+///
 long double calcChecksum(Real_ptr d, int len,
                          Real_type scale_factor);
 ///
+long double calcChecksum(AltReal_ptr d, int len,
+                         Real_type scale_factor);
+///
 long double calcChecksum(Complex_ptr d, int len,
                          Real_type scale_factor);
 
@@ -167,6 +213,33 @@ long double calcChecksum(Complex_ptr d, int len,
  */
 DataSpace hostAccessibleDataSpace(DataSpace dataSpace);
 
+/*!
+ * \brief Get offsets of segments that partition [0, len) with lengths drawn
+ *        from the given distribution with the given mean length.
+ *
+ * Entry s of the result is the start of segment s and the last entry is len,
+ * so there is one more entry than segments. Every segment is non-empty and
+ * lengths are generated with a fixed seed so they are reproducible across
+ * platforms.
+ */
+std::vector<Index_type> getSegmentOffsets(Index_type len,
+                                          Index_type mean_length,
+                                          SegmentLengths lengths);
+
+/*!
+ * \brief Get len keys in [0, num_keys) following a Zipf distribution with
+ *        the given exponent.
+ *
+ * The key of rank r is drawn with probability proportional to
+ * 1/(r+1)^exponent, so an exponent of 0 gives uniform keys. Ranks are mapped
+ * to keys with a multiplicative hash so the frequent keys are spread over
+ * the range. Keys are generated with a fixed seed so they are reproducible
+ * across platforms.
+ */
+std::vector<Int_type> getZipfKeys(Index_type len,
+                                  Index_type num_keys,
+                                  Real_type exponent);
+
 /*!
  * \brief Allocate data array (ptr).
  */
@@ -339,6 +412,25 @@ inline void allocAndInitDataRandSign(DataSpace dataSpace, T*& ptr, int len, int
   moveData(dataSpace, init_dataSpace, ptr, len, align);
 }
 
+/*!
+ * \brief Allocate and initialize aligned Real_type data array with random
+ *        sign, negative with probability neg_fraction.
+ *
+ * Array is initialized using method initDataRandSign.
+ */
+template <typename T>
+inline void allocAndInitDataRandSign(DataSpace dataSpace, T*& ptr, int len, int align,
+                                     Real_type neg_fraction)
+{
+  DataSpace init_dataSpace = hostAccessibleDataSpace(dataSpace);
+
+  allocData(init_dataSpace, ptr, len, align);
+
+  detail::initDataRandSign(ptr, len, neg_fraction);
+
+  moveData(dataSpace, init_dataSpace, ptr, len, align);
+}
+
 /*!
  * \brief Allocate and initialize aligned Real_type data array with random
  *        values.
@@ -357,6 +449,25 @@ inline void allocAndInitDataRandValue(DataSpace dataSpace, T*& ptr, int len, int
   moveData(dataSpace, init_dataSpace, ptr, len, align);
 }
 
+/*!
+ * \brief Allocate and initialize aligned Real_type data array with values
+ *        following the given sort input distribution.
+ *
+ * Array is initialized using method initDataSortInput.
+ */
+template <typename T>
+inline void allocAndInitDataSortInput(DataSpace dataSpace, T*& ptr, int len, int align,
+                                      SortInput input)
+{
+  DataSpace init_dataSpace = hostAccessibleDataSpace(dataSpace);
+
+  allocData(init_dataSpace, ptr, len, align);
+
+  detail::initDataSortInput(ptr, len, input);
+
+  moveData(dataSpace, init_dataSpace, ptr, len, align);
+}
+
 /*
  * Calculate and return checksum for arrays.
  */
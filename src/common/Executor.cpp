@@ -148,6 +148,8 @@ void Executor::setupSuite()
         combiners.emplace_back(RunParams::CombinerOpt::Minimum);
       } else if (combiner_name == RunParams::CombinerOptToStr(RunParams::CombinerOpt::Maximum)) {
         combiners.emplace_back(RunParams::CombinerOpt::Maximum);
+      } else if (combiner_name == RunParams::CombinerOptToStr(RunParams::CombinerOpt::Median)) {
+        combiners.emplace_back(RunParams::CombinerOpt::Median);
       } else {
         invalid.emplace_back(combiner_name);
       }
@@ -609,6 +611,14 @@ void Executor::setupSuite()
         variant_ids.push_back( *vid );
       }
 
+      //
+      // Restrict tunings run to those given in tunings file, if any.
+      //
+      if ( !run_params.getTuningsFromFile().empty() &&
+           !readTuningsFile(run_params.getTuningsFromFile()) ) {
+        run_params.setInputState(RunParams::BadInput);
+      }
+
       //
       // Make a single ordering of tuning names for each variant across kernels.
       //
@@ -617,6 +627,9 @@ void Executor::setupSuite()
         for (const KernelBase* kernel : kernels) {
           for (std::string const& tuning_name :
                kernel->getVariantTuningNames(vid)) {
+            if (!isTuningSelected(kernel, vid, tuning_name)) {
+              continue;
+            }
             if (tuning_names_order_map.find(tuning_name) ==
                 tuning_names_order_map.end()) {
               tuning_names_order_map.emplace(
@@ -642,7 +655,8 @@ void Executor::setupSuite()
       // If we've gotten to this point, we have good input to run.
       //
       if ( run_params.getInputState() != RunParams::DryRun &&
-           run_params.getInputState() != RunParams::CheckRun ) {
+           run_params.getInputState() != RunParams::CheckRun &&
+           run_params.getInputState() != RunParams::BadInput ) {
         run_params.setInputState(RunParams::PerfRun);
       }
 
@@ -707,6 +721,23 @@ void Executor::reportRunSummary(ostream& str) const
       str << "\t Kernel size = " << run_params.getSize() << endl;
     }
     str << "\t Kernel rep factor = " << run_params.getRepFactor() << endl;
+    str << "\t Sort input = " << getSortInputName(run_params.getSortInput()) << endl;
+    str << "\t Segment lengths = " << getSegmentLengthsName(run_params.getSegmentLengths()) << endl;
+    str << "\t Selectivity = " << run_params.getSelectivity() << endl;
+    str << "\t K fraction = " << run_params.getKFraction() << endl;
+    str << "\t Histogram bins = " << run_params.getHistogramBins()
+        << ", skew = " << run_params.getHistogramSkew() << endl;
+    str << "\t Hash load factor = " << run_params.getHashLoadFactor()
+        << ", hit ratio = " << run_params.getHashHitRatio() << endl;
+    str << "\t LTIMES directions = " << run_params.getLTimesNumD()
+        << ", groups = " << run_params.getLTimesNumG()
+        << ", moments = " << run_params.getLTimesNumM() << endl;
+    if ( !run_params.getTuningsFromFile().empty() ) {
+      str << "\t Tunings read from " << run_params.getTuningsFromFile() << endl;
+    }
+    if ( run_params.getAutotune() ) {
+      str << "\t Best tunings will be written to " << ofiles << "-tunings.csv" << endl;
+    }
     str << "\t Output files will be named " << ofiles << endl;
 
     str << "\nThe following kernels and variants (when available for a kernel) will be run:" << endl;
@@ -779,9 +810,17 @@ void Executor::writeKernelInfoSummary(ostream& str, bool to_file) const
     kercol_width = max(kercol_width, kernels[ik]->getName().size());
     psize_width = max(psize_width, kernels[ik]->getActualProblemSize());
     reps_width = max(reps_width, kernels[ik]->getRunReps());
-    itsrep_width = max(reps_width, kernels[ik]->getItsPerRep());
+    itsrep_width = max(itsrep_width, kernels[ik]->getItsPerRep());
     bytesrep_width = max(bytesrep_width, kernels[ik]->getBytesPerRep());
-    flopsrep_width = max(bytesrep_width, kernels[ik]->getFLOPsPerRep());
+    flopsrep_width = max(flopsrep_width, kernels[ik]->getFLOPsPerRep());
+    for (std::string const& tuning_name : kernels[ik]->getProblemTuningNames()) {
+      kercol_width = max(kercol_width,
+                         kernels[ik]->getName().size() + 1 + tuning_name.size());
+      psize_width = max(psize_width, kernels[ik]->getActualProblemSize(tuning_name));
+      itsrep_width = max(itsrep_width, kernels[ik]->getItsPerRep(tuning_name));
+      bytesrep_width = max(bytesrep_width, kernels[ik]->getBytesPerRep(tuning_name));
+      flopsrep_width = max(flopsrep_width, kernels[ik]->getFLOPsPerRep(tuning_name));
+    }
   }
 
   const string sepchr(" , ");
@@ -851,6 +890,17 @@ void Executor::writeKernelInfoSummary(ostream& str, bool to_file) const
         << sepchr <<right<< setw(bytesrep_width) << kern->getBytesPerRep()
         << sepchr <<right<< setw(flopsrep_width) << kern->getFLOPsPerRep()
         << endl;
+    // tunings that run a problem of their own get a row of their own
+    for (std::string const& tuning_name : kern->getProblemTuningNames()) {
+      str <<left<< setw(kercol_width) << kern->getName() + " " + tuning_name
+          << sepchr <<right<< setw(psize_width) << kern->getActualProblemSize(tuning_name)
+          << sepchr <<right<< setw(reps_width) << kern->getRunReps()
+          << sepchr <<right<< setw(itsrep_width) << kern->getItsPerRep(tuning_name)
+          << sepchr <<right<< setw(kernsrep_width) << kern->getKernelsPerRep()
+          << sepchr <<right<< setw(bytesrep_width) << kern->getBytesPerRep(tuning_name)
+          << sepchr <<right<< setw(flopsrep_width) << kern->getFLOPsPerRep(tuning_name)
+          << endl;
+    }
   }
 
   str.flush();
@@ -928,6 +978,11 @@ void Executor::runKernel(KernelBase* kernel, bool print_kernel_name)
 
     for (size_t tune_idx = 0; tune_idx < kernel->getNumVariantTunings(vid); ++tune_idx) {
 
+      if ( !isTuningSelected(kernel, vid,
+                             kernel->getVariantTuningName(vid, tune_idx)) ) {
+        continue;
+      }
+
       if ( run_params.showProgress() ) {
         getCout() << "     Running "
                   << kernel->getVariantTuningName(vid, tune_idx) << " tuning";
@@ -940,6 +995,106 @@ void Executor::runKernel(KernelBase* kernel, bool print_kernel_name)
   } // loop over variants
 }
 
+bool Executor::readTuningsFile(const string& filename)
+{
+  ifstream file(filename.c_str());
+  if ( !file ) {
+    getCout() << "\nBad input:"
+              << " can't open tunings file " << filename << endl;
+    return false;
+  }
+
+  bool good = true;
+
+  string line;
+  while ( getline(file, line) ) {
+
+    //
+    // Each line holds comma separated kernel, variant, and tuning names,
+    // optionally followed by other data that is ignored.
+    //
+    vector<string> fields;
+    istringstream line_stream(line);
+    string field;
+    while ( getline(line_stream, field, ',') ) {
+      const size_t first = field.find_first_not_of(" \t\r");
+      const size_t last = field.find_last_not_of(" \t\r");
+      fields.emplace_back( (first == string::npos) ?
+                           string() : field.substr(first, last-first+1) );
+    }
+
+    if ( fields.empty() || fields[0].empty() || fields[0][0] == '#' ||
+         fields[0] == "Kernel" ) {
+      continue;
+    }
+
+    if ( fields.size() < 3 ) {
+      getCout() << "\nBad input:"
+                << " malformed line in tunings file: " << line << endl;
+      good = false;
+      continue;
+    }
+
+    const string& kernel_name = fields[0];
+    const string& variant_name = fields[1];
+    const string& tuning_name = fields[2];
+
+    bool found_kernel = false;
+    for (size_t ik = 0; ik < NumKernels; ++ik) {
+      if ( getFullKernelName(static_cast<KernelID>(ik)) == kernel_name ) {
+        found_kernel = true;
+      }
+    }
+
+    VariantID vid = NumVariants;
+    for (size_t iv = 0; iv < NumVariants; ++iv) {
+      if ( getVariantName(static_cast<VariantID>(iv)) == variant_name ) {
+        vid = static_cast<VariantID>(iv);
+      }
+    }
+
+    if ( !found_kernel || vid == NumVariants ) {
+      getCout() << "\nBad input:"
+                << " unknown kernel or variant in tunings file: "
+                << kernel_name << " " << variant_name << endl;
+      good = false;
+      continue;
+    }
+
+    //
+    // Entries for kernels and variants that are not run are ignored.
+    //
+    for (const KernelBase* kernel : kernels) {
+      if ( kernel->getName() == kernel_name &&
+           kernel->hasVariantDefined(vid) &&
+           find(variant_ids.begin(), variant_ids.end(), vid) != variant_ids.end() ) {
+        if ( kernel->hasVariantTuningDefined(vid, tuning_name) ) {
+          selected_tunings[vid][kernel_name] = tuning_name;
+        } else {
+          getCout() << "\nBad input:"
+                    << " unknown tuning in tunings file: "
+                    << kernel_name << " " << variant_name << "-"
+                    << tuning_name << endl;
+          good = false;
+        }
+      }
+    }
+
+  }
+
+  return good;
+}
+
+bool Executor::isTuningSelected(const KernelBase* kern, VariantID vid,
+                                const string& tuning_name) const
+{
+  auto selected = selected_tunings[vid].find(kern->getName());
+  if ( selected == selected_tunings[vid].end() ) {
+    return true;
+  }
+  return selected->second == tuning_name;
+}
+
 void Executor::outputRunData()
 {
   RunParams::InputOpt in_state = run_params.getInputState();
@@ -976,6 +1131,11 @@ void Executor::outputRunData()
   file = openOutputFile(out_fprefix + "-checksum.txt");
   writeChecksumReport(*file);
 
+  if ( run_params.getAutotune() ) {
+    file = openOutputFile(out_fprefix + "-tunings.csv");
+    writeTuningsReport(*file);
+  }
+
   {
     vector<FOMGroup> fom_groups;
     getFOMGroups(fom_groups);
@@ -1085,11 +1245,13 @@ void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
           std::string const& tuning_name = tuning_names[variant_ids[iv]][it];
           file << sepchr <<right<< setw(vartuncol_width[iv][it]);
           if ( (mode == CSVRepMode::Speedup) &&
-               (!kern->hasVariantTuningDefined(reference_vid, reference_tune_idx) ||
-                !kern->hasVariantTuningDefined(vid, tuning_name)) ) {
+               (!kern->wasVariantTuningRun(reference_vid, reference_tune_idx) ||
+                !kern->wasVariantTuningRun(vid,
+                    kern->getVariantTuningIndex(vid, tuning_name))) ) {
             file << "Not run";
           } else if ( (mode == CSVRepMode::Timing) &&
-                      !kern->hasVariantTuningDefined(vid, tuning_name) ) {
+                      !kern->wasVariantTuningRun(vid,
+                          kern->getVariantTuningIndex(vid, tuning_name)) ) {
             file << "Not run";
           } else {
             file << setprecision(prec) << std::fixed
@@ -1430,6 +1592,8 @@ void Executor::writeChecksumReport(ostream& file)
 #if defined(RAJA_PERFSUITE_ENABLE_MPI)
     file << "for " << num_ranks << " MPI ranks ";
 #endif
+    file << "with " << getSortInputName(run_params.getSortInput())
+         << " sort input ";
     file << endl;
     file << equal_line << endl;
 
@@ -1466,22 +1630,6 @@ void Executor::writeChecksumReport(ostream& file)
       file <<left<< setw(namecol_width) << kern->getName() << endl;
       file << dot_line << endl;
 
-      Checksum_type cksum_ref = 0.0;
-      size_t ivck = 0;
-      bool found_ref = false;
-      while ( ivck < variant_ids.size() && !found_ref ) {
-        VariantID vid = variant_ids[ivck];
-        size_t num_tunings = kern->getNumVariantTunings(vid);
-        for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
-          if ( kern->wasVariantTuningRun(vid, tune_idx) ) {
-            cksum_ref = kern->getChecksum(vid, tune_idx);
-            found_ref = true;
-            break;
-          }
-        }
-        ++ivck;
-      }
-
       // get vector of checksums and diffs
       std::vector<std::vector<Checksum_type>> checksums(variant_ids.size());
       std::vector<std::vector<Checksum_type>> checksums_diff(variant_ids.size());
@@ -1494,7 +1642,9 @@ void Executor::writeChecksumReport(ostream& file)
         for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
           if ( kern->wasVariantTuningRun(vid, tune_idx) ) {
             checksums[iv][tune_idx] = kern->getChecksum(vid, tune_idx);
-            checksums_diff[iv][tune_idx] = cksum_ref - kern->getChecksum(vid, tune_idx);
+            checksums_diff[iv][tune_idx] =
+                kern->getReferenceChecksum(variant_ids, vid, tune_idx) -
+                kern->getChecksum(vid, tune_idx);
           }
         }
       }
@@ -1622,6 +1772,77 @@ void Executor::writeChecksumReport(ostream& file)
 }
 
 
+void Executor::writeTuningsReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel");
+    const string variant_col_name("Variant");
+    const string tuning_col_name("Tuning");
+    const string sepchr(" , ");
+    size_t prec = 9;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        tuncol_width = max(tuncol_width, tuning_name.size());
+      }
+    }
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name
+         << sepchr << "Median time (sec.)" << endl;
+
+    //
+    // Print the tuning with the lowest median time for each kernel variant.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+
+        size_t best_tune_idx = KernelBase::getUnknownTuningIdx();
+        double best_time = numeric_limits<double>::max();
+        for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid); ++tune_idx) {
+          if ( kern->wasVariantTuningRun(vid, tune_idx) &&
+               kern->getMedianTime(vid, tune_idx) < best_time ) {
+            best_tune_idx = tune_idx;
+            best_time = kern->getMedianTime(vid, tune_idx);
+          }
+        }
+
+        if ( best_tune_idx != KernelBase::getUnknownTuningIdx() ) {
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width)
+               << kern->getVariantTuningName(vid, best_tune_idx)
+               << sepchr << setprecision(prec) << std::fixed << best_time
+               << endl;
+        }
+      }
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
 string Executor::getReportTitle(CSVRepMode mode, RunParams::CombinerOpt combiner)
 {
   string title;
@@ -1638,6 +1859,10 @@ string Executor::getReportTitle(CSVRepMode mode, RunParams::CombinerOpt combiner
       title = string("Max ");
     }
     break;
+    case RunParams::CombinerOpt::Median : {
+      title = string("Median ");
+    }
+    break;
     default : { getCout() << "\n Unknown CSV combiner mode = " << combiner << endl; }
   }
   switch ( mode ) {
@@ -1680,6 +1905,10 @@ long double Executor::getReportDataEntry(CSVRepMode mode,
           retval = kern->getMaxTime(vid, tune_idx);
         }
         break;
+        case RunParams::CombinerOpt::Median : {
+          retval = kern->getMedianTime(vid, tune_idx);
+        }
+        break;
         default : { getCout() << "\n Unknown CSV combiner mode = " << combiner << endl; }
       }
       break;
@@ -1704,6 +1933,11 @@ long double Executor::getReportDataEntry(CSVRepMode mode,
                        kern->getMaxTime(vid, tune_idx);
             }
             break;
+            case RunParams::CombinerOpt::Median : {
+              retval = kern->getMedianTime(reference_vid, reference_tune_idx) /
+                       kern->getMedianTime(vid, tune_idx);
+            }
+            break;
             default : { getCout() << "\n Unknown CSV combiner mode = " << combiner << endl; }
           }
         } else {
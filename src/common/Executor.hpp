@@ -17,6 +17,8 @@
 #include <memory>
 #include <utility>
 #include <set>
+#include <string>
+#include <unordered_map>
 
 namespace rajaperf {
 
@@ -65,6 +67,10 @@ private:
 
   void runKernel(KernelBase* kern, bool print_kernel_name);
 
+  bool readTuningsFile(const std::string& filename);
+  bool isTuningSelected(const KernelBase* kern, VariantID vid,
+                        const std::string& tuning_name) const;
+
   std::unique_ptr<std::ostream> openOutputFile(const std::string& filename) const;
 
   bool haveReferenceVariant() { return reference_vid < NumVariants; }
@@ -79,6 +85,8 @@ private:
 
   void writeChecksumReport(std::ostream& file);
 
+  void writeTuningsReport(std::ostream& file);
+
   void writeFOMReport(std::ostream& file, std::vector<FOMGroup>& fom_groups);
   void getFOMGroups(std::vector<FOMGroup>& fom_groups);
 
@@ -87,6 +95,9 @@ private:
   std::vector<VariantID>   variant_ids;
   std::vector<std::string> tuning_names[NumVariants];
 
+  // kernel name -> tuning name to run, read from tunings file
+  std::unordered_map<std::string, std::string> selected_tunings[NumVariants];
+
   VariantID reference_vid;
   size_t    reference_tune_idx;
 
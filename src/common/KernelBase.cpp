@@ -11,6 +11,7 @@
 #include "RunParams.hpp"
 #include "OpenMPTargetDataUtils.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <stdexcept>
@@ -52,6 +53,89 @@ KernelBase::~KernelBase()
 }
 
 
+void KernelBase::setTuningProblemSize(const std::string& tuning_name,
+                                      Index_type size)
+{
+  if (!isProblemTuning(tuning_name)) {
+    problem_tuning_names.emplace_back(tuning_name);
+  }
+  tuning_prob_size[tuning_name] = size;
+}
+
+void KernelBase::setTuningItsPerRep(const std::string& tuning_name,
+                                    Index_type its)
+{
+  if (!isProblemTuning(tuning_name)) {
+    problem_tuning_names.emplace_back(tuning_name);
+  }
+  tuning_its_per_rep[tuning_name] = its;
+}
+
+void KernelBase::setTuningBytesPerRep(const std::string& tuning_name,
+                                      Index_type bytes)
+{
+  if (!isProblemTuning(tuning_name)) {
+    problem_tuning_names.emplace_back(tuning_name);
+  }
+  tuning_bytes_per_rep[tuning_name] = bytes;
+}
+
+void KernelBase::setTuningFLOPsPerRep(const std::string& tuning_name,
+                                      Index_type FLOPs)
+{
+  if (!isProblemTuning(tuning_name)) {
+    problem_tuning_names.emplace_back(tuning_name);
+  }
+  tuning_FLOPs_per_rep[tuning_name] = FLOPs;
+}
+
+Index_type KernelBase::getActualProblemSize(const std::string& tuning_name) const
+{
+  auto it = tuning_prob_size.find(tuning_name);
+  return (it != tuning_prob_size.end()) ? it->second : actual_prob_size;
+}
+
+Index_type KernelBase::getItsPerRep(const std::string& tuning_name) const
+{
+  auto it = tuning_its_per_rep.find(tuning_name);
+  return (it != tuning_its_per_rep.end()) ? it->second : its_per_rep;
+}
+
+Index_type KernelBase::getBytesPerRep(const std::string& tuning_name) const
+{
+  auto it = tuning_bytes_per_rep.find(tuning_name);
+  return (it != tuning_bytes_per_rep.end()) ? it->second : bytes_per_rep;
+}
+
+Index_type KernelBase::getFLOPsPerRep(const std::string& tuning_name) const
+{
+  auto it = tuning_FLOPs_per_rep.find(tuning_name);
+  return (it != tuning_FLOPs_per_rep.end()) ? it->second : FLOPs_per_rep;
+}
+
+
+Checksum_type KernelBase::getReferenceChecksum(
+    const std::vector<VariantID>& variant_ids,
+    VariantID vid, size_t tune_idx) const
+{
+  const std::string& problem_name = getVariantTuningProblemName(vid, tune_idx);
+  const bool problem_tuning = isProblemTuning(problem_name);
+
+  for (VariantID ref_vid : variant_ids) {
+    size_t num_tunings = getNumVariantTunings(ref_vid);
+    for (size_t ref_idx = 0; ref_idx < num_tunings; ++ref_idx) {
+      if ( wasVariantTuningRun(ref_vid, ref_idx) &&
+           ( !problem_tuning ||
+             getVariantTuningProblemName(ref_vid, ref_idx) == problem_name ) ) {
+        return getChecksum(ref_vid, ref_idx);
+      }
+    }
+  }
+
+  return getChecksum(vid, tune_idx);
+}
+
+
 Index_type KernelBase::getTargetProblemSize() const
 {
   Index_type target_size = static_cast<Index_type>(0);
@@ -152,10 +236,13 @@ void KernelBase::setVariantDefined(VariantID vid)
   }
 
   checksum[vid].resize(variant_tuning_names[vid].size(), 0.0);
+  checksum_tolerance[vid].resize(variant_tuning_names[vid].size(),
+                                 getDefaultChecksumTolerance());
   num_exec[vid].resize(variant_tuning_names[vid].size(), 0);
   min_time[vid].resize(variant_tuning_names[vid].size(), std::numeric_limits<double>::max());
   max_time[vid].resize(variant_tuning_names[vid].size(), -std::numeric_limits<double>::max());
   tot_time[vid].resize(variant_tuning_names[vid].size(), 0.0);
+  exec_times[vid].resize(variant_tuning_names[vid].size());
 }
 
 int KernelBase::getDataAlignment() const
@@ -234,6 +321,24 @@ void KernelBase::recordExecTime()
   max_time[running_variant].at(running_tuning) =
       std::max(max_time[running_variant].at(running_tuning), exec_time);
   tot_time[running_variant].at(running_tuning) += exec_time;
+  exec_times[running_variant].at(running_tuning).push_back(exec_time);
+}
+
+double KernelBase::getMedianTime(VariantID vid, size_t tune_idx) const
+{
+  std::vector<RAJA::Timer::ElapsedType> times = exec_times[vid].at(tune_idx);
+  if (times.empty()) {
+    return 0.0;
+  }
+
+  const size_t mid = times.size() / 2;
+  std::nth_element(times.begin(), times.begin()+mid, times.end());
+  double median = times[mid];
+  if (times.size() % 2 == 0) {
+    median = 0.5 * (median +
+        *std::max_element(times.begin(), times.begin()+mid));
+  }
+  return median;
 }
 
 void KernelBase::runKernel(VariantID vid, size_t tune_idx)
@@ -339,6 +444,14 @@ void KernelBase::print(std::ostream& os) const
   os << "\t\t\t kernels_per_rep = " << kernels_per_rep << std::endl;
   os << "\t\t\t bytes_per_rep = " << bytes_per_rep << std::endl;
   os << "\t\t\t FLOPs_per_rep = " << FLOPs_per_rep << std::endl;
+  os << "\t\t\t problem tunings (actual_prob_size, its_per_rep, bytes_per_rep, FLOPs_per_rep): " << std::endl;
+  for (std::string const& tuning_name : problem_tuning_names) {
+    os << "\t\t\t\t" << tuning_name << " : "
+                     << getActualProblemSize(tuning_name) << " , "
+                     << getItsPerRep(tuning_name) << " , "
+                     << getBytesPerRep(tuning_name) << " , "
+                     << getFLOPsPerRep(tuning_name) << std::endl;
+  }
   os << "\t\t\t num_exec: " << std::endl;
   for (unsigned j = 0; j < NumVariants; ++j) {
     os << "\t\t\t\t" << getVariantName(static_cast<VariantID>(j))
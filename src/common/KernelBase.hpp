@@ -28,9 +28,12 @@
 
 #include <string>
 #include <vector>
+#include <map>
 #include <iostream>
 #include <limits>
 #include <utility>
+#include <algorithm>
+#include <cmath>
 
 namespace rajaperf {
 
@@ -47,6 +50,25 @@ public:
   static constexpr size_t getUnknownTuningIdx()
     { return std::numeric_limits<size_t>::max(); }
   static std::string getDefaultTuningName() { return "default"; }
+  static constexpr Checksum_type getDefaultChecksumTolerance()
+    { return 1.0e-7; }
+
+  // name of the tuning that runs a kernel in floating point type T
+  template < typename T >
+  static std::string getPrecisionTuningName()
+    { return "fp" + std::to_string(8*sizeof(T)); }
+
+  // name of the tuning that runs a kernel with loop indices of type Loop_T
+  // and index arrays of type List_T
+  template < typename Loop_T, typename List_T >
+  static std::string getIndexTuningName()
+    { return "loop" + std::to_string(8*sizeof(Loop_T)) +
+             "_list" + std::to_string(8*sizeof(List_T)); }
+
+  // name of the tuning that runs a kernel with loop indices of type Loop_T
+  template < typename Loop_T >
+  static std::string getLoopIndexTuningName()
+    { return "loop" + std::to_string(8*sizeof(Loop_T)); }
 
   KernelBase(KernelID kid, const RunParams& params);
 
@@ -68,11 +90,35 @@ public:
   void setBytesPerRep(Index_type bytes) { bytes_per_rep = bytes;}
   void setFLOPsPerRep(Index_type FLOPs) { FLOPs_per_rep = FLOPs; }
 
+  //
+  // Problem size, iterations, bytes and FLOPs per rep of a tuning that runs
+  // a problem of its own, such as one polynomial order of a partial
+  // assembly kernel; any not set are those of the default problem. The
+  // checksums of such a tuning are only compared with those of other
+  // tunings running the same problem, see getVariantTuningProblemName.
+  // A tuning that only moves different data for the same problem is added
+  // with the problem name of the tuning it reproduces.
+  //
+  void setTuningProblemSize(const std::string& tuning_name, Index_type size);
+  void setTuningItsPerRep(const std::string& tuning_name, Index_type its);
+  void setTuningBytesPerRep(const std::string& tuning_name, Index_type bytes);
+  void setTuningFLOPsPerRep(const std::string& tuning_name, Index_type FLOPs);
+
   void setUsesFeature(FeatureID fid) { uses_feature[fid] = true; }
 
   void setVariantDefined(VariantID vid);
   void addVariantTuningName(VariantID vid, std::string name)
-  { variant_tuning_names[vid].emplace_back(std::move(name)); }
+  {
+    variant_tuning_problem_names[vid].emplace_back(name);
+    variant_tuning_names[vid].emplace_back(std::move(name));
+  }
+  // add a tuning that runs the problem of the tuning named problem_name
+  void addVariantTuningName(VariantID vid, std::string name,
+                            std::string problem_name)
+  {
+    variant_tuning_problem_names[vid].emplace_back(std::move(problem_name));
+    variant_tuning_names[vid].emplace_back(std::move(name));
+  }
 
   virtual void setSeqTuningDefinitions(VariantID vid)
   { addVariantTuningName(vid, getDefaultTuningName()); }
@@ -115,6 +161,16 @@ public:
   Index_type getBytesPerRep() const { return bytes_per_rep; }
   Index_type getFLOPsPerRep() const { return FLOPs_per_rep; }
 
+  const std::vector<std::string>& getProblemTuningNames() const
+  { return problem_tuning_names; }
+  bool isProblemTuning(const std::string& tuning_name) const
+  { return std::find(problem_tuning_names.begin(), problem_tuning_names.end(),
+                     tuning_name) != problem_tuning_names.end(); }
+  Index_type getActualProblemSize(const std::string& tuning_name) const;
+  Index_type getItsPerRep(const std::string& tuning_name) const;
+  Index_type getBytesPerRep(const std::string& tuning_name) const;
+  Index_type getFLOPsPerRep(const std::string& tuning_name) const;
+
   Index_type getTargetProblemSize() const;
   Index_type getRunReps() const;
 
@@ -158,6 +214,17 @@ public:
   { return getVariantTuningNames(vid).at(tune_idx); }
   std::vector<std::string> const& getVariantTuningNames(VariantID vid) const
   { return variant_tuning_names[vid]; }
+  std::string const& getVariantTuningProblemName(VariantID vid,
+                                                 size_t tune_idx) const
+  { return variant_tuning_problem_names[vid].at(tune_idx); }
+
+  template < typename T >
+  bool isPrecisionTuning(VariantID vid, size_t tune_idx) const
+  { return getVariantTuningName(vid, tune_idx) == getPrecisionTuningName<T>(); }
+
+  template < typename Loop_T, typename List_T >
+  bool isIndexTuning(VariantID vid, size_t tune_idx) const
+  { return getVariantTuningName(vid, tune_idx) == getIndexTuningName<Loop_T, List_T>(); }
 
   //
   // Methods to get information about kernel execution for reports
@@ -181,9 +248,17 @@ public:
   { return max_time[vid].at(tune_idx); }
   double getTotTime(VariantID vid, size_t tune_idx) const
   { return tot_time[vid].at(tune_idx); }
+  double getMedianTime(VariantID vid, size_t tune_idx) const;
 
   Checksum_type getChecksum(VariantID vid, size_t tune_idx) const
   { return checksum[vid].at(tune_idx); }
+  Checksum_type getChecksumTolerance(VariantID vid, size_t tune_idx) const
+  { return checksum_tolerance[vid].at(tune_idx); }
+
+  // checksum of the first variant tuning in variant_ids that was run and
+  // that ran the same problem as the given variant tuning
+  Checksum_type getReferenceChecksum(const std::vector<VariantID>& variant_ids,
+                                     VariantID vid, size_t tune_idx) const;
 
   void execute(VariantID vid, size_t tune_idx);
 
@@ -259,6 +334,13 @@ public:
         ptr, len, getDataAlignment());
   }
 
+  template <typename T>
+  void allocAndInitDataSelectivity(T*& ptr, int len, VariantID vid)
+  {
+    rajaperf::allocAndInitDataRandSign(getDataSpace(vid),
+        ptr, len, getDataAlignment(), run_params.getSelectivity());
+  }
+
   template <typename T>
   void allocAndInitDataRandValue(T*& ptr, int len, VariantID vid)
   {
@@ -266,6 +348,13 @@ public:
         ptr, len, getDataAlignment());
   }
 
+  template <typename T>
+  void allocAndInitDataSortInput(T*& ptr, int len, VariantID vid)
+  {
+    rajaperf::allocAndInitDataSortInput(getDataSpace(vid),
+        ptr, len, getDataAlignment(), run_params.getSortInput());
+  }
+
   template <typename T>
   rajaperf::AutoDataMover<T> scopedMoveData(T*& ptr, int len, VariantID vid)
   {
@@ -301,6 +390,25 @@ public:
       ptr, len, getDataAlignment(), scale_factor);
   }
 
+  //
+  // Widen the checksum tolerance of a variant tuning that computes its
+  // results in floating point type T, relative to the checksum magnitude.
+  // Kernels that accumulate into their results on every rep pass the
+  // number of reps, as the rounding error grows with it.
+  //
+  template <typename T>
+  void setChecksumTolerance(VariantID vid, size_t tune_idx,
+                            Index_type num_accumulations = 1)
+  {
+    const Checksum_type rel_tol =
+        16 * num_accumulations *
+        std::max<Checksum_type>(std::numeric_limits<T>::epsilon(),
+                                std::numeric_limits<Real_type>::epsilon());
+    checksum_tolerance[vid].at(tune_idx) =
+        std::max(getDefaultChecksumTolerance(),
+                 rel_tol * std::abs(checksum[vid].at(tune_idx)));
+  }
+
   void startTimer()
   {
     synchronize();
@@ -363,6 +471,7 @@ protected:
   const RunParams& run_params;
 
   std::vector<Checksum_type> checksum[NumVariants];
+  std::vector<Checksum_type> checksum_tolerance[NumVariants];
   Checksum_type checksum_scale_factor;
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
@@ -388,6 +497,7 @@ private:
   bool uses_feature[NumFeatures];
 
   std::vector<std::string> variant_tuning_names[NumVariants];
+  std::vector<std::string> variant_tuning_problem_names[NumVariants];
 
   //
   // Properties of kernel dependent on how kernel is run
@@ -397,6 +507,12 @@ private:
   Index_type bytes_per_rep;
   Index_type FLOPs_per_rep;
 
+  std::vector<std::string> problem_tuning_names;
+  std::map<std::string, Index_type> tuning_prob_size;
+  std::map<std::string, Index_type> tuning_its_per_rep;
+  std::map<std::string, Index_type> tuning_bytes_per_rep;
+  std::map<std::string, Index_type> tuning_FLOPs_per_rep;
+
   VariantID running_variant;
   size_t running_tuning;
 
@@ -407,6 +523,9 @@ private:
   std::vector<RAJA::Timer::ElapsedType> min_time[NumVariants];
   std::vector<RAJA::Timer::ElapsedType> max_time[NumVariants];
   std::vector<RAJA::Timer::ElapsedType> tot_time[NumVariants];
+
+  // time of each execution, kept for order statistics such as the median
+  std::vector<std::vector<RAJA::Timer::ElapsedType>> exec_times[NumVariants];
 };
 
 }  // closing brace for rajaperf namespace
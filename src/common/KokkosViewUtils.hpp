@@ -15,8 +15,11 @@
 
 #include "Kokkos_Core.hpp"
 
+#include "common/RAJAPerfSuite.hpp"
+
 #include <ostream>
 #include <string>
+#include <type_traits>
 
 namespace rajaperf {
 template <class PointedAt, size_t NumBoundaries> struct PointerOfNdimensions;
@@ -30,9 +33,48 @@ template <class PointedAt, size_t NumBoundaries> struct PointerOfNdimensions {
       typename PointerOfNdimensions<PointedAt, NumBoundaries - 1>::type *;
 };
 
+// True when the Kokkos default execution space can dereference pointers
+// allocated in a host DataSpace, i.e., when Suite data can be used in place
+//
+constexpr bool kokkosDefaultSpaceAccessesHost =
+    Kokkos::SpaceAccessibility<Kokkos::DefaultExecutionSpace,
+                               Kokkos::HostSpace>::accessible;
+
+// True when a Kokkos View of the given type can alias a row-major
+// (C-ordered) RAJAPerf Suite array without changing how it is indexed
+//
+template <class ViewType>
+constexpr bool kokkosViewCanAliasPointer()
+{
+  return kokkosDefaultSpaceAccessesHost &&
+         ( ViewType::rank <= 1 ||
+           std::is_same<typename ViewType::array_layout,
+                        Kokkos::LayoutRight>::value );
+}
+
+// Return the Suite DataSpace that corresponds to the memory space of the
+// Kokkos default execution space. Data for Kokkos variants is allocated and
+// initialized in this space so that getViewFromPointer can alias it.
+//
+inline DataSpace getKokkosDefaultDataSpace()
+{
+#if defined(KOKKOS_ENABLE_OPENMP)
+  if (std::is_same<Kokkos::DefaultExecutionSpace, Kokkos::OpenMP>::value &&
+      isDataSpaceAvailable(DataSpace::Omp)) {
+    return DataSpace::Omp;
+  }
+#endif
+  return DataSpace::Host;
+}
+
 // This templated function is used to wrap pointers
 // (declared and defined in RAJAPerf Suite kernels) in Kokkos Views
 //
+// When the default execution space can access the Suite allocation,
+// the returned View is unmanaged and aliases the pointer (no allocation or
+// copy). Otherwise, a View is allocated in the default memory space and the
+// data are copied into it.
+//
 template <class PointedAt, class... Boundaries>
 auto getViewFromPointer(PointedAt *kokkos_ptr, Boundaries... boundaries) ->
      Kokkos::View<
@@ -51,30 +93,47 @@ auto getViewFromPointer(PointedAt *kokkos_ptr, Boundaries... boundaries) ->
 
   using mirror_view_type = typename device_view_type::HostMirror;
 
-  host_view_type pointer_holder(kokkos_ptr, boundaries...);
+  if constexpr (kokkosViewCanAliasPointer<device_view_type>()) {
+
+    // Constructing a View from a pointer does not allocate;
+    // the View does not own (or free) the Suite data
+    return device_view_type(kokkos_ptr, boundaries...);
 
-  // The boundaries parameter pack contains the array dimenions;
-  // An allocation is implicitly made here
-  device_view_type device_data_copy("StringName", boundaries...);
+  } else {
 
-  mirror_view_type cpu_to_gpu_mirror =
-      Kokkos::create_mirror_view(device_data_copy);
+    host_view_type pointer_holder(kokkos_ptr, boundaries...);
 
-  Kokkos::deep_copy(cpu_to_gpu_mirror, pointer_holder);
+    // The boundaries parameter pack contains the array dimenions;
+    // An allocation is implicitly made here
+    device_view_type device_data_copy("StringName", boundaries...);
 
-  Kokkos::deep_copy(device_data_copy, cpu_to_gpu_mirror);
+    mirror_view_type cpu_to_gpu_mirror =
+        Kokkos::create_mirror_view(device_data_copy);
 
-  // Kokkos::View return type
+    Kokkos::deep_copy(cpu_to_gpu_mirror, pointer_holder);
 
-  return device_data_copy;
+    Kokkos::deep_copy(device_data_copy, cpu_to_gpu_mirror);
+
+    // Kokkos::View return type
+
+    return device_data_copy;
+  }
 }
 
 // This function will move data in a Kokkos::View back to host from device,
 // and will be stored in the existing pointer(s)
+//
+// If the View aliases the pointer (see getViewFromPointer), the data are
+// already in place and only outstanding work must be completed.
 template <class PointedAt, class ExistingView, class... Boundaries>
 void moveDataToHostFromKokkosView(PointedAt *kokkos_ptr, ExistingView my_view,
                                   Boundaries... boundaries) {
 
+  if (my_view.data() == kokkos_ptr) {
+    Kokkos::fence();
+    return;
+  }
+
   using host_view_type = typename Kokkos::View<
       typename PointerOfNdimensions<PointedAt, sizeof...(Boundaries)>::type,
       typename Kokkos::DefaultHostExecutionSpace::memory_space>;
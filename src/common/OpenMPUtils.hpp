@@ -0,0 +1,63 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods and constants for OpenMP tasking kernel tunings.
+///
+/// Kernels that define "taskloop_<grainsize>" and "taskgraph" tunings for
+/// their Base_OpenMP variant use the values here so the task granularity
+/// is consistent across kernels. Grainsizes are expressed in iterations of
+/// the loop body; kernels with loop nests convert them to outer iterations
+/// with outer_grainsize().
+///
+/// taskloop and the task depend clause are used together, so the tunings
+/// are only defined when OpenMP 4.5 or newer is available.
+///
+
+#ifndef RAJAPerf_OpenMPUtils_HPP
+#define RAJAPerf_OpenMPUtils_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <algorithm>
+#include <string>
+
+#if defined(_OPENMP) && _OPENMP >= 201511
+#define RAJAPERF_OPENMP_TASKLOOP_TUNINGS
+#endif
+
+namespace rajaperf
+{
+
+namespace omp_task
+{
+
+// grainsizes used to generate the taskloop tunings
+constexpr Index_type taskloop_grainsizes[] = { 512, 2048, 8192 };
+
+// loop iterations per task in the dependency-driven task graph tunings
+constexpr Index_type taskgraph_task_size = 2048;
+
+// tuning name for the taskloop tuning using grainsize
+inline std::string taskloop_tuning_name(Index_type grainsize)
+{
+  return "taskloop_" + std::to_string(grainsize);
+}
+
+// number of outer loop iterations that amount to about num_its iterations
+// of a loop nest whose inner loop has inner_len iterations
+inline Index_type outer_grainsize(Index_type num_its, Index_type inner_len)
+{
+  return std::max(num_its / std::max(inner_len, Index_type(1)), Index_type(1));
+}
+
+} // closing brace for omp_task namespace
+
+} // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -19,6 +19,7 @@
 //
 #include "basic/DAXPY.hpp"
 #include "basic/DAXPY_ATOMIC.hpp"
+#include "basic/HISTOGRAM.hpp"
 #include "basic/IF_QUAD.hpp"
 #include "basic/INDEXLIST.hpp"
 #include "basic/INDEXLIST_3LOOP.hpp"
@@ -80,13 +81,18 @@
 //
 #include "apps/CONVECTION3DPA.hpp"
 #include "apps/DEL_DOT_VEC_2D.hpp"
+#include "apps/DIFFUSION2DPA.hpp"
 #include "apps/DIFFUSION3DPA.hpp"
 #include "apps/ENERGY.hpp"
 #include "apps/FIR.hpp"
 #include "apps/HALOEXCHANGE.hpp"
 #include "apps/HALOEXCHANGE_FUSED.hpp"
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+#include "apps/HALOEXCHANGE_MPI.hpp"
+#endif
 #include "apps/LTIMES.hpp"
 #include "apps/LTIMES_NOVIEW.hpp"
+#include "apps/MASS2DPA.hpp"
 #include "apps/MASS3DPA.hpp"
 #include "apps/NODAL_ACCUMULATION_3D.hpp"
 #include "apps/PRESSURE.hpp"
@@ -96,9 +102,16 @@
 // Algorithm kernels...
 //
 #include "algorithm/SCAN.hpp"
+#include "algorithm/SCAN_INCLUSIVE.hpp"
+#include "algorithm/SCAN_INT.hpp"
+#include "algorithm/SEGMENTED_SCAN.hpp"
 #include "algorithm/SORT.hpp"
 #include "algorithm/SORTPAIRS.hpp"
+#include "algorithm/TOPK.hpp"
+#include "algorithm/NTH_ELEMENT.hpp"
 #include "algorithm/REDUCE_SUM.hpp"
+#include "algorithm/REDUCE_BY_KEY.hpp"
+#include "algorithm/HASH_BUILD_PROBE.hpp"
 #include "algorithm/MEMSET.hpp"
 #include "algorithm/MEMCPY.hpp"
 
@@ -154,6 +167,7 @@ static const std::string KernelNames [] =
 //
   std::string("Basic_DAXPY"),
   std::string("Basic_DAXPY_ATOMIC"),
+  std::string("Basic_HISTOGRAM"),
   std::string("Basic_IF_QUAD"),
   std::string("Basic_INDEXLIST"),
   std::string("Basic_INDEXLIST_3LOOP"),
@@ -215,13 +229,18 @@ static const std::string KernelNames [] =
 //
   std::string("Apps_CONVECTION3DPA"),
   std::string("Apps_DEL_DOT_VEC_2D"),
+  std::string("Apps_DIFFUSION2DPA"),
   std::string("Apps_DIFFUSION3DPA"),
   std::string("Apps_ENERGY"),
   std::string("Apps_FIR"),
   std::string("Apps_HALOEXCHANGE"),
   std::string("Apps_HALOEXCHANGE_FUSED"),
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  std::string("Apps_HALOEXCHANGE_MPI"),
+#endif
   std::string("Apps_LTIMES"),
   std::string("Apps_LTIMES_NOVIEW"),
+  std::string("Apps_MASS2DPA"),
   std::string("Apps_MASS3DPA"),
   std::string("Apps_NODAL_ACCUMULATION_3D"),
   std::string("Apps_PRESSURE"),
@@ -231,9 +250,16 @@ static const std::string KernelNames [] =
 // Algorithm kernels...
 //
   std::string("Algorithm_SCAN"),
+  std::string("Algorithm_SCAN_INCLUSIVE"),
+  std::string("Algorithm_SCAN_INT"),
+  std::string("Algorithm_SEGMENTED_SCAN"),
   std::string("Algorithm_SORT"),
   std::string("Algorithm_SORTPAIRS"),
+  std::string("Algorithm_TOPK"),
+  std::string("Algorithm_NTH_ELEMENT"),
   std::string("Algorithm_REDUCE_SUM"),
+  std::string("Algorithm_REDUCE_BY_KEY"),
+  std::string("Algorithm_HASH_BUILD_PROBE"),
   std::string("Algorithm_MEMSET"),
   std::string("Algorithm_MEMCPY"),
 
@@ -356,6 +382,54 @@ static const std::string DataSpaceNames [] =
 }; // END VariantNames
 
 
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each sort input distribution in suite.
+ *
+ * IMPORTANT: This is only modified when a new input distribution is added.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ENUM OF SORT INPUT IDS IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string SortInputNames [] =
+{
+  std::string("uniform"),
+  std::string("sorted"),
+  std::string("reverse"),
+  std::string("nearly"),
+  std::string("fewunique"),
+  std::string("zipf"),
+
+  std::string("Unknown Input")  // Keep this at the end and DO NOT remove....
+
+}; // END SortInputNames
+
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each segment length distribution in suite.
+ *
+ * IMPORTANT: This is only modified when a new length distribution is added.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ENUM OF SEGMENT LENGTHS IDS IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string SegmentLengthsNames [] =
+{
+  std::string("uniform"),
+  std::string("powerlaw"),
+
+  std::string("Unknown Lengths")  // Keep this at the end and DO NOT remove....
+
+}; // END SegmentLengthsNames
+
+
 /*
  *******************************************************************************
  *
@@ -557,6 +631,31 @@ const std::string& getDataSpaceName(DataSpace ds)
   return DataSpaceNames[static_cast<int>(ds)];
 }
 
+/*!
+ *******************************************************************************
+ *
+ * Return name of input distribution associated with SortInput enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getSortInputName(SortInput si)
+{
+  return SortInputNames[static_cast<int>(si)];
+}
+
+/*!
+ *******************************************************************************
+ *
+ * Return name of segment length distribution associated with SegmentLengths
+ * enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getSegmentLengthsName(SegmentLengths sl)
+{
+  return SegmentLengthsNames[static_cast<int>(sl)];
+}
+
 /*!
  *******************************************************************************
  *
@@ -640,6 +739,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new basic::DAXPY_ATOMIC(run_params);
        break;
     }
+    case Basic_HISTOGRAM : {
+       kernel = new basic::HISTOGRAM(run_params);
+       break;
+    }
     case Basic_IF_QUAD : {
        kernel = new basic::IF_QUAD(run_params);
        break;
@@ -837,6 +940,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new apps::DEL_DOT_VEC_2D(run_params);
        break;
     }
+    case Apps_DIFFUSION2DPA : {
+       kernel = new apps::DIFFUSION2DPA(run_params);
+       break;
+    }
     case Apps_DIFFUSION3DPA : {
        kernel = new apps::DIFFUSION3DPA(run_params);
        break;
@@ -857,6 +964,12 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new apps::HALOEXCHANGE_FUSED(run_params);
        break;
     }
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+    case Apps_HALOEXCHANGE_MPI : {
+       kernel = new apps::HALOEXCHANGE_MPI(run_params);
+       break;
+    }
+#endif
     case Apps_LTIMES : {
        kernel = new apps::LTIMES(run_params);
        break;
@@ -865,6 +978,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new apps::LTIMES_NOVIEW(run_params);
        break;
     }
+    case Apps_MASS2DPA : {
+       kernel = new apps::MASS2DPA(run_params);
+       break;
+    }
     case Apps_MASS3DPA : {
        kernel = new apps::MASS3DPA(run_params);
        break;
@@ -889,6 +1006,18 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new algorithm::SCAN(run_params);
        break;
     }
+    case Algorithm_SCAN_INCLUSIVE: {
+       kernel = new algorithm::SCAN_INCLUSIVE(run_params);
+       break;
+    }
+    case Algorithm_SCAN_INT: {
+       kernel = new algorithm::SCAN_INT(run_params);
+       break;
+    }
+    case Algorithm_SEGMENTED_SCAN: {
+       kernel = new algorithm::SEGMENTED_SCAN(run_params);
+       break;
+    }
     case Algorithm_SORT: {
        kernel = new algorithm::SORT(run_params);
        break;
@@ -897,10 +1026,26 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new algorithm::SORTPAIRS(run_params);
        break;
     }
+    case Algorithm_TOPK: {
+       kernel = new algorithm::TOPK(run_params);
+       break;
+    }
+    case Algorithm_NTH_ELEMENT: {
+       kernel = new algorithm::NTH_ELEMENT(run_params);
+       break;
+    }
     case Algorithm_REDUCE_SUM: {
        kernel = new algorithm::REDUCE_SUM(run_params);
        break;
     }
+    case Algorithm_REDUCE_BY_KEY: {
+       kernel = new algorithm::REDUCE_BY_KEY(run_params);
+       break;
+    }
+    case Algorithm_HASH_BUILD_PROBE: {
+       kernel = new algorithm::HASH_BUILD_PROBE(run_params);
+       break;
+    }
     case Algorithm_MEMSET: {
        kernel = new algorithm::MEMSET(run_params);
        break;
@@ -72,6 +72,7 @@ enum KernelID {
 //
   Basic_DAXPY = 0,
   Basic_DAXPY_ATOMIC,
+  Basic_HISTOGRAM,
   Basic_IF_QUAD,
   Basic_INDEXLIST,
   Basic_INDEXLIST_3LOOP,
@@ -133,13 +134,18 @@ enum KernelID {
 //
   Apps_CONVECTION3DPA,
   Apps_DEL_DOT_VEC_2D,
+  Apps_DIFFUSION2DPA,
   Apps_DIFFUSION3DPA,
   Apps_ENERGY,
   Apps_FIR,
   Apps_HALOEXCHANGE,
   Apps_HALOEXCHANGE_FUSED,
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  Apps_HALOEXCHANGE_MPI,
+#endif
   Apps_LTIMES,
   Apps_LTIMES_NOVIEW,
+  Apps_MASS2DPA,
   Apps_MASS3DPA,
   Apps_NODAL_ACCUMULATION_3D,
   Apps_PRESSURE,
@@ -149,9 +155,16 @@ enum KernelID {
 // Algorithm kernels...
 //
   Algorithm_SCAN,
+  Algorithm_SCAN_INCLUSIVE,
+  Algorithm_SCAN_INT,
+  Algorithm_SEGMENTED_SCAN,
   Algorithm_SORT,
   Algorithm_SORTPAIRS,
+  Algorithm_TOPK,
+  Algorithm_NTH_ELEMENT,
   Algorithm_REDUCE_SUM,
+  Algorithm_REDUCE_BY_KEY,
+  Algorithm_HASH_BUILD_PROBE,
   Algorithm_MEMSET,
   Algorithm_MEMCPY,
 
@@ -273,6 +286,56 @@ enum struct DataSpace {
 };
 
 
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration defining unique id for each distribution of input
+ * values used by sort and scan kernels.
+ *
+ * IMPORTANT: This is only modified when a new input distribution is added.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ARRAY OF SORT INPUT NAMES IN IMPLEMENTATION FILE!!!
+ *
+ *******************************************************************************
+ */
+enum struct SortInput {
+
+  Uniform = 0,
+  Sorted,
+  Reverse,
+  Nearly,
+  FewUnique,
+  Zipf,
+
+  NumInputs // Keep this one last and NEVER comment out (!!)
+
+};
+
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration defining unique id for each distribution of segment
+ * lengths used by segmented kernels.
+ *
+ * IMPORTANT: This is only modified when a new length distribution is added.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ARRAY OF SEGMENT LENGTHS NAMES IN IMPLEMENTATION FILE!!!
+ *
+ *******************************************************************************
+ */
+enum struct SegmentLengths {
+
+  Uniform = 0,
+  PowerLaw,
+
+  NumLengths // Keep this one last and NEVER comment out (!!)
+
+};
+
+
 /*!
  *******************************************************************************
  *
@@ -351,6 +414,26 @@ const std::string& getFeatureName(FeatureID vid);
  */
 const std::string& getDataSpaceName(DataSpace cd);
 
+/*!
+ *******************************************************************************
+ *
+ * \brief Return name of input distribution associated with SortInput enum
+ * value.
+ *
+ *******************************************************************************
+ */
+const std::string& getSortInputName(SortInput si);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Return name of segment length distribution associated with
+ * SegmentLengths enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getSegmentLengthsName(SegmentLengths sl);
+
 /*!
  *******************************************************************************
  *
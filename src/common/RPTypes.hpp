@@ -95,10 +95,14 @@ using Checksum_type = long double;
 #if defined(RP_USE_DOUBLE)
 ///
 using Real_type = double;
+///
+#define Real_MPI_type MPI_DOUBLE
 
 #elif defined(RP_USE_FLOAT)
 ///
 using Real_type = float;
+///
+#define Real_MPI_type MPI_FLOAT
 
 #else
 #error Real_type is undefined!
@@ -107,6 +111,29 @@ using Real_type = float;
 
 using Real_ptr = Real_type*;
 
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Floating point type used by the alternate precision tunings.
+ *
+ * This is the precision Real_type does not use (float when Real_type is
+ * double), so both precisions can be run and reported side by side.
+ *
+ ******************************************************************************
+ */
+#if defined(RP_USE_DOUBLE)
+///
+using AltReal_type = float;
+
+#elif defined(RP_USE_FLOAT)
+///
+using AltReal_type = double;
+
+#endif
+
+using AltReal_ptr = AltReal_type*;
+
 #if defined(RP_USE_COMPLEX)
 ///
 using Complex_type = std::complex<Real_type>;
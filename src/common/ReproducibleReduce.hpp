@@ -0,0 +1,302 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// OpenMP sum reductions whose results are bitwise identical for any number
+/// of threads, used by the Base_OpenMP tunings of the REDUCE_SUM and
+/// PI_REDUCE kernels.
+///
+/// Each algorithm returns the sum of val(i) for i in [ibegin, iend).
+///
+///   tree   - values are summed in fixed size blocks, then the block sums
+///            are added in a fixed pairwise tree
+///   kahan  - as tree, but blocks are summed with Neumaier compensation and
+///            block results are combined in block order
+///   binned - values are converted to double and added exactly into integer
+///            bins covering the whole double range; the exact total is
+///            rounded to a double once at the end
+///
+/// Run with "--refvar Base_OpenMP" to see the cost of each tuning relative
+/// to the default reduction in the speedup report.
+///
+
+#ifndef RAJAPerf_ReproducibleReduce_HPP
+#define RAJAPerf_ReproducibleReduce_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+
+namespace repro_reduce
+{
+
+enum Algorithm {
+  Tree = 0,
+  Kahan,
+  Binned,
+
+  NumAlgorithms // Keep this one last and NEVER comment out (!!)
+};
+
+// tuning name for the given algorithm
+inline std::string getAlgorithmName(Algorithm alg)
+{
+  switch (alg) {
+    case Tree:   return "tree";
+    case Kahan:  return "kahan";
+    case Binned: return "binned";
+    default:     return "unknown";
+  }
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+// values summed sequentially in each block of the tree and kahan sums;
+// fixed so the order of additions does not depend on the thread count
+constexpr Index_type block_size = 4096;
+
+template < typename Func >
+inline Real_type tree_sum(Index_type ibegin, Index_type iend, Func val)
+{
+  const Index_type nblocks = (iend - ibegin + block_size - 1) / block_size;
+  std::vector<Real_type> block_sums(nblocks);
+
+  #pragma omp parallel for
+  for (Index_type b = 0; b < nblocks; ++b) {
+    const Index_type bbegin = ibegin + b*block_size;
+    const Index_type bend = std::min(bbegin + block_size, iend);
+    Real_type sum = 0.0;
+    for (Index_type i = bbegin; i < bend; ++i) {
+      sum += val(i);
+    }
+    block_sums[b] = sum;
+  }
+
+  for (Index_type width = 1; width < nblocks; width *= 2) {
+    for (Index_type b = 0; b + width < nblocks; b += 2*width) {
+      block_sums[b] += block_sums[b + width];
+    }
+  }
+
+  return (nblocks > 0) ? block_sums[0] : 0.0;
+}
+
+//
+// Neumaier's variant of Kahan summation; comp accumulates the low order
+// bits lost when adding val to sum.
+//
+inline void neumaier_add(Real_type& sum, Real_type& comp, Real_type val)
+{
+  const Real_type t = sum + val;
+  if (std::abs(sum) >= std::abs(val)) {
+    comp += (sum - t) + val;
+  } else {
+    comp += (val - t) + sum;
+  }
+  sum = t;
+}
+
+template < typename Func >
+inline Real_type kahan_sum(Index_type ibegin, Index_type iend, Func val)
+{
+  const Index_type nblocks = (iend - ibegin + block_size - 1) / block_size;
+  std::vector<Real_type> block_sums(nblocks);
+  std::vector<Real_type> block_comps(nblocks);
+
+  #pragma omp parallel for
+  for (Index_type b = 0; b < nblocks; ++b) {
+    const Index_type bbegin = ibegin + b*block_size;
+    const Index_type bend = std::min(bbegin + block_size, iend);
+    Real_type sum = 0.0;
+    Real_type comp = 0.0;
+    for (Index_type i = bbegin; i < bend; ++i) {
+      neumaier_add(sum, comp, val(i));
+    }
+    block_sums[b] = sum;
+    block_comps[b] = comp;
+  }
+
+  Real_type sum = 0.0;
+  Real_type comp = 0.0;
+  for (Index_type b = 0; b < nblocks; ++b) {
+    neumaier_add(sum, comp, block_sums[b]);
+    comp += block_comps[b];
+  }
+
+  return sum + comp;
+}
+
+//
+// Bin k holds a multiple of 2^(32*k - 1074), the value of the lowest
+// subnormal bit; bins above the top double exponent take carries.
+//
+constexpr int bin_bits = 32;
+constexpr int num_bins = 68;
+constexpr std::int64_t bin_mask = (std::int64_t(1) << bin_bits) - 1;
+
+// adds per bin before carries must be propagated to avoid overflow
+constexpr Index_type bin_carry_interval = Index_type(1) << 20;
+
+// val is a double whatever Real_type is, so its bits are read exactly
+inline void bin_add(std::int64_t* bins, double val)
+{
+  std::uint64_t bits;
+  std::memcpy(&bits, &val, sizeof(bits));
+
+  const int biased_exp = static_cast<int>((bits >> 52) & 0x7FF);
+  if (biased_exp == 0x7FF) {
+    return; // non-finite values are not binned
+  }
+
+  const std::uint64_t frac = bits & ((std::uint64_t(1) << 52) - 1);
+  const std::uint64_t mant = biased_exp ? (frac | (std::uint64_t(1) << 52)) : frac;
+  const int pos = biased_exp ? biased_exp - 1 : 0;
+  const int k = pos / bin_bits;
+  const int r = pos % bin_bits;
+
+  const std::int64_t c0 = static_cast<std::int64_t>((mant << r) & bin_mask);
+  const std::int64_t c1 = static_cast<std::int64_t>((mant >> (bin_bits - r)) & bin_mask);
+  const std::int64_t c2 = r ? static_cast<std::int64_t>(mant >> (2*bin_bits - r)) : 0;
+
+  if (bits >> 63) {
+    bins[k] -= c0; bins[k+1] -= c1; bins[k+2] -= c2;
+  } else {
+    bins[k] += c0; bins[k+1] += c1; bins[k+2] += c2;
+  }
+}
+
+// leave every bin but the top one in [0, 2^bin_bits)
+inline void bin_carry(std::int64_t* bins)
+{
+  for (int k = 0; k < num_bins-1; ++k) {
+    const std::int64_t low = static_cast<std::int64_t>(
+        static_cast<std::uint64_t>(bins[k]) & bin_mask);
+    bins[k+1] += (bins[k] - low) / (std::int64_t(1) << bin_bits);
+    bins[k] = low;
+  }
+}
+
+//
+// Round the non-negative total held in carried bins to the nearest double.
+// The top 64 bits of the total are gathered into one integer, with any
+// lower nonzero bits folded into its last bit so the single conversion to
+// double rounds as if it saw them all; the scaling after it is exact.
+//
+inline double bins_to_double(const std::int64_t* bins)
+{
+  int t = num_bins-1;
+  while (t >= 0 && bins[t] == 0) {
+    --t;
+  }
+  if (t < 0) {
+    return 0.0;
+  }
+  if (t == num_bins-1) {
+    return std::numeric_limits<double>::infinity();
+  }
+  if (t < 2) {
+    // below 2^64 units, converted directly; the result is either exact
+    // (subnormal) or a normal double, so the scaling does not round
+    const std::uint64_t m = (t == 1 ? static_cast<std::uint64_t>(bins[1]) << bin_bits : 0) |
+                            static_cast<std::uint64_t>(bins[0]);
+    return std::ldexp(static_cast<double>(m), -1074);
+  }
+
+  const std::uint64_t hi = static_cast<std::uint64_t>(bins[t]);
+  const std::uint64_t mid = static_cast<std::uint64_t>(bins[t-1]);
+  const std::uint64_t lo = static_cast<std::uint64_t>(bins[t-2]);
+
+  // bits in the top bin, which are dropped from the bottom bin
+  int nb = 0;
+  for (std::uint64_t h = hi; h != 0; h >>= 1) {
+    ++nb;
+  }
+
+  std::uint64_t m = (hi << (64 - nb)) | (mid << (bin_bits - nb)) | (lo >> nb);
+  bool sticky = (lo & ((std::uint64_t(1) << nb) - 1)) != 0;
+  for (int k = 0; k < t-2 && !sticky; ++k) {
+    sticky = bins[k] != 0;
+  }
+  if (sticky) {
+    m |= 1;
+  }
+
+  return std::ldexp(static_cast<double>(m), bin_bits*(t-2) + nb - 1074);
+}
+
+template < typename Func >
+inline Real_type binned_sum(Index_type ibegin, Index_type iend, Func val)
+{
+  std::int64_t bins[num_bins] = {};
+
+  #pragma omp parallel
+  {
+    std::int64_t local_bins[num_bins] = {};
+    Index_type count = 0;
+
+    #pragma omp for nowait
+    for (Index_type i = ibegin; i < iend; ++i) {
+      bin_add(local_bins, static_cast<double>(val(i)));
+      if (++count == bin_carry_interval) {
+        bin_carry(local_bins);
+        count = 0;
+      }
+    }
+    bin_carry(local_bins);
+
+    // integer addition is exact, so the merge order does not matter
+    #pragma omp critical
+    {
+      for (int k = 0; k < num_bins; ++k) {
+        bins[k] += local_bins[k];
+      }
+    }
+  }
+
+  bin_carry(bins);
+
+  // a negative total leaves the top bin negative; round its magnitude
+  const bool negative = bins[num_bins-1] < 0;
+  if (negative) {
+    for (int k = 0; k < num_bins; ++k) {
+      bins[k] = -bins[k];
+    }
+    bin_carry(bins);
+  }
+
+  const double sum = bins_to_double(bins);
+  return static_cast<Real_type>(negative ? -sum : sum);
+}
+
+template < typename Func >
+inline Real_type sum(Algorithm alg, Index_type ibegin, Index_type iend, Func val)
+{
+  switch (alg) {
+    case Tree:   return tree_sum(ibegin, iend, val);
+    case Kahan:  return kahan_sum(ibegin, iend, val);
+    case Binned: return binned_sum(ibegin, iend, val);
+    default:     return 0.0;
+  }
+}
+
+#endif
+
+} // closing brace for repro_reduce namespace
+
+} // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -10,6 +10,10 @@
 
 #include "KernelBase.hpp"
 
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+#endif
+
 #include <cstdlib>
 #include <cstdio>
 #include <iostream>
@@ -55,8 +59,14 @@ RunParams::RunParams(int argc, char** argv)
    invalid_npasses_combiner_input(),
    outdir(),
    outfile_prefix("RAJAPerf"),
-   disable_warmup(false)
+   disable_warmup(false),
+   autotune(false),
+   tunings_from_file()
 {
+#if defined(RUN_KOKKOS)
+  kokkosDataSpace = getKokkosDefaultDataSpace();
+#endif
+
   parseCommandLineOptions(argc, argv);
 }
 
@@ -113,6 +123,9 @@ void RunParams::print(std::ostream& str) const
 
   str << "\n disable_warmup = " << disable_warmup;
 
+  str << "\n autotune = " << autotune;
+  str << "\n tunings_from_file = " << tunings_from_file;
+
   str << "\n seq data space = " << getDataSpaceName(seqDataSpace);
   str << "\n omp data space = " << getDataSpaceName(ompDataSpace);
   str << "\n omp target data space = " << getDataSpaceName(ompTargetDataSpace);
@@ -120,6 +133,18 @@ void RunParams::print(std::ostream& str) const
   str << "\n hip data space = " << getDataSpaceName(hipDataSpace);
   str << "\n kokkos data space = " << getDataSpaceName(kokkosDataSpace);
 
+  str << "\n sort input = " << getSortInputName(sortInput);
+  str << "\n segment lengths = " << getSegmentLengthsName(segmentLengths);
+  str << "\n selectivity = " << selectivity;
+  str << "\n k_fraction = " << k_fraction;
+  str << "\n histogram_bins = " << histogram_bins;
+  str << "\n histogram_skew = " << histogram_skew;
+  str << "\n hash_load_factor = " << hash_load_factor;
+  str << "\n hash_hit_ratio = " << hash_hit_ratio;
+  str << "\n ltimes_num_d = " << ltimes_num_d;
+  str << "\n ltimes_num_g = " << ltimes_num_g;
+  str << "\n ltimes_num_m = " << ltimes_num_m;
+
   str << "\n kernel_input = ";
   for (size_t j = 0; j < kernel_input.size(); ++j) {
     str << "\n\t" << kernel_input[j];
@@ -190,6 +215,8 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
 {
   getCout() << "\n\nReading command line input..." << std::endl;
 
+  bool got_npasses = false;
+
   for (int i = 1; i < argc; ++i) {
 
     std::string opt(argv[i]);
@@ -246,6 +273,7 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
       i++;
       if ( i < argc ) {
         npasses = ::atoi( argv[i] );
+        got_npasses = true;
       } else {
         getCout() << "\nBad input:"
                   << " must give --npasses a value for number of passes (int)"
@@ -484,6 +512,7 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
 
       bool got_someting = false;
       bool got_something_available = false;
+      bool got_something_host_accessible = true;
       i++;
       if ( i < argc ) {
         auto opt_name = std::move(opt);
@@ -514,6 +543,11 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
               } else if ( opt_name == std::string("--kokkos-data-space") ||
                           opt_name == std::string("-kds") ) {
                 kokkosDataSpace = ds;
+                // Kokkos views are made from host accessible Suite data
+                if ( got_something_available ) {
+                  got_something_host_accessible =
+                      hostAccessibleDataSpace(ds) == ds;
+                }
               } else {
                 got_someting = false;
               }
@@ -531,9 +565,220 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
                       << " must give " << opt_name << " a data space this is available in this config"
                       << std::endl;
             input_state = BadInput;
+          } else if (!got_something_host_accessible) {
+            getCout() << "\nBad input:"
+                      << " " << opt_name << " requires a host accessible data space"
+                      << std::endl;
+            input_state = BadInput;
+          }
+        }
+      }
+
+    } else if ( opt == std::string("--sort-input") ) {
+
+      bool got_someting = false;
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        for (int isi = 0; isi < static_cast<int>(SortInput::NumInputs); ++isi) {
+          SortInput si = static_cast<SortInput>(isi);
+          if (getSortInputName(si) == opt) {
+            got_someting = true;
+            sortInput = si;
+            break;
           }
         }
       }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --sort-input one of the following values:";
+        printSortInputNames(getCout());
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--segment-lengths") ) {
+
+      bool got_someting = false;
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        for (int isl = 0; isl < static_cast<int>(SegmentLengths::NumLengths); ++isl) {
+          SegmentLengths sl = static_cast<SegmentLengths>(isl);
+          if (getSegmentLengthsName(sl) == opt) {
+            got_someting = true;
+            segmentLengths = sl;
+            break;
+          }
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --segment-lengths one of the following values:";
+        printSegmentLengthsNames(getCout());
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--selectivity") ) {
+
+      i++;
+      if ( i < argc ) {
+        selectivity = ::atof( argv[i] );
+        if ( selectivity < 0.0 || selectivity > 1.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --selectivity a value in [0.0, 1.0]"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --selectivity a value (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--k-fraction") ) {
+
+      i++;
+      if ( i < argc ) {
+        k_fraction = ::atof( argv[i] );
+        if ( k_fraction <= 0.0 || k_fraction > 1.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --k-fraction a value in (0.0, 1.0]"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --k-fraction a value (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--histogram-bins") ) {
+
+      i++;
+      if ( i < argc ) {
+        histogram_bins = ::atoll( argv[i] );
+        if ( histogram_bins < 1 || histogram_bins > (1L << 20) ) {
+          getCout() << "\nBad input:"
+                    << " must give --histogram-bins a value in [1, 1048576]"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --histogram-bins a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--histogram-skew") ) {
+
+      i++;
+      if ( i < argc ) {
+        histogram_skew = ::atof( argv[i] );
+        if ( histogram_skew < 0.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --histogram-skew a non-negative value"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --histogram-skew a value (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--hash-load-factor") ) {
+
+      i++;
+      if ( i < argc ) {
+        hash_load_factor = ::atof( argv[i] );
+        if ( hash_load_factor <= 0.0 || hash_load_factor >= 1.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --hash-load-factor a value in (0.0, 1.0)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --hash-load-factor a value (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--hash-hit-ratio") ) {
+
+      i++;
+      if ( i < argc ) {
+        hash_hit_ratio = ::atof( argv[i] );
+        if ( hash_hit_ratio < 0.0 || hash_hit_ratio > 1.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --hash-hit-ratio a value in [0.0, 1.0]"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --hash-hit-ratio a value (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--ltimes-num-d") ) {
+
+      i++;
+      if ( i < argc ) {
+        ltimes_num_d = ::atoll( argv[i] );
+        if ( ltimes_num_d < 1 || ltimes_num_d > 4096 ) {
+          getCout() << "\nBad input:"
+                    << " must give --ltimes-num-d a value in [1, 4096]"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --ltimes-num-d a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--ltimes-num-g") ) {
+
+      i++;
+      if ( i < argc ) {
+        ltimes_num_g = ::atoll( argv[i] );
+        if ( ltimes_num_g < 1 || ltimes_num_g > 4096 ) {
+          getCout() << "\nBad input:"
+                    << " must give --ltimes-num-g a value in [1, 4096]"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --ltimes-num-g a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--ltimes-num-m") ) {
+
+      i++;
+      if ( i < argc ) {
+        ltimes_num_m = ::atoll( argv[i] );
+        if ( ltimes_num_m < 1 || ltimes_num_m > 4096 ) {
+          getCout() << "\nBad input:"
+                    << " must give --ltimes-num-m a value in [1, 4096]"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --ltimes-num-m a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
 
     } else if ( std::string(argv[i]) == std::string("--features") ||
                 std::string(argv[i]) == std::string("-f") ) {
@@ -616,6 +861,22 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
 
       disable_warmup = true;
 
+    } else if ( std::string(argv[i]) == std::string("--autotune") ) {
+
+      autotune = true;
+
+    } else if ( std::string(argv[i]) == std::string("--tunings-from") ) {
+
+      i++;
+      if ( i < argc && argv[i][0] != '-' ) {
+        tunings_from_file = std::string( argv[i] );
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --tunings-from a file name (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( std::string(argv[i]) == std::string("--checkrun") ) {
 
       input_state = CheckRun;
@@ -649,6 +910,11 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
     size_factor = 1.0;
   }
 
+  // Autotune picks tunings by median time, so use a few passes by default
+  if (autotune && !got_npasses) {
+    npasses = 3;
+  }
+
   // Default npasses_combiners if no input
   if (npasses_combiner_input.empty()) {
     npasses_combiners.emplace_back(CombinerOpt::Average);
@@ -688,7 +954,8 @@ void RunParams::printHelpMessage(std::ostream& str) const
       << "\t      (Ways of combining npasses timing data into timing files)\n";
   str << "\t\t Example...\n"
       << "\t\t --npasses-combiners Average Minimum Maximum (produce average, min, and\n"
-      << "\t\t   max timing .csv files)\n\n";
+      << "\t\t   max timing .csv files)\n"
+      << "\t\t --npasses-combiners Median (produce median timing .csv file)\n\n";
 
   str << "\t --repfact <double> [default is 1.0]\n"
       << "\t      (multiplier on default # reps to run each kernel)\n";
@@ -781,12 +1048,81 @@ void RunParams::printHelpMessage(std::ostream& str) const
       << "\t\t --hip-data-space HipManaged (run HIP variants with Hip Managed memory)\n"
       << "\t\t -hds HipPinned (run HIP variants with Hip Pinned memory)\n\n";
 
-  str << "\t --kokkos-data-space, -kds <string> [Default is Host]\n"
-      << "\t      (names of data space to use)\n";
+  str << "\t --kokkos-data-space, -kds <string> [Default is Omp for Kokkos OpenMP builds, else Host]\n"
+      << "\t      (names of data space to use; must be host accessible, one of\n"
+      << "\t       Host, Omp, CudaPinned, HipHostAdviseFine, HipHostAdviseCoarse,\n"
+      << "\t       HipPinned, HipPinnedFine, HipPinnedCoarse, HipManaged,\n"
+      << "\t       HipManagedAdviseFine, HipManagedAdviseCoarse)\n"
+      << "\t      (Kokkos views alias data in place when the Kokkos default space can access it)\n";
   str << "\t\t Examples...\n"
       << "\t\t --kokkos-data-space Host (run KOKKOS variants with Host memory)\n"
       << "\t\t -kds HipPinned (run KOKKOS variants with Hip Pinned memory)\n\n";
 
+  str << "\t --sort-input <string> [Default is uniform]\n"
+      << "\t      (distribution of input values for SORT, SORTPAIRS, SCAN, TOPK,\n"
+      << "\t       and NTH_ELEMENT kernels)\n"
+      << "\t      (one of uniform, sorted, reverse, nearly, fewunique, zipf)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --sort-input nearly (sort nearly sorted data)\n\n";
+
+  str << "\t --segment-lengths <string> [Default is uniform]\n"
+      << "\t      (distribution of segment lengths for SEGMENTED_SCAN and\n"
+      << "\t       REDUCE_BY_KEY kernels; one of uniform, powerlaw)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --segment-lengths powerlaw (few long segments, many short ones)\n\n";
+
+  str << "\t --selectivity <double> [Default is 0.5]\n"
+      << "\t      (fraction of values selected by the INDEXLIST and\n"
+      << "\t       INDEXLIST_3LOOP kernels; must be in [0.0, 1.0])\n";
+  str << "\t\t Example...\n"
+      << "\t\t --selectivity 0.05 (select about 5% of the values)\n\n";
+
+  str << "\t --k-fraction <double> [Default is 0.01]\n"
+      << "\t      (k as a fraction of the problem size; TOPK selects the k\n"
+      << "\t       largest values and NTH_ELEMENT finds the k-th smallest)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --k-fraction 0.001 (select 1 in 1000 values)\n\n";
+
+  str << "\t --histogram-bins <int> [Default is 1024]\n"
+      << "\t      (number of bins in the HISTOGRAM kernel; must be in [1, 1048576])\n";
+  str << "\t\t Example...\n"
+      << "\t\t --histogram-bins 16 (few bins, high contention)\n\n";
+
+  str << "\t --histogram-skew <double> [Default is 1.0]\n"
+      << "\t      (Zipf exponent of the HISTOGRAM keys; 0.0 gives uniform keys)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --histogram-skew 2.0 (most keys fall in a few bins)\n\n";
+
+  str << "\t --hash-load-factor <double> [Default is 0.5]\n"
+      << "\t      (fraction of the HASH_BUILD_PROBE table buckets filled;\n"
+      << "\t       must be in (0.0, 1.0))\n";
+  str << "\t\t Example...\n"
+      << "\t\t --hash-load-factor 0.9 (long probe sequences)\n\n";
+
+  str << "\t --hash-hit-ratio <double> [Default is 0.5]\n"
+      << "\t      (fraction of the HASH_BUILD_PROBE lookups that find their\n"
+      << "\t       key; must be in [0.0, 1.0])\n";
+  str << "\t\t Example...\n"
+      << "\t\t --hash-hit-ratio 0.0 (every lookup misses)\n\n";
+
+  str << "\t --ltimes-num-d <int> [Default is 64]\n"
+      << "\t      (number of directions in the LTIMES and LTIMES_NOVIEW\n"
+      << "\t       kernels; must be in [1, 4096])\n";
+  str << "\t\t Example...\n"
+      << "\t\t --ltimes-num-d 320 (large angular quadrature)\n\n";
+
+  str << "\t --ltimes-num-g <int> [Default is 32]\n"
+      << "\t      (number of energy groups in the LTIMES and LTIMES_NOVIEW\n"
+      << "\t       kernels; must be in [1, 4096])\n";
+  str << "\t\t Example...\n"
+      << "\t\t --ltimes-num-g 8 (few groups)\n\n";
+
+  str << "\t --ltimes-num-m <int> [Default is 25]\n"
+      << "\t      (number of moments in the LTIMES and LTIMES_NOVIEW\n"
+      << "\t       kernels; must be in [1, 4096])\n";
+  str << "\t\t Example...\n"
+      << "\t\t --ltimes-num-m 9 (moments of a P2 scattering expansion)\n\n";
+
   str << "\t --features, -f <space-separated strings> [Default is run all]\n"
       << "\t      (names of features to run)\n";
   str << "\t\t Examples...\n"
@@ -820,6 +1156,18 @@ void RunParams::printHelpMessage(std::ostream& str) const
 
   str << "\t --disable-warmup (disable warmup tests)\n\n";
 
+  str << "\t --autotune (pick the tuning of each kernel variant with the lowest\n"
+      << "\t      median time and write them to <outfile>-tunings.csv)\n"
+      << "\t      (defaults to 3 passes if --npasses is not given)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --autotune --repfact 0.1 (short search over all tunings)\n\n";
+
+  str << "\t --tunings-from <string> [Default is run all tunings]\n"
+      << "\t      (run only the tunings listed in a tunings file from --autotune)\n"
+      << "\t      (kernel variants not listed in the file run all tunings)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --tunings-from RAJAPerf-tunings.csv\n\n";
+
   str << "\t --checkrun <int> [default is 1]\n"
 << "\t      (run each kernel a given number of times; usually to check things are working properly or to reduce aggregate execution time)\n";
   str << "\t\t Example...\n"
@@ -885,6 +1233,28 @@ void RunParams::printDataSpaceNames(std::ostream& str) const
 }
 
 
+void RunParams::printSortInputNames(std::ostream& str) const
+{
+  str << "\nAvailable sort inputs:";
+  str << "\n-------------------\n";
+  for (int isi = 0; isi < static_cast<int>(SortInput::NumInputs); ++isi) {
+    str << getSortInputName(static_cast<SortInput>(isi)) << std::endl;
+  }
+  str.flush();
+}
+
+
+void RunParams::printSegmentLengthsNames(std::ostream& str) const
+{
+  str << "\nAvailable segment lengths:";
+  str << "\n-------------------------\n";
+  for (int isl = 0; isl < static_cast<int>(SegmentLengths::NumLengths); ++isl) {
+    str << getSegmentLengthsName(static_cast<SegmentLengths>(isl)) << std::endl;
+  }
+  str.flush();
+}
+
+
 void RunParams::printGroupNames(std::ostream& str) const
 {
   str << "\nAvailable groups:";
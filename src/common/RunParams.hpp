@@ -51,7 +51,8 @@ public:
   enum CombinerOpt {
     Average,      /*!< option requesting average */
     Minimum,      /*!< option requesting minimum */
-    Maximum       /*!< option requesting maximum */
+    Maximum,      /*!< option requesting maximum */
+    Median        /*!< option requesting median */
   };
 
   static std::string CombinerOptToStr(CombinerOpt co)
@@ -63,6 +64,8 @@ public:
         return "Minimum";
       case CombinerOpt::Maximum:
         return "Maximum";
+      case CombinerOpt::Median:
+        return "Median";
       default:
         return "Unknown";
     }
@@ -145,6 +148,18 @@ public:
   DataSpace getHipDataSpace() const { return hipDataSpace; }
   DataSpace getKokkosDataSpace() const { return kokkosDataSpace; }
 
+  SortInput getSortInput() const { return sortInput; }
+  SegmentLengths getSegmentLengths() const { return segmentLengths; }
+  double getSelectivity() const { return selectivity; }
+  double getKFraction() const { return k_fraction; }
+  long getHistogramBins() const { return histogram_bins; }
+  double getHistogramSkew() const { return histogram_skew; }
+  double getHashLoadFactor() const { return hash_load_factor; }
+  double getHashHitRatio() const { return hash_hit_ratio; }
+  long getLTimesNumD() const { return ltimes_num_d; }
+  long getLTimesNumG() const { return ltimes_num_g; }
+  long getLTimesNumM() const { return ltimes_num_m; }
+
   double getPFTolerance() const { return pf_tol; }
 
   int getCheckRunReps() const { return checkrun_reps; }
@@ -205,6 +220,9 @@ public:
 
   bool getDisableWarmup() const { return disable_warmup; }
 
+  bool getAutotune() const { return autotune; }
+  const std::string& getTuningsFromFile() const { return tunings_from_file; }
+
 //@}
 
   /*!
@@ -224,6 +242,8 @@ private:
   void printKernelNames(std::ostream& str) const;
   void printVariantNames(std::ostream& str) const;
   void printDataSpaceNames(std::ostream& str) const;
+  void printSortInputNames(std::ostream& str) const;
+  void printSegmentLengthsNames(std::ostream& str) const;
   void printGroupNames(std::ostream& str) const;
   void printFeatureNames(std::ostream& str) const;
   void printFeatureKernels(std::ostream& str) const;
@@ -262,6 +282,24 @@ private:
   DataSpace hipDataSpace = DataSpace::HipDevice;
   DataSpace kokkosDataSpace = DataSpace::Host;
 
+  SortInput sortInput = SortInput::Uniform;  /*!< distribution of input values
+                                                  for sort and scan kernels */
+  SegmentLengths segmentLengths = SegmentLengths::Uniform;  /*!< distribution of
+                                                  segment lengths for
+                                                  segmented kernels */
+  double selectivity = 0.5;  /*!< fraction of values selected by stream
+                                  compaction kernels */
+  double k_fraction = 0.01;  /*!< fraction of values selected by selection
+                                  kernels */
+  long histogram_bins = 1024;  /*!< number of bins in histogram kernels */
+  double histogram_skew = 1.0;  /*!< Zipf exponent of histogram keys */
+  double hash_load_factor = 0.5;  /*!< fraction of hash table buckets filled */
+  double hash_hit_ratio = 0.5;  /*!< fraction of hash table lookups that
+                                     find their key */
+  long ltimes_num_d = 64;  /*!< number of directions in LTIMES kernels */
+  long ltimes_num_g = 32;  /*!< number of groups in LTIMES kernels */
+  long ltimes_num_m = 25;  /*!< number of moments in LTIMES kernels */
+
   //
   // Arrays to hold input strings for valid/invalid input. Helpful for
   // debugging command line args.
@@ -287,6 +325,11 @@ private:
 
   bool disable_warmup;
 
+  bool autotune;        /*!< true -> select best tuning of each kernel
+                             variant and write it to a tunings file */
+  std::string tunings_from_file;  /*!< Tunings file from autotune run to
+                                       restrict the tunings run. */
+
 };
 
 
@@ -18,7 +18,9 @@ namespace lcals
 {
 
 
-void EOS::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void EOS::runOpenMPVariantImpl(VariantID vid, Real_T* x, Real_T* y, Real_T* z,
+                               Real_T* u, Real_T q, Real_T r, Real_T t)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -26,8 +28,6 @@ void EOS::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  EOS_DATA_SETUP;
-
   auto eos_lam = [=](Index_type i) {
                    EOS_BODY;
                  };
@@ -91,5 +91,60 @@ void EOS::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 #endif
 }
 
+void EOS::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    EOS_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, x, y, z, u, q, r, t);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    EOS_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, x, y, z, u, q, r, t);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    EOS_ALT_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, x, y, z, u, q, r, t);
+
+  }
+
+  t += 1;
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+void EOS::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+#endif
+
 } // end namespace lcals
 } // end namespace rajaperf
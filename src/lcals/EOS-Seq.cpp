@@ -18,14 +18,14 @@ namespace lcals
 {
 
 
-void EOS::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void EOS::runSeqVariantImpl(VariantID vid, Real_T* x, Real_T* y, Real_T* z,
+                            Real_T* u, Real_T q, Real_T r, Real_T t)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  EOS_DATA_SETUP;
-
 #if defined(RUN_RAJA_SEQ)
   auto eos_lam = [=](Index_type i) {
                    EOS_BODY;
@@ -88,5 +88,51 @@ void EOS::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void EOS::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    EOS_DATA_SETUP;
+
+    runSeqVariantImpl(vid, x, y, z, u, q, r, t);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    EOS_DATA_SETUP;
+
+    runSeqVariantImpl(vid, x, y, z, u, q, r, t);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    EOS_ALT_DATA_SETUP;
+
+    runSeqVariantImpl(vid, x, y, z, u, q, r, t);
+
+  }
+
+  t += 1;
+}
+
+void EOS::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
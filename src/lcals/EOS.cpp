@@ -33,6 +33,9 @@ EOS::EOS(const RunParams& params)
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Real_type) + 2*sizeof(Real_type)) * getActualProblemSize() +
                   (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_array_length );
+  setTuningBytesPerRep( getPrecisionTuningName<AltReal_type>(),
+                        (1*sizeof(AltReal_type) + 2*sizeof(AltReal_type)) * getActualProblemSize() +
+                        (0*sizeof(AltReal_type) + 1*sizeof(AltReal_type)) * m_array_length );
   setFLOPsPerRep(16 * getActualProblemSize());
 
   checksum_scale_factor = 0.0001 *
@@ -65,12 +68,19 @@ EOS::~EOS()
 {
 }
 
-void EOS::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void EOS::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitDataConst(m_x, m_array_length, 0.0, vid);
-  allocAndInitData(m_y, m_array_length, vid);
-  allocAndInitData(m_z, m_array_length, vid);
-  allocAndInitData(m_u, m_array_length, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    allocAndInitDataConst(m_alt_x, m_array_length, AltReal_type(0.0), vid);
+    allocAndInitData(m_alt_y, m_array_length, vid);
+    allocAndInitData(m_alt_z, m_array_length, vid);
+    allocAndInitData(m_alt_u, m_array_length, vid);
+  } else {
+    allocAndInitDataConst(m_x, m_array_length, 0.0, vid);
+    allocAndInitData(m_y, m_array_length, vid);
+    allocAndInitData(m_z, m_array_length, vid);
+    allocAndInitData(m_u, m_array_length, vid);
+  }
 
   initData(m_q, vid);
   initData(m_r, vid);
@@ -79,16 +89,27 @@ void EOS::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 void EOS::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_x, getActualProblemSize(), checksum_scale_factor , vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    checksum[vid][tune_idx] += calcChecksum(m_alt_x, getActualProblemSize(), checksum_scale_factor , vid);
+    setChecksumTolerance<AltReal_type>(vid, tune_idx);
+  } else {
+    checksum[vid][tune_idx] += calcChecksum(m_x, getActualProblemSize(), checksum_scale_factor , vid);
+  }
 }
 
-void EOS::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void EOS::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
-  deallocData(m_x, vid);
-  deallocData(m_y, vid);
-  deallocData(m_z, vid);
-  deallocData(m_u, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    deallocData(m_alt_x, vid);
+    deallocData(m_alt_y, vid);
+    deallocData(m_alt_z, vid);
+    deallocData(m_alt_u, vid);
+  } else {
+    deallocData(m_x, vid);
+    deallocData(m_y, vid);
+    deallocData(m_z, vid);
+    deallocData(m_u, vid);
+  }
 }
 
 } // end namespace lcals
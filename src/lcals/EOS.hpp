@@ -30,6 +30,16 @@
   const Real_type r = m_r; \
   const Real_type t = m_t;
 
+#define EOS_ALT_DATA_SETUP \
+  AltReal_ptr x = m_alt_x; \
+  AltReal_ptr y = m_alt_y; \
+  AltReal_ptr z = m_alt_z; \
+  AltReal_ptr u = m_alt_u; \
+\
+  const AltReal_type q = static_cast<AltReal_type>(m_q); \
+  const AltReal_type r = static_cast<AltReal_type>(m_r); \
+  const AltReal_type t = static_cast<AltReal_type>(m_t);
+
 #define EOS_BODY  \
   x[i] = u[i] + r*( z[i] + r*y[i] ) + \
                 t*( u[i+3] + r*( u[i+2] + r*u[i+1] ) + \
@@ -64,8 +74,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename Real_T >
+  void runSeqVariantImpl(VariantID vid, Real_T* x, Real_T* y, Real_T* z,
+                         Real_T* u, Real_T q, Real_T r, Real_T t);
+  template < typename Real_T >
+  void runOpenMPVariantImpl(VariantID vid, Real_T* x, Real_T* y, Real_T* z,
+                            Real_T* u, Real_T q, Real_T r, Real_T t);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -79,6 +97,10 @@ private:
   Real_ptr m_y;
   Real_ptr m_z;
   Real_ptr m_u;
+  AltReal_ptr m_alt_x;
+  AltReal_ptr m_alt_y;
+  AltReal_ptr m_alt_z;
+  AltReal_ptr m_alt_u;
 
   Real_type m_q;
   Real_type m_r;
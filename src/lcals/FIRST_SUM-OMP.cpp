@@ -18,7 +18,8 @@ namespace lcals
 {
 
 
-void FIRST_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void FIRST_SUM::runOpenMPVariantImpl(VariantID vid, Real_T* x, Real_T* y)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -26,8 +27,6 @@ void FIRST_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
   const Index_type ibegin = 1;
   const Index_type iend = getActualProblemSize();
 
-  FIRST_SUM_DATA_SETUP;
-
   auto firstsum_lam = [=](Index_type i) {
                         FIRST_SUM_BODY;
                       };
@@ -91,5 +90,60 @@ void FIRST_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+void FIRST_SUM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    FIRST_SUM_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, x, y);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    FIRST_SUM_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, x, y);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    FIRST_SUM_ALT_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, x, y);
+
+  }
+
+  t += 1;
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+void FIRST_SUM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+#endif
+
 } // end namespace lcals
 } // end namespace rajaperf
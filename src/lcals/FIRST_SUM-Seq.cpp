@@ -18,14 +18,13 @@ namespace lcals
 {
 
 
-void FIRST_SUM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void FIRST_SUM::runSeqVariantImpl(VariantID vid, Real_T* x, Real_T* y)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 1;
   const Index_type iend = getActualProblemSize();
 
-  FIRST_SUM_DATA_SETUP;
-
 #if defined(RUN_RAJA_SEQ)
   auto firstsum_lam = [=](Index_type i) {
                         FIRST_SUM_BODY;
@@ -88,5 +87,51 @@ void FIRST_SUM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 }
 
+void FIRST_SUM::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    FIRST_SUM_DATA_SETUP;
+
+    runSeqVariantImpl(vid, x, y);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    FIRST_SUM_DATA_SETUP;
+
+    runSeqVariantImpl(vid, x, y);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    FIRST_SUM_ALT_DATA_SETUP;
+
+    runSeqVariantImpl(vid, x, y);
+
+  }
+
+  t += 1;
+}
+
+void FIRST_SUM::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
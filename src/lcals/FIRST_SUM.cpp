@@ -32,6 +32,9 @@ FIRST_SUM::FIRST_SUM(const RunParams& params)
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Real_type ) + 0*sizeof(Real_type )) * (m_N-1) +
                   (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N );
+  setTuningBytesPerRep( getPrecisionTuningName<AltReal_type>(),
+                        (1*sizeof(AltReal_type ) + 0*sizeof(AltReal_type )) * (m_N-1) +
+                        (0*sizeof(AltReal_type ) + 1*sizeof(AltReal_type )) * m_N );
   setFLOPsPerRep(1 * (getActualProblemSize()-1));
 
   setUsesFeature(Forall);
@@ -60,22 +63,36 @@ FIRST_SUM::~FIRST_SUM()
 {
 }
 
-void FIRST_SUM::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void FIRST_SUM::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitDataConst(m_x, m_N, 0.0, vid);
-  allocAndInitData(m_y, m_N, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    allocAndInitDataConst(m_alt_x, m_N, AltReal_type(0.0), vid);
+    allocAndInitData(m_alt_y, m_N, vid);
+  } else {
+    allocAndInitDataConst(m_x, m_N, 0.0, vid);
+    allocAndInitData(m_y, m_N, vid);
+  }
 }
 
 void FIRST_SUM::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_x, getActualProblemSize(), vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    checksum[vid][tune_idx] += calcChecksum(m_alt_x, getActualProblemSize(), vid);
+    setChecksumTolerance<AltReal_type>(vid, tune_idx);
+  } else {
+    checksum[vid][tune_idx] += calcChecksum(m_x, getActualProblemSize(), vid);
+  }
 }
 
-void FIRST_SUM::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void FIRST_SUM::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
-  deallocData(m_x, vid);
-  deallocData(m_y, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    deallocData(m_alt_x, vid);
+    deallocData(m_alt_y, vid);
+  } else {
+    deallocData(m_x, vid);
+    deallocData(m_y, vid);
+  }
 }
 
 } // end namespace lcals
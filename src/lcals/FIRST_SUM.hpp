@@ -25,6 +25,10 @@
   Real_ptr x = m_x; \
   Real_ptr y = m_y;
 
+#define FIRST_SUM_ALT_DATA_SETUP \
+  AltReal_ptr x = m_alt_x; \
+  AltReal_ptr y = m_alt_y;
+
 #define FIRST_SUM_BODY  \
   x[i] = y[i-1] + y[i];
 
@@ -57,8 +61,14 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename Real_T >
+  void runSeqVariantImpl(VariantID vid, Real_T* x, Real_T* y);
+  template < typename Real_T >
+  void runOpenMPVariantImpl(VariantID vid, Real_T* x, Real_T* y);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -70,6 +80,8 @@ private:
 
   Real_ptr m_x;
   Real_ptr m_y;
+  AltReal_ptr m_alt_x;
+  AltReal_ptr m_alt_y;
 
   Index_type m_N;
 };
@@ -18,14 +18,15 @@ namespace lcals
 {
 
 
-void GEN_LIN_RECUR::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void GEN_LIN_RECUR::runOpenMPVariantImpl(VariantID vid, Real_T* b5, Real_T* sa,
+                                         Real_T* sb, Real_T* stb5,
+                                         Index_type kb5i, Index_type N)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
   const Index_type run_reps = getRunReps();
 
-  GEN_LIN_RECUR_DATA_SETUP;
-
   auto genlinrecur_lam1 = [=](Index_type k) {
                             GEN_LIN_RECUR_BODY1;
                           };
@@ -105,5 +106,60 @@ void GEN_LIN_RECUR::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+void GEN_LIN_RECUR::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    GEN_LIN_RECUR_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, b5, sa, sb, stb5, kb5i, N);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    GEN_LIN_RECUR_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, b5, sa, sb, stb5, kb5i, N);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    GEN_LIN_RECUR_ALT_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, b5, sa, sb, stb5, kb5i, N);
+
+  }
+
+  t += 1;
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+void GEN_LIN_RECUR::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+#endif
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -18,12 +18,13 @@ namespace lcals
 {
 
 
-void GEN_LIN_RECUR::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void GEN_LIN_RECUR::runSeqVariantImpl(VariantID vid, Real_T* b5, Real_T* sa,
+                                      Real_T* sb, Real_T* stb5, Index_type kb5i,
+                                      Index_type N)
 {
   const Index_type run_reps = getRunReps();
 
-  GEN_LIN_RECUR_DATA_SETUP;
-
 #if defined(RUN_RAJA_SEQ)
   auto genlinrecur_lam1 = [=](Index_type k) {
                             GEN_LIN_RECUR_BODY1;
@@ -100,5 +101,51 @@ void GEN_LIN_RECUR::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
 }
 
+void GEN_LIN_RECUR::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    GEN_LIN_RECUR_DATA_SETUP;
+
+    runSeqVariantImpl(vid, b5, sa, sb, stb5, kb5i, N);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    GEN_LIN_RECUR_DATA_SETUP;
+
+    runSeqVariantImpl(vid, b5, sa, sb, stb5, kb5i, N);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    GEN_LIN_RECUR_ALT_DATA_SETUP;
+
+    runSeqVariantImpl(vid, b5, sa, sb, stb5, kb5i, N);
+
+  }
+
+  t += 1;
+}
+
+void GEN_LIN_RECUR::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -32,6 +32,9 @@ GEN_LIN_RECUR::GEN_LIN_RECUR(const RunParams& params)
   setKernelsPerRep(2);
   setBytesPerRep( (2*sizeof(Real_type ) + 3*sizeof(Real_type )) * m_N +
                   (2*sizeof(Real_type ) + 3*sizeof(Real_type )) * m_N );
+  setTuningBytesPerRep( getPrecisionTuningName<AltReal_type>(),
+                        (2*sizeof(AltReal_type ) + 3*sizeof(AltReal_type )) * m_N +
+                        (2*sizeof(AltReal_type ) + 3*sizeof(AltReal_type )) * m_N );
   setFLOPsPerRep((3 +
                   3 ) * getActualProblemSize());
 
@@ -65,28 +68,46 @@ GEN_LIN_RECUR::~GEN_LIN_RECUR()
 {
 }
 
-void GEN_LIN_RECUR::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void GEN_LIN_RECUR::setUp(VariantID vid, size_t tune_idx)
 {
   m_kb5i = 0;
 
-  allocAndInitDataConst(m_b5, m_N, 0.0, vid);
-  allocAndInitData(m_stb5, m_N, vid);
-  allocAndInitData(m_sa, m_N, vid);
-  allocAndInitData(m_sb, m_N, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    allocAndInitDataConst(m_alt_b5, m_N, AltReal_type(0.0), vid);
+    allocAndInitData(m_alt_stb5, m_N, vid);
+    allocAndInitData(m_alt_sa, m_N, vid);
+    allocAndInitData(m_alt_sb, m_N, vid);
+  } else {
+    allocAndInitDataConst(m_b5, m_N, 0.0, vid);
+    allocAndInitData(m_stb5, m_N, vid);
+    allocAndInitData(m_sa, m_N, vid);
+    allocAndInitData(m_sb, m_N, vid);
+  }
 }
 
 void GEN_LIN_RECUR::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_b5, getActualProblemSize(), checksum_scale_factor , vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    checksum[vid][tune_idx] += calcChecksum(m_alt_b5, getActualProblemSize(), checksum_scale_factor , vid);
+    setChecksumTolerance<AltReal_type>(vid, tune_idx);
+  } else {
+    checksum[vid][tune_idx] += calcChecksum(m_b5, getActualProblemSize(), checksum_scale_factor , vid);
+  }
 }
 
-void GEN_LIN_RECUR::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void GEN_LIN_RECUR::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
-  deallocData(m_b5, vid);
-  deallocData(m_stb5, vid);
-  deallocData(m_sa, vid);
-  deallocData(m_sb, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    deallocData(m_alt_b5, vid);
+    deallocData(m_alt_stb5, vid);
+    deallocData(m_alt_sa, vid);
+    deallocData(m_alt_sb, vid);
+  } else {
+    deallocData(m_b5, vid);
+    deallocData(m_stb5, vid);
+    deallocData(m_sa, vid);
+    deallocData(m_sb, vid);
+  }
 }
 
 } // end namespace lcals
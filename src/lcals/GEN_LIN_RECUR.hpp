@@ -40,6 +40,15 @@
   Index_type kb5i = m_kb5i; \
   Index_type N = m_N;
 
+#define GEN_LIN_RECUR_ALT_DATA_SETUP \
+  AltReal_ptr b5 = m_alt_b5; \
+  AltReal_ptr sa = m_alt_sa; \
+  AltReal_ptr sb = m_alt_sb; \
+  AltReal_ptr stb5 = m_alt_stb5; \
+\
+  Index_type kb5i = m_kb5i; \
+  Index_type N = m_N;
+
 #define GEN_LIN_RECUR_BODY1  \
   b5[k+kb5i] = sa[k] + stb5[k]*sb[k]; \
   stb5[k] = b5[k+kb5i] - stb5[k];
@@ -78,8 +87,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename Real_T >
+  void runSeqVariantImpl(VariantID vid, Real_T* b5, Real_T* sa, Real_T* sb,
+                         Real_T* stb5, Index_type kb5i, Index_type N);
+  template < typename Real_T >
+  void runOpenMPVariantImpl(VariantID vid, Real_T* b5, Real_T* sa, Real_T* sb,
+                            Real_T* stb5, Index_type kb5i, Index_type N);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -93,6 +110,10 @@ private:
   Real_ptr m_sa;
   Real_ptr m_sb;
   Real_ptr m_stb5;
+  AltReal_ptr m_alt_b5;
+  AltReal_ptr m_alt_sa;
+  AltReal_ptr m_alt_sb;
+  AltReal_ptr m_alt_stb5;
   Index_type m_kb5i;
 
   Index_type m_N;
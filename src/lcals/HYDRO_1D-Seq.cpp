@@ -18,14 +18,14 @@ namespace lcals
 {
 
 
-void HYDRO_1D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void HYDRO_1D::runSeqVariantImpl(VariantID vid, Real_T* x, Real_T* y, Real_T* z,
+                                 Real_T q, Real_T r, Real_T t)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  HYDRO_1D_DATA_SETUP;
-
 #if defined(RUN_RAJA_SEQ)
   auto hydro1d_lam = [=](Index_type i) {
                        HYDRO_1D_BODY;
@@ -88,5 +88,51 @@ void HYDRO_1D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
 }
 
+void HYDRO_1D::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    HYDRO_1D_DATA_SETUP;
+
+    runSeqVariantImpl(vid, x, y, z, q, r, t);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    HYDRO_1D_DATA_SETUP;
+
+    runSeqVariantImpl(vid, x, y, z, q, r, t);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    HYDRO_1D_ALT_DATA_SETUP;
+
+    runSeqVariantImpl(vid, x, y, z, q, r, t);
+
+  }
+
+  t += 1;
+}
+
+void HYDRO_1D::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
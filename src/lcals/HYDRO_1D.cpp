@@ -32,6 +32,9 @@ HYDRO_1D::HYDRO_1D(const RunParams& params)
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * getActualProblemSize() +
                   (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * (getActualProblemSize()+1) );
+  setTuningBytesPerRep( getPrecisionTuningName<AltReal_type>(),
+                        (1*sizeof(AltReal_type ) + 1*sizeof(AltReal_type )) * getActualProblemSize() +
+                        (0*sizeof(AltReal_type ) + 1*sizeof(AltReal_type )) * (getActualProblemSize()+1) );
   setFLOPsPerRep(5 * getActualProblemSize());
 
   checksum_scale_factor = 0.001 *
@@ -64,11 +67,17 @@ HYDRO_1D::~HYDRO_1D()
 {
 }
 
-void HYDRO_1D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HYDRO_1D::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitDataConst(m_x, m_array_length, 0.0, vid);
-  allocAndInitData(m_y, m_array_length, vid);
-  allocAndInitData(m_z, m_array_length, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    allocAndInitDataConst(m_alt_x, m_array_length, AltReal_type(0.0), vid);
+    allocAndInitData(m_alt_y, m_array_length, vid);
+    allocAndInitData(m_alt_z, m_array_length, vid);
+  } else {
+    allocAndInitDataConst(m_x, m_array_length, 0.0, vid);
+    allocAndInitData(m_y, m_array_length, vid);
+    allocAndInitData(m_z, m_array_length, vid);
+  }
 
   initData(m_q, vid);
   initData(m_r, vid);
@@ -77,15 +86,25 @@ void HYDRO_1D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 void HYDRO_1D::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_x, getActualProblemSize(), checksum_scale_factor , vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    checksum[vid][tune_idx] += calcChecksum(m_alt_x, getActualProblemSize(), checksum_scale_factor , vid);
+    setChecksumTolerance<AltReal_type>(vid, tune_idx);
+  } else {
+    checksum[vid][tune_idx] += calcChecksum(m_x, getActualProblemSize(), checksum_scale_factor , vid);
+  }
 }
 
-void HYDRO_1D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HYDRO_1D::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
-  deallocData(m_x, vid);
-  deallocData(m_y, vid);
-  deallocData(m_z, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    deallocData(m_alt_x, vid);
+    deallocData(m_alt_y, vid);
+    deallocData(m_alt_z, vid);
+  } else {
+    deallocData(m_x, vid);
+    deallocData(m_y, vid);
+    deallocData(m_z, vid);
+  }
 }
 
 } // end namespace lcals
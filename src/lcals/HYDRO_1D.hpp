@@ -27,6 +27,15 @@
   const Real_type r = m_r; \
   const Real_type t = m_t;
 
+#define HYDRO_1D_ALT_DATA_SETUP \
+  AltReal_ptr x = m_alt_x; \
+  AltReal_ptr y = m_alt_y; \
+  AltReal_ptr z = m_alt_z; \
+\
+  const AltReal_type q = static_cast<AltReal_type>(m_q); \
+  const AltReal_type r = static_cast<AltReal_type>(m_r); \
+  const AltReal_type t = static_cast<AltReal_type>(m_t);
+
 #define HYDRO_1D_BODY  \
   x[i] = q + y[i]*( r*z[i+10] + t*z[i+11] );
 
@@ -59,8 +68,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename Real_T >
+  void runSeqVariantImpl(VariantID vid, Real_T* x, Real_T* y, Real_T* z,
+                         Real_T q, Real_T r, Real_T t);
+  template < typename Real_T >
+  void runOpenMPVariantImpl(VariantID vid, Real_T* x, Real_T* y, Real_T* z,
+                            Real_T q, Real_T r, Real_T t);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -73,6 +90,9 @@ private:
   Real_ptr m_x;
   Real_ptr m_y;
   Real_ptr m_z;
+  AltReal_ptr m_alt_x;
+  AltReal_ptr m_alt_y;
+  AltReal_ptr m_alt_z;
 
   Real_type m_q;
   Real_type m_r;
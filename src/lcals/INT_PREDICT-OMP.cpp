@@ -18,7 +18,11 @@ namespace lcals
 {
 
 
-void INT_PREDICT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void INT_PREDICT::runOpenMPVariantImpl(VariantID vid, Real_T* px, Real_T dm22,
+                                       Real_T dm23, Real_T dm24, Real_T dm25,
+                                       Real_T dm26, Real_T dm27, Real_T dm28,
+                                       Real_T c0, Index_type offset)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -26,8 +30,6 @@ void INT_PREDICT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  INT_PREDICT_DATA_SETUP;
-
   auto intpredict_lam = [=](Index_type i) {
                           INT_PREDICT_BODY;
                         };
@@ -91,5 +93,63 @@ void INT_PREDICT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 #endif
 }
 
+void INT_PREDICT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    INT_PREDICT_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, px, dm22, dm23, dm24, dm25, dm26, dm27, dm28, c0,
+                         offset);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    INT_PREDICT_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, px, dm22, dm23, dm24, dm25, dm26, dm27, dm28, c0,
+                         offset);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    INT_PREDICT_ALT_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, px, dm22, dm23, dm24, dm25, dm26, dm27, dm28, c0,
+                         offset);
+
+  }
+
+  t += 1;
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+void INT_PREDICT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+#endif
+
 } // end namespace lcals
 } // end namespace rajaperf
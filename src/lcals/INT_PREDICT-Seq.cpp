@@ -18,14 +18,16 @@ namespace lcals
 {
 
 
-void INT_PREDICT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void INT_PREDICT::runSeqVariantImpl(VariantID vid, Real_T* px, Real_T dm22,
+                                    Real_T dm23, Real_T dm24, Real_T dm25,
+                                    Real_T dm26, Real_T dm27, Real_T dm28,
+                                    Real_T c0, Index_type offset)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  INT_PREDICT_DATA_SETUP;
-
 #if defined(RUN_RAJA_SEQ)
   auto intpredict_lam = [=](Index_type i) {
                           INT_PREDICT_BODY;
@@ -88,5 +90,54 @@ void INT_PREDICT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
 }
 
+void INT_PREDICT::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    INT_PREDICT_DATA_SETUP;
+
+    runSeqVariantImpl(vid, px, dm22, dm23, dm24, dm25, dm26, dm27, dm28, c0,
+                      offset);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    INT_PREDICT_DATA_SETUP;
+
+    runSeqVariantImpl(vid, px, dm22, dm23, dm24, dm25, dm26, dm27, dm28, c0,
+                      offset);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    INT_PREDICT_ALT_DATA_SETUP;
+
+    runSeqVariantImpl(vid, px, dm22, dm23, dm24, dm25, dm26, dm27, dm28, c0,
+                      offset);
+
+  }
+
+  t += 1;
+}
+
+void INT_PREDICT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -29,6 +29,8 @@ INT_PREDICT::INT_PREDICT(const RunParams& params)
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Real_type ) + 10*sizeof(Real_type )) * getActualProblemSize() );
+  setTuningBytesPerRep( getPrecisionTuningName<AltReal_type>(),
+                        (1*sizeof(AltReal_type ) + 10*sizeof(AltReal_type )) * getActualProblemSize() );
   setFLOPsPerRep(17 * getActualProblemSize());
 
   setUsesFeature(Forall);
@@ -57,13 +59,17 @@ INT_PREDICT::~INT_PREDICT()
 {
 }
 
-void INT_PREDICT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void INT_PREDICT::setUp(VariantID vid, size_t tune_idx)
 {
   m_array_length = getActualProblemSize() * 13;
   m_offset = getActualProblemSize();
 
   m_px_initval = 1.0;
-  allocAndInitDataConst(m_px, m_array_length, m_px_initval, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    allocAndInitDataConst(m_alt_px, m_array_length, AltReal_type(m_px_initval), vid);
+  } else {
+    allocAndInitDataConst(m_px, m_array_length, m_px_initval, vid);
+  }
 
   initData(m_dm22, vid);
   initData(m_dm23, vid);
@@ -77,21 +83,37 @@ void INT_PREDICT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 void INT_PREDICT::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  {
-    auto reset_px = scopedMoveData(m_px, m_array_length, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    {
+      auto reset_px = scopedMoveData(m_alt_px, m_array_length, vid);
 
-    for (Index_type i = 0; i < getActualProblemSize(); ++i) {
-      m_px[i] -= m_px_initval;
+      for (Index_type i = 0; i < getActualProblemSize(); ++i) {
+        m_alt_px[i] -= static_cast<AltReal_type>(m_px_initval);
+      }
     }
-  }
 
-  checksum[vid][tune_idx] += calcChecksum(m_px, getActualProblemSize(), vid);
+    checksum[vid][tune_idx] += calcChecksum(m_alt_px, getActualProblemSize(), vid);
+    setChecksumTolerance<AltReal_type>(vid, tune_idx);
+  } else {
+    {
+      auto reset_px = scopedMoveData(m_px, m_array_length, vid);
+
+      for (Index_type i = 0; i < getActualProblemSize(); ++i) {
+        m_px[i] -= m_px_initval;
+      }
+    }
+
+    checksum[vid][tune_idx] += calcChecksum(m_px, getActualProblemSize(), vid);
+  }
 }
 
-void INT_PREDICT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void INT_PREDICT::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
-  deallocData(m_px, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    deallocData(m_alt_px, vid);
+  } else {
+    deallocData(m_px, vid);
+  }
 }
 
 } // end namespace lcals
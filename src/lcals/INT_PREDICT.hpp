@@ -37,6 +37,18 @@
   Real_type c0 = m_c0; \
   const Index_type offset = m_offset;
 
+#define INT_PREDICT_ALT_DATA_SETUP \
+  AltReal_ptr px = m_alt_px; \
+  AltReal_type dm22 = static_cast<AltReal_type>(m_dm22); \
+  AltReal_type dm23 = static_cast<AltReal_type>(m_dm23); \
+  AltReal_type dm24 = static_cast<AltReal_type>(m_dm24); \
+  AltReal_type dm25 = static_cast<AltReal_type>(m_dm25); \
+  AltReal_type dm26 = static_cast<AltReal_type>(m_dm26); \
+  AltReal_type dm27 = static_cast<AltReal_type>(m_dm27); \
+  AltReal_type dm28 = static_cast<AltReal_type>(m_dm28); \
+  AltReal_type c0 = static_cast<AltReal_type>(m_c0); \
+  const Index_type offset = m_offset;
+
 #define INT_PREDICT_BODY  \
   px[i] = dm28*px[i + offset * 12] + dm27*px[i + offset * 11] + \
           dm26*px[i + offset * 10] + dm25*px[i + offset *  9] + \
@@ -74,8 +86,18 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename Real_T >
+  void runSeqVariantImpl(VariantID vid, Real_T* px, Real_T dm22, Real_T dm23,
+                         Real_T dm24, Real_T dm25, Real_T dm26, Real_T dm27,
+                         Real_T dm28, Real_T c0, Index_type offset);
+  template < typename Real_T >
+  void runOpenMPVariantImpl(VariantID vid, Real_T* px, Real_T dm22, Real_T dm23,
+                            Real_T dm24, Real_T dm25, Real_T dm26, Real_T dm27,
+                            Real_T dm28, Real_T c0, Index_type offset);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -89,6 +111,7 @@ private:
   Index_type m_offset;
 
   Real_ptr m_px;
+  AltReal_ptr m_alt_px;
   Real_type m_px_initval;
 
   Real_type m_dm22;
@@ -18,7 +18,9 @@ namespace lcals
 {
 
 
-void TRIDIAG_ELIM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void TRIDIAG_ELIM::runOpenMPVariantImpl(VariantID vid, Real_T* xout,
+                                        Real_T* xin, Real_T* y, Real_T* z)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -26,8 +28,6 @@ void TRIDIAG_ELIM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
   const Index_type ibegin = 1;
   const Index_type iend = m_N;
 
-  TRIDIAG_ELIM_DATA_SETUP;
-
   auto tridiag_elim_lam = [=](Index_type i) {
                             TRIDIAG_ELIM_BODY;
                           };
@@ -91,5 +91,60 @@ void TRIDIAG_ELIM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 #endif
 }
 
+void TRIDIAG_ELIM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    TRIDIAG_ELIM_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, xout, xin, y, z);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    TRIDIAG_ELIM_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, xout, xin, y, z);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    TRIDIAG_ELIM_ALT_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, xout, xin, y, z);
+
+  }
+
+  t += 1;
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+void TRIDIAG_ELIM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+#endif
+
 } // end namespace lcals
 } // end namespace rajaperf
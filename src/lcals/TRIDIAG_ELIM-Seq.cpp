@@ -18,14 +18,14 @@ namespace lcals
 {
 
 
-void TRIDIAG_ELIM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void TRIDIAG_ELIM::runSeqVariantImpl(VariantID vid, Real_T* xout, Real_T* xin,
+                                     Real_T* y, Real_T* z)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 1;
   const Index_type iend = m_N;
 
-  TRIDIAG_ELIM_DATA_SETUP;
-
 #if defined(RUN_RAJA_SEQ)
   auto tridiag_elim_lam = [=](Index_type i) {
                             TRIDIAG_ELIM_BODY;
@@ -88,5 +88,51 @@ void TRIDIAG_ELIM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 }
 
+void TRIDIAG_ELIM::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    TRIDIAG_ELIM_DATA_SETUP;
+
+    runSeqVariantImpl(vid, xout, xin, y, z);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    TRIDIAG_ELIM_DATA_SETUP;
+
+    runSeqVariantImpl(vid, xout, xin, y, z);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    TRIDIAG_ELIM_ALT_DATA_SETUP;
+
+    runSeqVariantImpl(vid, xout, xin, y, z);
+
+  }
+
+  t += 1;
+}
+
+void TRIDIAG_ELIM::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -31,6 +31,8 @@ TRIDIAG_ELIM::TRIDIAG_ELIM(const RunParams& params)
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Real_type ) + 3*sizeof(Real_type )) * (m_N-1) );
+  setTuningBytesPerRep( getPrecisionTuningName<AltReal_type>(),
+                        (1*sizeof(AltReal_type ) + 3*sizeof(AltReal_type )) * (m_N-1) );
   setFLOPsPerRep(2 * (getActualProblemSize()-1));
 
   setUsesFeature(Forall);
@@ -59,26 +61,44 @@ TRIDIAG_ELIM::~TRIDIAG_ELIM()
 {
 }
 
-void TRIDIAG_ELIM::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void TRIDIAG_ELIM::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitDataConst(m_xout, m_N, 0.0, vid);
-  allocAndInitData(m_xin, m_N, vid);
-  allocAndInitData(m_y, m_N, vid);
-  allocAndInitData(m_z, m_N, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    allocAndInitDataConst(m_alt_xout, m_N, AltReal_type(0.0), vid);
+    allocAndInitData(m_alt_xin, m_N, vid);
+    allocAndInitData(m_alt_y, m_N, vid);
+    allocAndInitData(m_alt_z, m_N, vid);
+  } else {
+    allocAndInitDataConst(m_xout, m_N, 0.0, vid);
+    allocAndInitData(m_xin, m_N, vid);
+    allocAndInitData(m_y, m_N, vid);
+    allocAndInitData(m_z, m_N, vid);
+  }
 }
 
 void TRIDIAG_ELIM::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_xout, getActualProblemSize(), vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    checksum[vid][tune_idx] += calcChecksum(m_alt_xout, getActualProblemSize(), vid);
+    setChecksumTolerance<AltReal_type>(vid, tune_idx);
+  } else {
+    checksum[vid][tune_idx] += calcChecksum(m_xout, getActualProblemSize(), vid);
+  }
 }
 
-void TRIDIAG_ELIM::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void TRIDIAG_ELIM::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
-  deallocData(m_xout, vid);
-  deallocData(m_xin, vid);
-  deallocData(m_y, vid);
-  deallocData(m_z, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    deallocData(m_alt_xout, vid);
+    deallocData(m_alt_xin, vid);
+    deallocData(m_alt_y, vid);
+    deallocData(m_alt_z, vid);
+  } else {
+    deallocData(m_xout, vid);
+    deallocData(m_xin, vid);
+    deallocData(m_y, vid);
+    deallocData(m_z, vid);
+  }
 }
 
 } // end namespace lcals
@@ -27,6 +27,12 @@
   Real_ptr y = m_y; \
   Real_ptr z = m_z;
 
+#define TRIDIAG_ELIM_ALT_DATA_SETUP \
+  AltReal_ptr xout = m_alt_xout; \
+  AltReal_ptr xin = m_alt_xin; \
+  AltReal_ptr y = m_alt_y; \
+  AltReal_ptr z = m_alt_z;
+
 #define TRIDIAG_ELIM_BODY  \
   xout[i] = z[i] * ( y[i] - xin[i-1] );
 
@@ -59,8 +65,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename Real_T >
+  void runSeqVariantImpl(VariantID vid, Real_T* xout, Real_T* xin, Real_T* y,
+                         Real_T* z);
+  template < typename Real_T >
+  void runOpenMPVariantImpl(VariantID vid, Real_T* xout, Real_T* xin, Real_T* y,
+                            Real_T* z);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -74,6 +88,10 @@ private:
   Real_ptr m_xin;
   Real_ptr m_y;
   Real_ptr m_z;
+  AltReal_ptr m_alt_xout;
+  AltReal_ptr m_alt_xin;
+  AltReal_ptr m_alt_y;
+  AltReal_ptr m_alt_z;
 
   Index_type m_N;
 };
@@ -10,6 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
+#include <algorithm>
 #include <iostream>
 
 
@@ -26,7 +29,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_2MM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_2MM::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -231,5 +234,186 @@ void POLYBENCH_2MM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+void POLYBENCH_2MM::runOpenMPVariantTaskloop(VariantID vid, Index_type grainsize)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_2MM_DATA_SETUP;
+
+  const Index_type grainsize1 = omp_task::outer_grainsize(grainsize, nj);
+  const Index_type grainsize2 = omp_task::outer_grainsize(grainsize, nl);
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel
+      #pragma omp single nowait
+      {
+        #pragma omp taskloop grainsize(grainsize1)
+        for (Index_type i = 0; i < ni; i++ ) {
+          for(Index_type j = 0; j < nj; j++) {
+            POLYBENCH_2MM_BODY1;
+            for (Index_type k = 0; k < nk; k++) {
+              POLYBENCH_2MM_BODY2;
+            }
+            POLYBENCH_2MM_BODY3;
+          }
+        }
+
+        #pragma omp taskloop grainsize(grainsize2)
+        for(Index_type i = 0; i < ni; i++) {
+          for(Index_type l = 0; l < nl; l++) {
+            POLYBENCH_2MM_BODY4;
+            for (Index_type j = 0; j < nj; j++) {
+              POLYBENCH_2MM_BODY5;
+            }
+            POLYBENCH_2MM_BODY6;
+          }
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+
+    getCout() << "\n  POLYBENCH_2MM : Unknown OpenMP taskloop variant id = " << vid << std::endl;
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(grainsize);
+#endif
+}
+
+void POLYBENCH_2MM::runOpenMPVariantTaskgraph(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_2MM_DATA_SETUP;
+
+  const Index_type block_rows =
+      omp_task::outer_grainsize(omp_task::taskgraph_task_size, nj);
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      // Rows of D only need the same rows of tmp, so each block of rows of
+      // the second product starts as soon as its rows of tmp are done.
+      #pragma omp parallel
+      #pragma omp single nowait
+      for (Index_type ib = 0; ib < ni; ib += block_rows) {
+        const Index_type ie = std::min(ib + block_rows, ni);
+
+        #pragma omp task firstprivate(ib, ie) depend(out: tmp[ib*nj])
+        for (Index_type i = ib; i < ie; i++ ) {
+          for(Index_type j = 0; j < nj; j++) {
+            POLYBENCH_2MM_BODY1;
+            for (Index_type k = 0; k < nk; k++) {
+              POLYBENCH_2MM_BODY2;
+            }
+            POLYBENCH_2MM_BODY3;
+          }
+        }
+
+        #pragma omp task firstprivate(ib, ie) depend(in: tmp[ib*nj])
+        for(Index_type i = ib; i < ie; i++) {
+          for(Index_type l = 0; l < nl; l++) {
+            POLYBENCH_2MM_BODY4;
+            for (Index_type j = 0; j < nj; j++) {
+              POLYBENCH_2MM_BODY5;
+            }
+            POLYBENCH_2MM_BODY6;
+          }
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+
+    getCout() << "\n  POLYBENCH_2MM : Unknown OpenMP taskgraph variant id = " << vid << std::endl;
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_2MM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  if (vid == Base_OpenMP) {
+
+    for (Index_type grainsize : omp_task::taskloop_grainsizes) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantTaskloop(vid, grainsize);
+
+      }
+
+      t += 1;
+
+    }
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantTaskgraph(vid);
+
+    }
+
+    t += 1;
+
+  }
+
+#endif
+}
+
+void POLYBENCH_2MM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  if (vid == Base_OpenMP) {
+
+    for (Index_type grainsize : omp_task::taskloop_grainsizes) {
+      addVariantTuningName(vid, omp_task::taskloop_tuning_name(grainsize));
+    }
+
+    addVariantTuningName(vid, "taskgraph");
+
+  }
+
+#endif
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
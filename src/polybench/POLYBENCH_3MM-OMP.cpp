@@ -10,6 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
+#include <algorithm>
 #include <iostream>
 #include <cstring>
 
@@ -27,7 +30,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_3MM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_3MM::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -295,5 +298,225 @@ void POLYBENCH_3MM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+void POLYBENCH_3MM::runOpenMPVariantTaskloop(VariantID vid, Index_type grainsize)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_3MM_DATA_SETUP;
+
+  const Index_type grainsize1 = omp_task::outer_grainsize(grainsize, nj);
+  const Index_type grainsize2 = omp_task::outer_grainsize(grainsize, nl);
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      // E and F are independent, so only G waits for both of them.
+      #pragma omp parallel
+      #pragma omp single nowait
+      {
+        #pragma omp taskloop grainsize(grainsize1) nogroup
+        for (Index_type i = 0; i < ni; i++ )  {
+          for (Index_type j = 0; j < nj; j++) {
+            POLYBENCH_3MM_BODY1;
+            for (Index_type k = 0; k < nk; k++) {
+              POLYBENCH_3MM_BODY2;
+            }
+            POLYBENCH_3MM_BODY3;
+          }
+        }
+
+        #pragma omp taskloop grainsize(grainsize2) nogroup
+        for (Index_type j = 0; j < nj; j++) {
+          for (Index_type l = 0; l < nl; l++) {
+            POLYBENCH_3MM_BODY4;
+            for (Index_type m = 0; m < nm; m++) {
+              POLYBENCH_3MM_BODY5;
+            }
+            POLYBENCH_3MM_BODY6;
+          }
+        }
+
+        #pragma omp taskwait
+
+        #pragma omp taskloop grainsize(grainsize2)
+        for (Index_type i = 0; i < ni; i++) {
+          for (Index_type l = 0; l < nl; l++) {
+            POLYBENCH_3MM_BODY7;
+            for (Index_type j = 0; j < nj; j++) {
+              POLYBENCH_3MM_BODY8;
+            }
+            POLYBENCH_3MM_BODY9;
+          }
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+
+    getCout() << "\n  POLYBENCH_3MM : Unknown OpenMP taskloop variant id = " << vid << std::endl;
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(grainsize);
+#endif
+}
+
+void POLYBENCH_3MM::runOpenMPVariantTaskgraph(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_3MM_DATA_SETUP;
+
+  const Index_type block_rows1 =
+      omp_task::outer_grainsize(omp_task::taskgraph_task_size, nj);
+  const Index_type block_rows2 =
+      omp_task::outer_grainsize(omp_task::taskgraph_task_size, nl);
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      // Every row of G needs all of F, so F is computed by one task that
+      // waits on its own child tasks. A block of rows of G then starts as
+      // soon as F and the same rows of E are done, overlapping with the
+      // remaining rows of E.
+      #pragma omp parallel
+      #pragma omp single nowait
+      {
+        #pragma omp task depend(out: F[0])
+        {
+          for (Index_type jb = 0; jb < nj; jb += block_rows2) {
+            const Index_type je = std::min(jb + block_rows2, nj);
+            #pragma omp task firstprivate(jb, je)
+            for (Index_type j = jb; j < je; j++) {
+              for (Index_type l = 0; l < nl; l++) {
+                POLYBENCH_3MM_BODY4;
+                for (Index_type m = 0; m < nm; m++) {
+                  POLYBENCH_3MM_BODY5;
+                }
+                POLYBENCH_3MM_BODY6;
+              }
+            }
+          }
+          #pragma omp taskwait
+        }
+
+        for (Index_type ib = 0; ib < ni; ib += block_rows1) {
+          const Index_type ie = std::min(ib + block_rows1, ni);
+
+          #pragma omp task firstprivate(ib, ie) depend(out: E[ib*nj])
+          for (Index_type i = ib; i < ie; i++ )  {
+            for (Index_type j = 0; j < nj; j++) {
+              POLYBENCH_3MM_BODY1;
+              for (Index_type k = 0; k < nk; k++) {
+                POLYBENCH_3MM_BODY2;
+              }
+              POLYBENCH_3MM_BODY3;
+            }
+          }
+
+          #pragma omp task firstprivate(ib, ie) depend(in: E[ib*nj]) \
+                                                depend(in: F[0])
+          for (Index_type i = ib; i < ie; i++) {
+            for (Index_type l = 0; l < nl; l++) {
+              POLYBENCH_3MM_BODY7;
+              for (Index_type j = 0; j < nj; j++) {
+                POLYBENCH_3MM_BODY8;
+              }
+              POLYBENCH_3MM_BODY9;
+            }
+          }
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+
+    getCout() << "\n  POLYBENCH_3MM : Unknown OpenMP taskgraph variant id = " << vid << std::endl;
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_3MM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  if (vid == Base_OpenMP) {
+
+    for (Index_type grainsize : omp_task::taskloop_grainsizes) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantTaskloop(vid, grainsize);
+
+      }
+
+      t += 1;
+
+    }
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantTaskgraph(vid);
+
+    }
+
+    t += 1;
+
+  }
+
+#endif
+}
+
+void POLYBENCH_3MM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJAPERF_OPENMP_TASKLOOP_TUNINGS)
+
+  if (vid == Base_OpenMP) {
+
+    for (Index_type grainsize : omp_task::taskloop_grainsizes) {
+      addVariantTuningName(vid, omp_task::taskloop_tuning_name(grainsize));
+    }
+
+    addVariantTuningName(vid, "taskgraph");
+
+  }
+
+#endif
+}
+
 } // end namespace basic
 } // end namespace rajaperf
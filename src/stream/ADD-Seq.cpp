@@ -18,14 +18,13 @@ namespace stream
 {
 
 // _add_run_seq_start
-void ADD::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void ADD::runSeqVariantImpl(VariantID vid, Real_T* a, Real_T* b, Real_T* c)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  ADD_DATA_SETUP;
-
 #if defined(RUN_RAJA_SEQ)
   auto add_lam = [=](Index_type i) {
                    ADD_BODY;
@@ -89,5 +88,51 @@ void ADD::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 }
 // _add_run_seq_end
 
+void ADD::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    ADD_DATA_SETUP;
+
+    runSeqVariantImpl(vid, a, b, c);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    ADD_DATA_SETUP;
+
+    runSeqVariantImpl(vid, a, b, c);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    ADD_ALT_DATA_SETUP;
+
+    runSeqVariantImpl(vid, a, b, c);
+
+  }
+
+  t += 1;
+}
+
+void ADD::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+
 } // end namespace stream
 } // end namespace rajaperf
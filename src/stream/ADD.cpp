@@ -30,6 +30,9 @@ ADD::ADD(const RunParams& params)
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Real_type) + 2*sizeof(Real_type)) *
                   getActualProblemSize() );
+  setTuningBytesPerRep( getPrecisionTuningName<AltReal_type>(),
+                        (1*sizeof(AltReal_type) + 2*sizeof(AltReal_type)) *
+                        getActualProblemSize() );
   setFLOPsPerRep(1 * getActualProblemSize());
 
   setUsesFeature(Forall);
@@ -60,24 +63,40 @@ ADD::~ADD()
 {
 }
 
-void ADD::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void ADD::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitData(m_a, getActualProblemSize(), vid);
-  allocAndInitData(m_b, getActualProblemSize(), vid);
-  allocAndInitDataConst(m_c, getActualProblemSize(), 0.0, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    allocAndInitData(m_alt_a, getActualProblemSize(), vid);
+    allocAndInitData(m_alt_b, getActualProblemSize(), vid);
+    allocAndInitDataConst(m_alt_c, getActualProblemSize(), AltReal_type(0.0), vid);
+  } else {
+    allocAndInitData(m_a, getActualProblemSize(), vid);
+    allocAndInitData(m_b, getActualProblemSize(), vid);
+    allocAndInitDataConst(m_c, getActualProblemSize(), 0.0, vid);
+  }
 }
 
 void ADD::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_c, getActualProblemSize(), vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    checksum[vid][tune_idx] += calcChecksum(m_alt_c, getActualProblemSize(), vid);
+    setChecksumTolerance<AltReal_type>(vid, tune_idx);
+  } else {
+    checksum[vid][tune_idx] += calcChecksum(m_c, getActualProblemSize(), vid);
+  }
 }
 
-void ADD::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void ADD::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
-  deallocData(m_a, vid);
-  deallocData(m_b, vid);
-  deallocData(m_c, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    deallocData(m_alt_a, vid);
+    deallocData(m_alt_b, vid);
+    deallocData(m_alt_c, vid);
+  } else {
+    deallocData(m_a, vid);
+    deallocData(m_b, vid);
+    deallocData(m_c, vid);
+  }
 }
 
 } // end namespace stream
@@ -22,6 +22,11 @@
   Real_ptr b = m_b; \
   Real_ptr c = m_c;
 
+#define ADD_ALT_DATA_SETUP \
+  AltReal_ptr a = m_alt_a; \
+  AltReal_ptr b = m_alt_b; \
+  AltReal_ptr c = m_alt_c;
+
 #define ADD_BODY  \
   c[i] = a[i] + b[i];
 
@@ -54,8 +59,14 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename Real_T >
+  void runSeqVariantImpl(VariantID vid, Real_T* a, Real_T* b, Real_T* c);
+  template < typename Real_T >
+  void runOpenMPVariantImpl(VariantID vid, Real_T* a, Real_T* b, Real_T* c);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -68,6 +79,9 @@ private:
   Real_ptr m_a;
   Real_ptr m_b;
   Real_ptr m_c;
+  AltReal_ptr m_alt_a;
+  AltReal_ptr m_alt_b;
+  AltReal_ptr m_alt_c;
 
 };
 
@@ -18,14 +18,13 @@ namespace stream
 {
 
 
-void COPY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void COPY::runSeqVariantImpl(VariantID vid, Real_T* a, Real_T* c)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  COPY_DATA_SETUP;
-
 #if defined(RUN_RAJA_SEQ)
   auto copy_lam = [=](Index_type i) {
                     COPY_BODY;
@@ -88,5 +87,51 @@ void COPY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void COPY::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    COPY_DATA_SETUP;
+
+    runSeqVariantImpl(vid, a, c);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    COPY_DATA_SETUP;
+
+    runSeqVariantImpl(vid, a, c);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    COPY_ALT_DATA_SETUP;
+
+    runSeqVariantImpl(vid, a, c);
+
+  }
+
+  t += 1;
+}
+
+void COPY::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+
 } // end namespace stream
 } // end namespace rajaperf
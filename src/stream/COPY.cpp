@@ -30,6 +30,9 @@ COPY::COPY(const RunParams& params)
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) *
                   getActualProblemSize() );
+  setTuningBytesPerRep( getPrecisionTuningName<AltReal_type>(),
+                        (1*sizeof(AltReal_type) + 1*sizeof(AltReal_type)) *
+                        getActualProblemSize() );
   setFLOPsPerRep(0);
 
   setUsesFeature( Forall );
@@ -60,22 +63,36 @@ COPY::~COPY()
 {
 }
 
-void COPY::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void COPY::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitData(m_a, getActualProblemSize(), vid);
-  allocAndInitDataConst(m_c, getActualProblemSize(), 0.0, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    allocAndInitData(m_alt_a, getActualProblemSize(), vid);
+    allocAndInitDataConst(m_alt_c, getActualProblemSize(), AltReal_type(0.0), vid);
+  } else {
+    allocAndInitData(m_a, getActualProblemSize(), vid);
+    allocAndInitDataConst(m_c, getActualProblemSize(), 0.0, vid);
+  }
 }
 
 void COPY::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_c, getActualProblemSize(), vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    checksum[vid][tune_idx] += calcChecksum(m_alt_c, getActualProblemSize(), vid);
+    setChecksumTolerance<AltReal_type>(vid, tune_idx);
+  } else {
+    checksum[vid][tune_idx] += calcChecksum(m_c, getActualProblemSize(), vid);
+  }
 }
 
-void COPY::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void COPY::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
-  deallocData(m_a, vid);
-  deallocData(m_c, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    deallocData(m_alt_a, vid);
+    deallocData(m_alt_c, vid);
+  } else {
+    deallocData(m_a, vid);
+    deallocData(m_c, vid);
+  }
 }
 
 } // end namespace stream
@@ -21,6 +21,10 @@
   Real_ptr a = m_a; \
   Real_ptr c = m_c;
 
+#define COPY_ALT_DATA_SETUP \
+  AltReal_ptr a = m_alt_a; \
+  AltReal_ptr c = m_alt_c;
+
 #define COPY_BODY  \
   c[i] = a[i] ;
 
@@ -53,8 +57,14 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename Real_T >
+  void runSeqVariantImpl(VariantID vid, Real_T* a, Real_T* c);
+  template < typename Real_T >
+  void runOpenMPVariantImpl(VariantID vid, Real_T* a, Real_T* c);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -66,6 +76,8 @@ private:
 
   Real_ptr m_a;
   Real_ptr m_c;
+  AltReal_ptr m_alt_a;
+  AltReal_ptr m_alt_c;
 };
 
 } // end namespace stream
@@ -18,7 +18,8 @@ namespace stream
 {
 
 
-void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void DOT::runOpenMPVariantImpl(VariantID vid, Real_T* a, Real_T* b)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -26,8 +27,6 @@ void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  DOT_DATA_SETUP;
-
   switch ( vid ) {
 
     case Base_OpenMP : {
@@ -105,5 +104,60 @@ void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 #endif
 }
 
+void DOT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    DOT_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, a, b);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    DOT_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, a, b);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    DOT_ALT_DATA_SETUP;
+
+    runOpenMPVariantImpl(vid, a, b);
+
+  }
+
+  t += 1;
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+void DOT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+#endif
+
 } // end namespace stream
 } // end namespace rajaperf
@@ -18,14 +18,13 @@ namespace stream
 {
 
 
-void DOT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void DOT::runSeqVariantImpl(VariantID vid, Real_T* a, Real_T* b)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  DOT_DATA_SETUP;
-
   switch ( vid ) {
 
     case Base_Seq : {
@@ -100,5 +99,51 @@ void DOT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void DOT::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    DOT_DATA_SETUP;
+
+    runSeqVariantImpl(vid, a, b);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    DOT_DATA_SETUP;
+
+    runSeqVariantImpl(vid, a, b);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    DOT_ALT_DATA_SETUP;
+
+    runSeqVariantImpl(vid, a, b);
+
+  }
+
+  t += 1;
+}
+
+void DOT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+
 } // end namespace stream
 } // end namespace rajaperf
@@ -31,6 +31,10 @@ DOT::DOT(const RunParams& params)
   setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) +
                   (0*sizeof(Real_type) + 2*sizeof(Real_type)) *
                   getActualProblemSize() );
+  setTuningBytesPerRep( getPrecisionTuningName<AltReal_type>(),
+                        (1*sizeof(Real_type) + 1*sizeof(Real_type)) +
+                        (0*sizeof(AltReal_type) + 2*sizeof(AltReal_type)) *
+                        getActualProblemSize() );
   setFLOPsPerRep(2 * getActualProblemSize());
 
   setUsesFeature( Forall );
@@ -60,10 +64,15 @@ DOT::~DOT()
 {
 }
 
-void DOT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DOT::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitData(m_a, getActualProblemSize(), vid);
-  allocAndInitData(m_b, getActualProblemSize(), vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    allocAndInitData(m_alt_a, getActualProblemSize(), vid);
+    allocAndInitData(m_alt_b, getActualProblemSize(), vid);
+  } else {
+    allocAndInitData(m_a, getActualProblemSize(), vid);
+    allocAndInitData(m_b, getActualProblemSize(), vid);
+  }
 
   m_dot = 0.0;
   m_dot_init = 0.0;
@@ -72,13 +81,21 @@ void DOT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 void DOT::updateChecksum(VariantID vid, size_t tune_idx)
 {
   checksum[vid][tune_idx] += m_dot;
+
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    setChecksumTolerance<AltReal_type>(vid, tune_idx);
+  }
 }
 
-void DOT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DOT::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
-  deallocData(m_a, vid);
-  deallocData(m_b, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    deallocData(m_alt_a, vid);
+    deallocData(m_alt_b, vid);
+  } else {
+    deallocData(m_a, vid);
+    deallocData(m_b, vid);
+  }
 }
 
 } // end namespace stream
@@ -21,6 +21,10 @@
   Real_ptr a = m_a; \
   Real_ptr b = m_b;
 
+#define DOT_ALT_DATA_SETUP \
+  AltReal_ptr a = m_alt_a; \
+  AltReal_ptr b = m_alt_b;
+
 #define DOT_BODY  \
   dot += a[i] * b[i] ;
 
@@ -53,8 +57,14 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename Real_T >
+  void runSeqVariantImpl(VariantID vid, Real_T* a, Real_T* b);
+  template < typename Real_T >
+  void runOpenMPVariantImpl(VariantID vid, Real_T* a, Real_T* b);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -66,6 +76,8 @@ private:
 
   Real_ptr m_a;
   Real_ptr m_b;
+  AltReal_ptr m_alt_a;
+  AltReal_ptr m_alt_b;
   Real_type m_dot;
   Real_type m_dot_init;
 };
@@ -18,14 +18,13 @@ namespace stream
 {
 
 
-void MUL::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void MUL::runSeqVariantImpl(VariantID vid, Real_T* b, Real_T* c, Real_T alpha)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  MUL_DATA_SETUP;
-
 #if defined(RUN_RAJA_SEQ)
   auto mul_lam = [=](Index_type i) {
                    MUL_BODY;
@@ -88,5 +87,51 @@ void MUL::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void MUL::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    MUL_DATA_SETUP;
+
+    runSeqVariantImpl(vid, b, c, alpha);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    MUL_DATA_SETUP;
+
+    runSeqVariantImpl(vid, b, c, alpha);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    MUL_ALT_DATA_SETUP;
+
+    runSeqVariantImpl(vid, b, c, alpha);
+
+  }
+
+  t += 1;
+}
+
+void MUL::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+
 } // end namespace stream
 } // end namespace rajaperf
@@ -30,6 +30,9 @@ MUL::MUL(const RunParams& params)
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) *
                   getActualProblemSize() );
+  setTuningBytesPerRep( getPrecisionTuningName<AltReal_type>(),
+                        (1*sizeof(AltReal_type) + 1*sizeof(AltReal_type)) *
+                        getActualProblemSize() );
   setFLOPsPerRep(1 * getActualProblemSize());
 
   setUsesFeature( Forall );
@@ -60,23 +63,37 @@ MUL::~MUL()
 {
 }
 
-void MUL::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void MUL::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitDataConst(m_b, getActualProblemSize(), 0.0, vid);
-  allocAndInitData(m_c, getActualProblemSize(), vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    allocAndInitDataConst(m_alt_b, getActualProblemSize(), AltReal_type(0.0), vid);
+    allocAndInitData(m_alt_c, getActualProblemSize(), vid);
+  } else {
+    allocAndInitDataConst(m_b, getActualProblemSize(), 0.0, vid);
+    allocAndInitData(m_c, getActualProblemSize(), vid);
+  }
   initData(m_alpha, vid);
 }
 
 void MUL::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_b, getActualProblemSize(), vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    checksum[vid][tune_idx] += calcChecksum(m_alt_b, getActualProblemSize(), vid);
+    setChecksumTolerance<AltReal_type>(vid, tune_idx);
+  } else {
+    checksum[vid][tune_idx] += calcChecksum(m_b, getActualProblemSize(), vid);
+  }
 }
 
-void MUL::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void MUL::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
-  deallocData(m_b, vid);
-  deallocData(m_c, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    deallocData(m_alt_b, vid);
+    deallocData(m_alt_c, vid);
+  } else {
+    deallocData(m_b, vid);
+    deallocData(m_c, vid);
+  }
 }
 
 } // end namespace stream
@@ -22,6 +22,11 @@
   Real_ptr c = m_c; \
   Real_type alpha = m_alpha;
 
+#define MUL_ALT_DATA_SETUP \
+  AltReal_ptr b = m_alt_b; \
+  AltReal_ptr c = m_alt_c; \
+  AltReal_type alpha = static_cast<AltReal_type>(m_alpha);
+
 #define MUL_BODY  \
   b[i] = alpha * c[i] ;
 
@@ -54,8 +59,14 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < typename Real_T >
+  void runSeqVariantImpl(VariantID vid, Real_T* b, Real_T* c, Real_T alpha);
+  template < typename Real_T >
+  void runOpenMPVariantImpl(VariantID vid, Real_T* b, Real_T* c, Real_T alpha);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -67,6 +78,8 @@ private:
 
   Real_ptr m_b;
   Real_ptr m_c;
+  AltReal_ptr m_alt_b;
+  AltReal_ptr m_alt_c;
   Real_type m_alpha;
 };
 
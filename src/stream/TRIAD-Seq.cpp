@@ -18,14 +18,13 @@ namespace stream
 {
 
 
-void TRIAD::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Real_T >
+void TRIAD::runSeqVariantImpl(VariantID vid, Real_T* a, Real_T* b, Real_T* c, Real_T alpha)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  TRIAD_DATA_SETUP;
-
 #if defined(RUN_RAJA_SEQ)
   auto triad_lam = [=](Index_type i) {
                      TRIAD_BODY;
@@ -88,5 +87,51 @@ void TRIAD::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void TRIAD::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    TRIAD_DATA_SETUP;
+
+    runSeqVariantImpl(vid, a, b, c, alpha);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    TRIAD_DATA_SETUP;
+
+    runSeqVariantImpl(vid, a, b, c, alpha);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    TRIAD_ALT_DATA_SETUP;
+
+    runSeqVariantImpl(vid, a, b, c, alpha);
+
+  }
+
+  t += 1;
+}
+
+void TRIAD::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<Real_type>(),
+                       getDefaultTuningName());
+
+  addVariantTuningName(vid, getPrecisionTuningName<AltReal_type>(),
+                       getDefaultTuningName());
+}
+
 } // end namespace stream
 } // end namespace rajaperf
@@ -30,6 +30,9 @@ TRIAD::TRIAD(const RunParams& params)
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Real_type) + 2*sizeof(Real_type)) *
                   getActualProblemSize() );
+  setTuningBytesPerRep( getPrecisionTuningName<AltReal_type>(),
+                        (1*sizeof(AltReal_type) + 2*sizeof(AltReal_type)) *
+                        getActualProblemSize() );
   setFLOPsPerRep(2 * getActualProblemSize());
 
   checksum_scale_factor = 0.001 *
@@ -64,25 +67,41 @@ TRIAD::~TRIAD()
 {
 }
 
-void TRIAD::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void TRIAD::setUp(VariantID vid, size_t tune_idx)
 {
-  allocAndInitDataConst(m_a, getActualProblemSize(), 0.0, vid);
-  allocAndInitData(m_b, getActualProblemSize(), vid);
-  allocAndInitData(m_c, getActualProblemSize(), vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    allocAndInitDataConst(m_alt_a, getActualProblemSize(), AltReal_type(0.0), vid);
+    allocAndInitData(m_alt_b, getActualProblemSize(), vid);
+    allocAndInitData(m_alt_c, getActualProblemSize(), vid);
+  } else {
+    allocAndInitDataConst(m_a, getActualProblemSize(), 0.0, vid);
+    allocAndInitData(m_b, getActualProblemSize(), vid);
+    allocAndInitData(m_c, getActualProblemSize(), vid);
+  }
   initData(m_alpha, vid);
 }
 
 void TRIAD::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_a, getActualProblemSize(), checksum_scale_factor , vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    checksum[vid][tune_idx] += calcChecksum(m_alt_a, getActualProblemSize(), checksum_scale_factor , vid);
+    setChecksumTolerance<AltReal_type>(vid, tune_idx);
+  } else {
+    checksum[vid][tune_idx] += calcChecksum(m_a, getActualProblemSize(), checksum_scale_factor , vid);
+  }
 }
 
-void TRIAD::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void TRIAD::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
-  deallocData(m_a, vid);
-  deallocData(m_b, vid);
-  deallocData(m_c, vid);
+  if ( isPrecisionTuning<AltReal_type>(vid, tune_idx) ) {
+    deallocData(m_alt_a, vid);
+    deallocData(m_alt_b, vid);
+    deallocData(m_alt_c, vid);
+  } else {
+    deallocData(m_a, vid);
+    deallocData(m_b, vid);
+    deallocData(m_c, vid);
+  }
 }
 
 } // end namespace stream
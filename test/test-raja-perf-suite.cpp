@@ -72,28 +72,6 @@ TEST(ShortSuiteTest, Basic)
 
     rajaperf::KernelBase* kernel = kernels[ik];
 
-    // 
-    // Get reference checksum (first kernel variant run)
-    //
-    rajaperf::Checksum_type cksum_ref = 0.0;
-    size_t ivck = 0;
-    bool found_ref = false;
-    while ( ivck < variant_ids.size() && !found_ref ) {
-
-      rajaperf::VariantID vid = variant_ids[ivck];
-      size_t num_tunings = kernel->getNumVariantTunings(vid);
-      for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
-        if ( kernel->wasVariantTuningRun(vid, tune_idx) ) {
-          cksum_ref = kernel->getChecksum(vid, tune_idx);
-          found_ref = true;
-          break;
-        }
-      }
-      ++ivck;
-
-    } // while loop over variants until reference checksum found
-
-
     //
     // Check execution time is greater than zero and checksum diff is 
     // within tolerance for each variant run.
@@ -109,6 +87,8 @@ TEST(ShortSuiteTest, Basic)
           double rtime = kernel->getTotTime(vid, tune_idx);
 
           rajaperf::Checksum_type cksum = kernel->getChecksum(vid, tune_idx); 
+          rajaperf::Checksum_type cksum_ref =
+              kernel->getReferenceChecksum(variant_ids, vid, tune_idx);
           rajaperf::Checksum_type cksum_diff = std::abs(cksum_ref - cksum);
 
           // Print kernel information when running test manually
@@ -118,7 +98,7 @@ TEST(ShortSuiteTest, Basic)
                     << kernel->getVariantTuningName(vid, tune_idx) 
                     << std::endl;
           EXPECT_GT(rtime, 0.0);
-          EXPECT_LT(cksum_diff, 1e-7);
+          EXPECT_LT(cksum_diff, kernel->getChecksumTolerance(vid, tune_idx));
           
         }
       } 